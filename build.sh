@@ -0,0 +1,27 @@
+#!/bin/sh
+set -e
+
+COMMON="-fno-stack-protector -fno-unwind-tables -fno-asynchronous-unwind-tables -mavx2 -mfma -fenable-matrix -Wall -Wextra -Ilibs -Ishaders"
+
+mkdir -p build
+
+clang -std=c2x src/server.c -O3 -o build/server $COMMON
+clang -std=c2x src/server.c -g -o build/server_debug $COMMON
+
+clang -std=c2x tests/tlsf.c -g -o build/tlsf_test $COMMON -Isrc
+build/tlsf_test
+
+clang -std=c2x tests/ttf.c -g -o build/ttf_test $COMMON -Isrc
+build/ttf_test
+
+clang -std=c2x tests/grid.c -O3 -o build/grid_bench $COMMON -Isrc
+build/grid_bench
+
+clang -std=c2x tests/clients.c -O3 -o build/clients_bench $COMMON -Isrc
+build/clients_bench
+
+clang -std=c2x tests/jobs.c -O3 -o build/jobs_bench $COMMON -Isrc
+build/jobs_bench
+
+clang -std=c2x tests/pool.c -O3 -o build/pool_bench $COMMON -Isrc
+build/pool_bench
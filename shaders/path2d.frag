@@ -1,11 +1,9 @@
 #version 460
 
-layout(location = 0) out vec4 oColor;
+layout(location = 0) in vec4 color;
 
-layout(push_constant) uniform PushConstants {
-	layout(offset = 96) vec4 color;
-} pushConstants;
+layout(location = 0) out vec4 oColor;
 
 void main() {
-	oColor = pushConstants.color;
+	oColor = color;
 }
\ No newline at end of file
@@ -1,11 +1,11 @@
 #version 460
 
-layout(location = 0) in vec2 position;
+layout(location = 0) in vec2 position; // clip space
+layout(location = 1) in vec4 vertexColor;
 
-layout(push_constant) uniform PushConstants {
-	mat4 transform;
-} pushConstants;
+layout(location = 0) out vec4 color;
 
 void main() {
-	gl_Position = pushConstants.transform * vec4(position, 0.0, 1.0);
+	gl_Position = vec4(position, 0.0, 1.0);
+	color = vertexColor;
 }
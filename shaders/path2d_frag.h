@@ -1,21 +1,16 @@
 	// 1112.3.1
 	 #pragma once
 const uint32_t path2d_frag[] = {
-	0x07230203,0x00010000,0x0008000b,0x00000012,0x00000000,0x00020011,0x00000001,0x0006000b,
+	0x07230203,0x00010000,0x00070000,0x00000010,0x00000000,0x00020011,0x00000001,0x0006000b,
 	0x00000001,0x4c534c47,0x6474732e,0x3035342e,0x00000000,0x0003000e,0x00000000,0x00000001,
-	0x0006000f,0x00000004,0x00000004,0x6e69616d,0x00000000,0x00000009,0x00030010,0x00000004,
-	0x00000007,0x00030003,0x00000002,0x000001cc,0x00040005,0x00000004,0x6e69616d,0x00000000,
-	0x00040005,0x00000009,0x6c6f436f,0x0000726f,0x00060005,0x0000000a,0x68737550,0x736e6f43,
-	0x746e6174,0x00000073,0x00050006,0x0000000a,0x00000000,0x6f6c6f63,0x00000072,0x00060005,
-	0x0000000c,0x68737570,0x736e6f43,0x746e6174,0x00000073,0x00040047,0x00000009,0x0000001e,
-	0x00000000,0x00050048,0x0000000a,0x00000000,0x00000023,0x00000060,0x00030047,0x0000000a,
-	0x00000002,0x00020013,0x00000002,0x00030021,0x00000003,0x00000002,0x00030016,0x00000006,
+	0x0007000f,0x00000004,0x0000000d,0x6e69616d,0x00000000,0x0000000e,0x0000000f,0x00030010,
+	0x0000000d,0x00000007,0x00030003,0x00000002,0x000001cc,0x00040005,0x0000000d,0x6e69616d,
+	0x00000000,0x00040005,0x0000000e,0x6c6f436f,0x0000726f,0x00040005,0x0000000f,0x6f6c6f63,
+	0x00000072,0x00040047,0x0000000e,0x0000001e,0x00000000,0x00040047,0x0000000f,0x0000001e,
+	0x00000000,0x00020013,0x00000002,0x00030021,0x00000003,0x00000002,0x00030016,0x00000006,
 	0x00000020,0x00040017,0x00000007,0x00000006,0x00000004,0x00040020,0x00000008,0x00000003,
-	0x00000007,0x0004003b,0x00000008,0x00000009,0x00000003,0x0003001e,0x0000000a,0x00000007,
-	0x00040020,0x0000000b,0x00000009,0x0000000a,0x0004003b,0x0000000b,0x0000000c,0x00000009,
-	0x00040015,0x0000000d,0x00000020,0x00000001,0x0004002b,0x0000000d,0x0000000e,0x00000000,
-	0x00040020,0x0000000f,0x00000009,0x00000007,0x00050036,0x00000002,0x00000004,0x00000000,
-	0x00000003,0x000200f8,0x00000005,0x00050041,0x0000000f,0x00000010,0x0000000c,0x0000000e,
-	0x0004003d,0x00000007,0x00000011,0x00000010,0x0003003e,0x00000009,0x00000011,0x000100fd,
-	0x00010038
+	0x00000007,0x0004003b,0x00000008,0x0000000e,0x00000003,0x00040020,0x0000000a,0x00000001,
+	0x00000007,0x0004003b,0x0000000a,0x0000000f,0x00000001,0x00050036,0x00000002,0x0000000d,
+	0x00000000,0x00000003,0x000200f8,0x00000005,0x0004003d,0x00000007,0x0000000c,0x0000000f,
+	0x0003003e,0x0000000e,0x0000000c,0x000100fd,0x00010038
 };
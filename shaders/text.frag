@@ -1,11 +1,15 @@
 #version 460
 
 layout(location = 0) in vec2 texCoord;
+layout(location = 1) in vec4 color;
 
-layout(binding = 0) uniform sampler2D glyphTexture;
+layout(binding = 0) uniform sampler2D glyphTexture; // signed distance, 0.5 on the outline
 
 layout(location = 0) out vec4 oColor;
 
 void main() {
-	oColor = vec4(1.0, 1.0, 1.0, texture(glyphTexture, texCoord).r);
+	float distance = texture(glyphTexture, texCoord).r;
+	float width = fwidth(distance) * 0.5;
+
+	oColor = vec4(color.rgb, color.a * smoothstep(0.5 - width, 0.5 + width, distance));
 }
\ No newline at end of file
@@ -1,15 +1,15 @@
 #version 460
 
-layout(location = 0) in vec4 vertex;
+layout(location = 0) in vec2 position; // clip space
+layout(location = 1) in vec2 glyphUV;
+layout(location = 2) in vec4 glyphColor;
 
 layout(location = 0) out vec2 uv;
-
-layout(push_constant) uniform PushConstants {
-	mat4 transform;
-} pushConstants;
+layout(location = 1) out vec4 color;
 
 void main() {
-	gl_Position = pushConstants.transform * vec4(vertex.xy, 0.0, 1.0);
+	gl_Position = vec4(position, 0.0, 1.0);
 
-	uv = vertex.zw;
+	uv = glyphUV;
+	color = glyphColor;
 }
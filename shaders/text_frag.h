@@ -1,25 +1,43 @@
 	// 1112.3.1
 	 #pragma once
 const uint32_t text_frag[] = {
-	0x07230203,0x00010000,0x0008000b,0x00000019,0x00000000,0x00020011,0x00000001,0x0006000b,
+	0x07230203,0x00010000,0x00070000,0x00000039,0x00000000,0x00020011,0x00000001,0x0006000b,
 	0x00000001,0x4c534c47,0x6474732e,0x3035342e,0x00000000,0x0003000e,0x00000000,0x00000001,
-	0x0007000f,0x00000004,0x00000004,0x6e69616d,0x00000000,0x00000009,0x00000012,0x00030010,
-	0x00000004,0x00000007,0x00030003,0x00000002,0x000001cc,0x00040005,0x00000004,0x6e69616d,
-	0x00000000,0x00040005,0x00000009,0x6c6f436f,0x0000726f,0x00060005,0x0000000e,0x70796c67,
-	0x78655468,0x65727574,0x00000000,0x00050005,0x00000012,0x43786574,0x64726f6f,0x00000000,
-	0x00040047,0x00000009,0x0000001e,0x00000000,0x00040047,0x0000000e,0x00000022,0x00000000,
-	0x00040047,0x0000000e,0x00000021,0x00000000,0x00040047,0x00000012,0x0000001e,0x00000000,
-	0x00020013,0x00000002,0x00030021,0x00000003,0x00000002,0x00030016,0x00000006,0x00000020,
-	0x00040017,0x00000007,0x00000006,0x00000004,0x00040020,0x00000008,0x00000003,0x00000007,
-	0x0004003b,0x00000008,0x00000009,0x00000003,0x0004002b,0x00000006,0x0000000a,0x3f800000,
-	0x00090019,0x0000000b,0x00000006,0x00000001,0x00000000,0x00000000,0x00000000,0x00000001,
-	0x00000000,0x0003001b,0x0000000c,0x0000000b,0x00040020,0x0000000d,0x00000000,0x0000000c,
-	0x0004003b,0x0000000d,0x0000000e,0x00000000,0x00040017,0x00000010,0x00000006,0x00000002,
-	0x00040020,0x00000011,0x00000001,0x00000010,0x0004003b,0x00000011,0x00000012,0x00000001,
-	0x00040015,0x00000015,0x00000020,0x00000000,0x0004002b,0x00000015,0x00000016,0x00000000,
-	0x00050036,0x00000002,0x00000004,0x00000000,0x00000003,0x000200f8,0x00000005,0x0004003d,
-	0x0000000c,0x0000000f,0x0000000e,0x0004003d,0x00000010,0x00000013,0x00000012,0x00050057,
-	0x00000007,0x00000014,0x0000000f,0x00000013,0x00050051,0x00000006,0x00000017,0x00000014,
-	0x00000000,0x00070050,0x00000007,0x00000018,0x0000000a,0x0000000a,0x0000000a,0x00000017,
-	0x0003003e,0x00000009,0x00000018,0x000100fd,0x00010038
+	0x0008000f,0x00000004,0x00000032,0x6e69616d,0x00000000,0x00000033,0x00000034,0x00000035,
+	0x00030010,0x00000032,0x00000007,0x00030003,0x00000002,0x000001cc,0x00040005,0x00000032,
+	0x6e69616d,0x00000000,0x00050005,0x00000036,0x74736964,0x65636e61,0x00000000,0x00060005,
+	0x00000037,0x70796c67,0x78655468,0x65727574,0x00000000,0x00050005,0x00000033,0x43786574,
+	0x64726f6f,0x00000000,0x00040005,0x00000038,0x74646977,0x00000068,0x00040005,0x00000034,
+	0x6c6f436f,0x0000726f,0x00040005,0x00000035,0x6f6c6f63,0x00000072,0x00040047,0x00000037,
+	0x00000022,0x00000000,0x00040047,0x00000037,0x00000021,0x00000000,0x00040047,0x00000033,
+	0x0000001e,0x00000000,0x00040047,0x00000034,0x0000001e,0x00000000,0x00040047,0x00000035,
+	0x0000001e,0x00000001,0x00020013,0x00000002,0x00030021,0x00000003,0x00000002,0x00030016,
+	0x00000006,0x00000020,0x00040020,0x00000007,0x00000007,0x00000006,0x00090019,0x00000009,
+	0x00000006,0x00000001,0x00000000,0x00000000,0x00000000,0x00000001,0x00000000,0x0003001b,
+	0x0000000a,0x00000009,0x00040020,0x0000000b,0x00000000,0x0000000a,0x0004003b,0x0000000b,
+	0x00000037,0x00000000,0x00040017,0x0000000e,0x00000006,0x00000002,0x00040020,0x0000000f,
+	0x00000001,0x0000000e,0x0004003b,0x0000000f,0x00000033,0x00000001,0x00040017,0x00000012,
+	0x00000006,0x00000004,0x00040015,0x00000014,0x00000020,0x00000000,0x0004002b,0x00000014,
+	0x00000015,0x00000000,0x0004002b,0x00000006,0x0000001a,0x3f000000,0x00040020,0x0000001c,
+	0x00000003,0x00000012,0x0004003b,0x0000001c,0x00000034,0x00000003,0x00040020,0x0000001e,
+	0x00000001,0x00000012,0x0004003b,0x0000001e,0x00000035,0x00000001,0x00040017,0x00000020,
+	0x00000006,0x00000003,0x0004002b,0x00000014,0x00000023,0x00000003,0x00040020,0x00000024,
+	0x00000001,0x00000006,0x00050036,0x00000002,0x00000032,0x00000000,0x00000003,0x000200f8,
+	0x00000005,0x0004003b,0x00000007,0x00000036,0x00000007,0x0004003b,0x00000007,0x00000038,
+	0x00000007,0x0004003d,0x0000000a,0x0000000d,0x00000037,0x0004003d,0x0000000e,0x00000011,
+	0x00000033,0x00050057,0x00000012,0x00000013,0x0000000d,0x00000011,0x00050051,0x00000006,
+	0x00000016,0x00000013,0x00000000,0x0003003e,0x00000036,0x00000016,0x0004003d,0x00000006,
+	0x00000018,0x00000036,0x000400d1,0x00000006,0x00000019,0x00000018,0x00050085,0x00000006,
+	0x0000001b,0x00000019,0x0000001a,0x0003003e,0x00000038,0x0000001b,0x0004003d,0x00000012,
+	0x0000001f,0x00000035,0x0008004f,0x00000020,0x00000021,0x0000001f,0x0000001f,0x00000000,
+	0x00000001,0x00000002,0x00050041,0x00000024,0x00000025,0x00000035,0x00000023,0x0004003d,
+	0x00000006,0x00000026,0x00000025,0x0004003d,0x00000006,0x00000027,0x00000038,0x00050083,
+	0x00000006,0x00000028,0x0000001a,0x00000027,0x0004003d,0x00000006,0x00000029,0x00000038,
+	0x00050081,0x00000006,0x0000002a,0x0000001a,0x00000029,0x0004003d,0x00000006,0x0000002b,
+	0x00000036,0x0008000c,0x00000006,0x0000002c,0x00000001,0x00000031,0x00000028,0x0000002a,
+	0x0000002b,0x00050085,0x00000006,0x0000002d,0x00000026,0x0000002c,0x00050051,0x00000006,
+	0x0000002e,0x00000021,0x00000000,0x00050051,0x00000006,0x0000002f,0x00000021,0x00000001,
+	0x00050051,0x00000006,0x00000030,0x00000021,0x00000002,0x00070050,0x00000012,0x00000031,
+	0x0000002e,0x0000002f,0x00000030,0x0000002d,0x0003003e,0x00000034,0x00000031,0x000100fd,
+	0x00010038
 };
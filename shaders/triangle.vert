@@ -10,6 +10,7 @@ layout(location = 0) out vec3 fragPos;
 layout(location = 1) out vec3 normal;
 layout(location = 2) out vec4 tangent;
 layout(location = 3) out vec2 texCoord;
+layout(location = 4) flat out uint instance;
 
 layout(push_constant) uniform PushConstants {
 	mat4 viewProjection;
@@ -27,4 +28,5 @@ void main() {
 	tangent = normalize(in_tangent * 2.0 - 1.0);
 
 	texCoord = in_texCoord;
+	instance = gl_InstanceIndex;
 }
\ No newline at end of file
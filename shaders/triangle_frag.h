@@ -1,126 +1,133 @@
 	// 1112.3.1
 	 #pragma once
 const uint32_t triangle_frag[] = {
-	0x07230203,0x00010000,0x0008000b,0x0000009d,0x00000000,0x00020011,0x00000001,0x00020011,
-	0x00001153,0x0007000a,0x5f565053,0x5f52484b,0x69623631,0x74735f74,0x6761726f,0x00000065,
-	0x0006000b,0x00000001,0x4c534c47,0x6474732e,0x3035342e,0x00000000,0x0003000e,0x00000000,
-	0x00000001,0x000a000f,0x00000004,0x00000004,0x6e69616d,0x00000000,0x00000022,0x00000045,
-	0x0000004a,0x00000089,0x00000093,0x00030010,0x00000004,0x00000007,0x00030003,0x00000002,
-	0x000001cc,0x00080004,0x455f4c47,0x735f5458,0x65646168,0x36315f72,0x5f746962,0x726f7473,
-	0x00656761,0x00040005,0x00000004,0x6e69616d,0x00000000,0x00050005,0x00000009,0x6d726f6e,
-	0x59586c61,0x00000000,0x00050005,0x00000010,0x74786574,0x73657275,0x00000000,0x00060005,
-	0x00000015,0x68737550,0x736e6f43,0x746e6174,0x00000073,0x00070006,0x00000015,0x00000000,
-	0x656d6163,0x6f506172,0x69746973,0x00006e6f,0x00050006,0x00000015,0x00000001,0x6f6c6f63,
-	0x00000072,0x00070006,0x00000015,0x00000002,0x6d726f6e,0x614d6c61,0x78697274,0x00000000,
-	0x00060006,0x00000015,0x00000003,0x6f6c6f63,0x646e4972,0x00007865,0x00060006,0x00000015,
-	0x00000004,0x6d726f6e,0x6e496c61,0x00786564,0x00060005,0x00000017,0x68737570,0x736e6f43,
-	0x746e6174,0x00000073,0x00050005,0x00000022,0x43786574,0x64726f6f,0x00000000,0x00040005,
-	0x0000002c,0x6d726f6e,0x005a6c61,0x00050005,0x0000003d,0x6d726f6e,0x614d6c61,0x00000070,
-	0x00040005,0x00000043,0x6d726f6e,0x00000000,0x00040005,0x00000045,0x6d726f6e,0x00006c61,
-	0x00040005,0x00000048,0x676e6174,0x00000000,0x00040005,0x0000004a,0x676e6174,0x00746e65,
-	0x00050005,0x0000004e,0x61746962,0x6e65676e,0x00000074,0x00030005,0x00000059,0x006e6274,
-	0x00050005,0x0000006c,0x65736162,0x6f6c6f43,0x00000072,0x00030005,0x0000007a,0x0000004e,
-	0x00030005,0x00000084,0x00000056,0x00050005,0x00000089,0x69736f70,0x6e6f6974,0x00000000,
-	0x00030005,0x0000008d,0x0000004c,0x00040005,0x00000093,0x6c6f436f,0x0000726f,0x00040047,
-	0x00000010,0x00000022,0x00000000,0x00040047,0x00000010,0x00000021,0x00000000,0x00050048,
-	0x00000015,0x00000000,0x00000023,0x00000050,0x00050048,0x00000015,0x00000001,0x00000023,
-	0x00000060,0x00040048,0x00000015,0x00000002,0x00000005,0x00050048,0x00000015,0x00000002,
-	0x00000023,0x00000070,0x00050048,0x00000015,0x00000002,0x00000007,0x00000010,0x00050048,
-	0x00000015,0x00000003,0x00000023,0x000000a0,0x00050048,0x00000015,0x00000004,0x00000023,
-	0x000000a2,0x00030047,0x00000015,0x00000002,0x00040047,0x00000022,0x0000001e,0x00000003,
-	0x00040047,0x00000045,0x0000001e,0x00000001,0x00040047,0x0000004a,0x0000001e,0x00000002,
-	0x00040047,0x00000089,0x0000001e,0x00000000,0x00040047,0x00000093,0x0000001e,0x00000000,
-	0x00020013,0x00000002,0x00030021,0x00000003,0x00000002,0x00030016,0x00000006,0x00000020,
-	0x00040017,0x00000007,0x00000006,0x00000002,0x00040020,0x00000008,0x00000007,0x00000007,
-	0x00090019,0x0000000a,0x00000006,0x00000001,0x00000000,0x00000000,0x00000000,0x00000001,
-	0x00000000,0x0003001b,0x0000000b,0x0000000a,0x00040015,0x0000000c,0x00000020,0x00000000,
-	0x0004002b,0x0000000c,0x0000000d,0x00000007,0x0004001c,0x0000000e,0x0000000b,0x0000000d,
-	0x00040020,0x0000000f,0x00000000,0x0000000e,0x0004003b,0x0000000f,0x00000010,0x00000000,
-	0x00040017,0x00000011,0x00000006,0x00000003,0x00040017,0x00000012,0x00000006,0x00000004,
-	0x00040018,0x00000013,0x00000011,0x00000003,0x00040015,0x00000014,0x00000010,0x00000000,
-	0x0007001e,0x00000015,0x00000011,0x00000012,0x00000013,0x00000014,0x00000014,0x00040020,
-	0x00000016,0x00000009,0x00000015,0x0004003b,0x00000016,0x00000017,0x00000009,0x00040015,
-	0x00000018,0x00000020,0x00000001,0x0004002b,0x00000018,0x00000019,0x00000004,0x00040020,
-	0x0000001a,0x00000009,0x00000014,0x00040020,0x0000001e,0x00000000,0x0000000b,0x00040020,
-	0x00000021,0x00000001,0x00000007,0x0004003b,0x00000021,0x00000022,0x00000001,0x0004002b,
-	0x00000006,0x00000026,0x40000000,0x0004002b,0x00000006,0x00000028,0x3f800000,0x00040020,
-	0x0000002b,0x00000007,0x00000006,0x0004002b,0x0000000c,0x0000002d,0x00000000,0x0004002b,
-	0x0000000c,0x00000034,0x00000001,0x00040020,0x0000003c,0x00000007,0x00000011,0x00040020,
-	0x00000044,0x00000001,0x00000011,0x0004003b,0x00000044,0x00000045,0x00000001,0x00040020,
-	0x00000049,0x00000001,0x00000012,0x0004003b,0x00000049,0x0000004a,0x00000001,0x0004002b,
-	0x0000000c,0x00000052,0x00000003,0x00040020,0x00000053,0x00000001,0x00000006,0x00040020,
-	0x00000058,0x00000007,0x00000013,0x0004002b,0x00000006,0x0000005d,0x00000000,0x00040020,
-	0x0000006b,0x00000007,0x00000012,0x0004002b,0x00000018,0x0000006d,0x00000001,0x00040020,
-	0x0000006e,0x00000009,0x00000012,0x0004002b,0x00000018,0x00000071,0x00000003,0x0004002b,
-	0x00000018,0x0000007b,0x00000002,0x00040020,0x0000007c,0x00000009,0x00000013,0x0004002b,
-	0x00000018,0x00000085,0x00000000,0x00040020,0x00000086,0x00000009,0x00000011,0x0004003b,
-	0x00000044,0x00000089,0x00000001,0x0004002b,0x00000006,0x0000008e,0x3eb851ec,0x0004002b,
-	0x00000006,0x0000008f,0x3f4ccccd,0x0004002b,0x00000006,0x00000090,0x3ef5c28f,0x0006002c,
-	0x00000011,0x00000091,0x0000008e,0x0000008f,0x00000090,0x00040020,0x00000092,0x00000003,
-	0x00000012,0x0004003b,0x00000092,0x00000093,0x00000003,0x0004002b,0x00000006,0x00000095,
-	0x3f000000,0x00050036,0x00000002,0x00000004,0x00000000,0x00000003,0x000200f8,0x00000005,
-	0x0004003b,0x00000008,0x00000009,0x00000007,0x0004003b,0x0000002b,0x0000002c,0x00000007,
-	0x0004003b,0x0000003c,0x0000003d,0x00000007,0x0004003b,0x0000003c,0x00000043,0x00000007,
-	0x0004003b,0x0000003c,0x00000048,0x00000007,0x0004003b,0x0000003c,0x0000004e,0x00000007,
-	0x0004003b,0x00000058,0x00000059,0x00000007,0x0004003b,0x0000006b,0x0000006c,0x00000007,
-	0x0004003b,0x0000003c,0x0000007a,0x00000007,0x0004003b,0x0000003c,0x00000084,0x00000007,
-	0x0004003b,0x0000003c,0x0000008d,0x00000007,0x00050041,0x0000001a,0x0000001b,0x00000017,
-	0x00000019,0x0004003d,0x00000014,0x0000001c,0x0000001b,0x00040071,0x0000000c,0x0000001d,
-	0x0000001c,0x00050041,0x0000001e,0x0000001f,0x00000010,0x0000001d,0x0004003d,0x0000000b,
-	0x00000020,0x0000001f,0x0004003d,0x00000007,0x00000023,0x00000022,0x00050057,0x00000012,
-	0x00000024,0x00000020,0x00000023,0x0007004f,0x00000007,0x00000025,0x00000024,0x00000024,
-	0x00000000,0x00000001,0x0005008e,0x00000007,0x00000027,0x00000025,0x00000026,0x00050050,
-	0x00000007,0x00000029,0x00000028,0x00000028,0x00050083,0x00000007,0x0000002a,0x00000027,
-	0x00000029,0x0003003e,0x00000009,0x0000002a,0x00050041,0x0000002b,0x0000002e,0x00000009,
-	0x0000002d,0x0004003d,0x00000006,0x0000002f,0x0000002e,0x00050041,0x0000002b,0x00000030,
-	0x00000009,0x0000002d,0x0004003d,0x00000006,0x00000031,0x00000030,0x00050085,0x00000006,
-	0x00000032,0x0000002f,0x00000031,0x00050083,0x00000006,0x00000033,0x00000028,0x00000032,
-	0x00050041,0x0000002b,0x00000035,0x00000009,0x00000034,0x0004003d,0x00000006,0x00000036,
-	0x00000035,0x00050041,0x0000002b,0x00000037,0x00000009,0x00000034,0x0004003d,0x00000006,
-	0x00000038,0x00000037,0x00050085,0x00000006,0x00000039,0x00000036,0x00000038,0x00050081,
-	0x00000006,0x0000003a,0x00000033,0x00000039,0x0006000c,0x00000006,0x0000003b,0x00000001,
-	0x0000001f,0x0000003a,0x0003003e,0x0000002c,0x0000003b,0x0004003d,0x00000007,0x0000003e,
-	0x00000009,0x0004003d,0x00000006,0x0000003f,0x0000002c,0x00050051,0x00000006,0x00000040,
-	0x0000003e,0x00000000,0x00050051,0x00000006,0x00000041,0x0000003e,0x00000001,0x00060050,
-	0x00000011,0x00000042,0x00000040,0x00000041,0x0000003f,0x0003003e,0x0000003d,0x00000042,
-	0x0004003d,0x00000011,0x00000046,0x00000045,0x0006000c,0x00000011,0x00000047,0x00000001,
-	0x00000045,0x00000046,0x0003003e,0x00000043,0x00000047,0x0004003d,0x00000012,0x0000004b,
-	0x0000004a,0x0008004f,0x00000011,0x0000004c,0x0000004b,0x0000004b,0x00000000,0x00000001,
-	0x00000002,0x0006000c,0x00000011,0x0000004d,0x00000001,0x00000045,0x0000004c,0x0003003e,
-	0x00000048,0x0000004d,0x0004003d,0x00000011,0x0000004f,0x00000043,0x0004003d,0x00000011,
-	0x00000050,0x00000048,0x0007000c,0x00000011,0x00000051,0x00000001,0x00000044,0x0000004f,
-	0x00000050,0x00050041,0x00000053,0x00000054,0x0000004a,0x00000052,0x0004003d,0x00000006,
-	0x00000055,0x00000054,0x0005008e,0x00000011,0x00000056,0x00000051,0x00000055,0x0006000c,
-	0x00000011,0x00000057,0x00000001,0x00000045,0x00000056,0x0003003e,0x0000004e,0x00000057,
-	0x0004003d,0x00000011,0x0000005a,0x00000048,0x0004003d,0x00000011,0x0000005b,0x0000004e,
-	0x0004003d,0x00000011,0x0000005c,0x00000043,0x00050051,0x00000006,0x0000005e,0x0000005a,
-	0x00000000,0x00050051,0x00000006,0x0000005f,0x0000005a,0x00000001,0x00050051,0x00000006,
-	0x00000060,0x0000005a,0x00000002,0x00050051,0x00000006,0x00000061,0x0000005b,0x00000000,
-	0x00050051,0x00000006,0x00000062,0x0000005b,0x00000001,0x00050051,0x00000006,0x00000063,
-	0x0000005b,0x00000002,0x00050051,0x00000006,0x00000064,0x0000005c,0x00000000,0x00050051,
-	0x00000006,0x00000065,0x0000005c,0x00000001,0x00050051,0x00000006,0x00000066,0x0000005c,
-	0x00000002,0x00060050,0x00000011,0x00000067,0x0000005e,0x0000005f,0x00000060,0x00060050,
-	0x00000011,0x00000068,0x00000061,0x00000062,0x00000063,0x00060050,0x00000011,0x00000069,
-	0x00000064,0x00000065,0x00000066,0x00060050,0x00000013,0x0000006a,0x00000067,0x00000068,
-	0x00000069,0x0003003e,0x00000059,0x0000006a,0x00050041,0x0000006e,0x0000006f,0x00000017,
-	0x0000006d,0x0004003d,0x00000012,0x00000070,0x0000006f,0x00050041,0x0000001a,0x00000072,
-	0x00000017,0x00000071,0x0004003d,0x00000014,0x00000073,0x00000072,0x00040071,0x0000000c,
-	0x00000074,0x00000073,0x00050041,0x0000001e,0x00000075,0x00000010,0x00000074,0x0004003d,
-	0x0000000b,0x00000076,0x00000075,0x0004003d,0x00000007,0x00000077,0x00000022,0x00050057,
-	0x00000012,0x00000078,0x00000076,0x00000077,0x00050085,0x00000012,0x00000079,0x00000070,
-	0x00000078,0x0003003e,0x0000006c,0x00000079,0x00050041,0x0000007c,0x0000007d,0x00000017,
-	0x0000007b,0x0004003d,0x00000013,0x0000007e,0x0000007d,0x0004003d,0x00000013,0x0000007f,
-	0x00000059,0x00050092,0x00000013,0x00000080,0x0000007e,0x0000007f,0x0004003d,0x00000011,
-	0x00000081,0x0000003d,0x00050091,0x00000011,0x00000082,0x00000080,0x00000081,0x0006000c,
-	0x00000011,0x00000083,0x00000001,0x00000045,0x00000082,0x0003003e,0x0000007a,0x00000083,
-	0x00050041,0x00000086,0x00000087,0x00000017,0x00000085,0x0004003d,0x00000011,0x00000088,
-	0x00000087,0x0004003d,0x00000011,0x0000008a,0x00000089,0x00050083,0x00000011,0x0000008b,
-	0x00000088,0x0000008a,0x0006000c,0x00000011,0x0000008c,0x00000001,0x00000045,0x0000008b,
-	0x0003003e,0x00000084,0x0000008c,0x0003003e,0x0000008d,0x00000091,0x0004003d,0x00000011,
-	0x00000094,0x0000007a,0x0005008e,0x00000011,0x00000096,0x00000094,0x00000095,0x00060050,
-	0x00000011,0x00000097,0x00000095,0x00000095,0x00000095,0x00050081,0x00000011,0x00000098,
-	0x00000096,0x00000097,0x00050051,0x00000006,0x00000099,0x00000098,0x00000000,0x00050051,
-	0x00000006,0x0000009a,0x00000098,0x00000001,0x00050051,0x00000006,0x0000009b,0x00000098,
-	0x00000002,0x00070050,0x00000012,0x0000009c,0x00000099,0x0000009a,0x0000009b,0x00000028,
-	0x0003003e,0x00000093,0x0000009c,0x000100fd,0x00010038
+	0x07230203,0x00010000,0x00070000,0x000000bf,0x00000000,0x00020011,0x00000001,0x0006000b,
+	0x00000001,0x4c534c47,0x6474732e,0x3035342e,0x00000000,0x0003000e,0x00000000,0x00000001,
+	0x000b000f,0x00000004,0x000000a6,0x6e69616d,0x00000000,0x000000a7,0x000000a8,0x000000a9,
+	0x000000aa,0x000000ab,0x000000ac,0x00030010,0x000000a6,0x00000007,0x00030003,0x00000002,
+	0x000001cc,0x00040005,0x000000a6,0x6e69616d,0x00000000,0x00050005,0x000000ad,0x6d726f6e,
+	0x59586c61,0x00000000,0x00050005,0x000000ae,0x74786574,0x73657275,0x00000000,0x00060005,
+	0x000000af,0x68737550,0x736e6f43,0x746e6174,0x00000073,0x00070006,0x000000af,0x00000000,
+	0x656d6163,0x6f506172,0x69746973,0x00006e6f,0x00060005,0x000000b0,0x68737570,0x736e6f43,
+	0x746e6174,0x00000073,0x00050005,0x000000b1,0x74736e49,0x65636e61,0x00000000,0x00070006,
+	0x000000b1,0x00000000,0x6d726f6e,0x614d6c61,0x78697274,0x00000000,0x00050006,0x000000b1,
+	0x00000001,0x6f6c6f63,0x00000072,0x00060006,0x000000b1,0x00000002,0x6f6c6f63,0x646e4972,
+	0x00007865,0x00060006,0x000000b1,0x00000003,0x6d726f6e,0x6e496c61,0x00786564,0x00050005,
+	0x000000b2,0x74736e49,0x65636e61,0x00000073,0x00060006,0x000000b2,0x00000000,0x74736e69,
+	0x65636e61,0x00000073,0x00030005,0x000000b3,0x00000000,0x00050005,0x000000a7,0x74736e69,
+	0x65636e61,0x00000000,0x00050005,0x000000a8,0x43786574,0x64726f6f,0x00000000,0x00040005,
+	0x000000b4,0x6d726f6e,0x005a6c61,0x00050005,0x000000b5,0x6d726f6e,0x614d6c61,0x00000070,
+	0x00040005,0x000000b6,0x6d726f6e,0x00000000,0x00040005,0x000000a9,0x6d726f6e,0x00006c61,
+	0x00040005,0x000000b7,0x676e6174,0x00000000,0x00040005,0x000000aa,0x676e6174,0x00746e65,
+	0x00050005,0x000000b8,0x61746962,0x6e65676e,0x00000074,0x00030005,0x000000b9,0x006e6274,
+	0x00050005,0x000000ba,0x65736162,0x6f6c6f43,0x00000072,0x00030005,0x000000bb,0x0000004e,
+	0x00030005,0x000000bc,0x00000056,0x00050005,0x000000ab,0x69736f70,0x6e6f6974,0x00000000,
+	0x00030005,0x000000bd,0x0000004c,0x00040005,0x000000ac,0x6c6f436f,0x0000726f,0x00040047,
+	0x000000ae,0x00000022,0x00000000,0x00040047,0x000000ae,0x00000021,0x00000000,0x00050048,
+	0x000000af,0x00000000,0x00000023,0x00000050,0x00030047,0x000000af,0x00000002,0x00040048,
+	0x000000b1,0x00000000,0x00000005,0x00050048,0x000000b1,0x00000000,0x00000023,0x00000000,
+	0x00050048,0x000000b1,0x00000000,0x00000007,0x00000010,0x00050048,0x000000b1,0x00000001,
+	0x00000023,0x00000030,0x00050048,0x000000b1,0x00000002,0x00000023,0x00000040,0x00050048,
+	0x000000b1,0x00000003,0x00000023,0x00000044,0x00040047,0x000000be,0x00000006,0x00000050,
+	0x00040048,0x000000b2,0x00000000,0x00000018,0x00050048,0x000000b2,0x00000000,0x00000023,
+	0x00000000,0x00030047,0x000000b2,0x00000003,0x00040047,0x000000b3,0x00000022,0x00000000,
+	0x00040047,0x000000b3,0x00000021,0x00000001,0x00030047,0x000000a7,0x0000000e,0x00040047,
+	0x000000a7,0x0000001e,0x00000004,0x00040047,0x000000a8,0x0000001e,0x00000003,0x00040047,
+	0x000000a9,0x0000001e,0x00000001,0x00040047,0x000000aa,0x0000001e,0x00000002,0x00040047,
+	0x000000ab,0x0000001e,0x00000000,0x00040047,0x000000ac,0x0000001e,0x00000000,0x00020013,
+	0x00000002,0x00030021,0x00000003,0x00000002,0x00030016,0x00000006,0x00000020,0x00040017,
+	0x00000007,0x00000006,0x00000002,0x00040020,0x00000008,0x00000007,0x00000007,0x00090019,
+	0x0000000a,0x00000006,0x00000001,0x00000000,0x00000000,0x00000000,0x00000001,0x00000000,
+	0x0003001b,0x0000000b,0x0000000a,0x00040015,0x0000000c,0x00000020,0x00000000,0x0004002b,
+	0x0000000c,0x0000000d,0x00000007,0x0004001c,0x0000000e,0x0000000b,0x0000000d,0x00040020,
+	0x0000000f,0x00000000,0x0000000e,0x0004003b,0x0000000f,0x000000ae,0x00000000,0x00040017,
+	0x00000011,0x00000006,0x00000003,0x00040017,0x00000012,0x00000006,0x00000004,0x00040018,
+	0x00000013,0x00000011,0x00000003,0x0003001e,0x000000af,0x00000011,0x00040020,0x00000016,
+	0x00000009,0x000000af,0x0004003b,0x00000016,0x000000b0,0x00000009,0x00040015,0x00000018,
+	0x00000020,0x00000001,0x00040020,0x0000001e,0x00000000,0x0000000b,0x00040020,0x00000021,
+	0x00000001,0x00000007,0x0004003b,0x00000021,0x000000a8,0x00000001,0x0004002b,0x00000006,
+	0x00000026,0x40000000,0x0004002b,0x00000006,0x00000028,0x3f800000,0x00040020,0x0000002b,
+	0x00000007,0x00000006,0x0004002b,0x0000000c,0x0000002d,0x00000000,0x0004002b,0x0000000c,
+	0x00000034,0x00000001,0x00040020,0x0000003c,0x00000007,0x00000011,0x00040020,0x00000044,
+	0x00000001,0x00000011,0x0004003b,0x00000044,0x000000a9,0x00000001,0x00040020,0x00000049,
+	0x00000001,0x00000012,0x0004003b,0x00000049,0x000000aa,0x00000001,0x0004002b,0x0000000c,
+	0x00000052,0x00000003,0x00040020,0x00000053,0x00000001,0x00000006,0x00040020,0x00000058,
+	0x00000007,0x00000013,0x0004002b,0x00000006,0x0000005d,0x00000000,0x00040020,0x0000006b,
+	0x00000007,0x00000012,0x0004002b,0x00000018,0x0000006d,0x00000001,0x0004002b,0x00000018,
+	0x00000071,0x00000003,0x0004002b,0x00000018,0x0000007b,0x00000002,0x0004002b,0x00000018,
+	0x00000085,0x00000000,0x00040020,0x00000086,0x00000009,0x00000011,0x0004003b,0x00000044,
+	0x000000ab,0x00000001,0x0006001e,0x000000b1,0x00000013,0x00000012,0x0000000c,0x0000000c,
+	0x0003001d,0x000000be,0x000000b1,0x0003001e,0x000000b2,0x000000be,0x00040020,0x000000a0,
+	0x00000002,0x000000b2,0x0004003b,0x000000a0,0x000000b3,0x00000002,0x00040020,0x000000a1,
+	0x00000001,0x0000000c,0x0004003b,0x000000a1,0x000000a7,0x00000001,0x00040020,0x000000a2,
+	0x00000002,0x0000000c,0x00040020,0x000000a3,0x00000002,0x00000012,0x00040020,0x000000a4,
+	0x00000002,0x00000013,0x0004002b,0x00000006,0x0000008e,0x3eb851ec,0x0004002b,0x00000006,
+	0x0000008f,0x3f4ccccd,0x0004002b,0x00000006,0x00000090,0x3ef5c28f,0x0006002c,0x00000011,
+	0x00000091,0x0000008e,0x0000008f,0x00000090,0x00040020,0x00000092,0x00000003,0x00000012,
+	0x0004003b,0x00000092,0x000000ac,0x00000003,0x0004002b,0x00000006,0x00000095,0x3f000000,
+	0x00050036,0x00000002,0x000000a6,0x00000000,0x00000003,0x000200f8,0x00000005,0x0004003b,
+	0x00000008,0x000000ad,0x00000007,0x0004003b,0x0000002b,0x000000b4,0x00000007,0x0004003b,
+	0x0000003c,0x000000b5,0x00000007,0x0004003b,0x0000003c,0x000000b6,0x00000007,0x0004003b,
+	0x0000003c,0x000000b7,0x00000007,0x0004003b,0x0000003c,0x000000b8,0x00000007,0x0004003b,
+	0x00000058,0x000000b9,0x00000007,0x0004003b,0x0000006b,0x000000ba,0x00000007,0x0004003b,
+	0x0000003c,0x000000bb,0x00000007,0x0004003b,0x0000003c,0x000000bc,0x00000007,0x0004003b,
+	0x0000003c,0x000000bd,0x00000007,0x0004003d,0x0000000c,0x000000a5,0x000000a7,0x00070041,
+	0x000000a2,0x0000001b,0x000000b3,0x00000085,0x000000a5,0x00000071,0x0004003d,0x0000000c,
+	0x0000001d,0x0000001b,0x00050041,0x0000001e,0x0000001f,0x000000ae,0x0000001d,0x0004003d,
+	0x0000000b,0x00000020,0x0000001f,0x0004003d,0x00000007,0x00000023,0x000000a8,0x00050057,
+	0x00000012,0x00000024,0x00000020,0x00000023,0x0007004f,0x00000007,0x00000025,0x00000024,
+	0x00000024,0x00000000,0x00000001,0x0005008e,0x00000007,0x00000027,0x00000025,0x00000026,
+	0x00050050,0x00000007,0x00000029,0x00000028,0x00000028,0x00050083,0x00000007,0x0000002a,
+	0x00000027,0x00000029,0x0003003e,0x000000ad,0x0000002a,0x00050041,0x0000002b,0x0000002e,
+	0x000000ad,0x0000002d,0x0004003d,0x00000006,0x0000002f,0x0000002e,0x00050041,0x0000002b,
+	0x00000030,0x000000ad,0x0000002d,0x0004003d,0x00000006,0x00000031,0x00000030,0x00050085,
+	0x00000006,0x00000032,0x0000002f,0x00000031,0x00050083,0x00000006,0x00000033,0x00000028,
+	0x00000032,0x00050041,0x0000002b,0x00000035,0x000000ad,0x00000034,0x0004003d,0x00000006,
+	0x00000036,0x00000035,0x00050041,0x0000002b,0x00000037,0x000000ad,0x00000034,0x0004003d,
+	0x00000006,0x00000038,0x00000037,0x00050085,0x00000006,0x00000039,0x00000036,0x00000038,
+	0x00050081,0x00000006,0x0000003a,0x00000033,0x00000039,0x0006000c,0x00000006,0x0000003b,
+	0x00000001,0x0000001f,0x0000003a,0x0003003e,0x000000b4,0x0000003b,0x0004003d,0x00000007,
+	0x0000003e,0x000000ad,0x0004003d,0x00000006,0x0000003f,0x000000b4,0x00050051,0x00000006,
+	0x00000040,0x0000003e,0x00000000,0x00050051,0x00000006,0x00000041,0x0000003e,0x00000001,
+	0x00060050,0x00000011,0x00000042,0x00000040,0x00000041,0x0000003f,0x0003003e,0x000000b5,
+	0x00000042,0x0004003d,0x00000011,0x00000046,0x000000a9,0x0006000c,0x00000011,0x00000047,
+	0x00000001,0x00000045,0x00000046,0x0003003e,0x000000b6,0x00000047,0x0004003d,0x00000012,
+	0x0000004b,0x000000aa,0x0008004f,0x00000011,0x0000004c,0x0000004b,0x0000004b,0x00000000,
+	0x00000001,0x00000002,0x0006000c,0x00000011,0x0000004d,0x00000001,0x00000045,0x0000004c,
+	0x0003003e,0x000000b7,0x0000004d,0x0004003d,0x00000011,0x0000004f,0x000000b6,0x0004003d,
+	0x00000011,0x00000050,0x000000b7,0x0007000c,0x00000011,0x00000051,0x00000001,0x00000044,
+	0x0000004f,0x00000050,0x00050041,0x00000053,0x00000054,0x000000aa,0x00000052,0x0004003d,
+	0x00000006,0x00000055,0x00000054,0x0005008e,0x00000011,0x00000056,0x00000051,0x00000055,
+	0x0006000c,0x00000011,0x00000057,0x00000001,0x00000045,0x00000056,0x0003003e,0x000000b8,
+	0x00000057,0x0004003d,0x00000011,0x0000005a,0x000000b7,0x0004003d,0x00000011,0x0000005b,
+	0x000000b8,0x0004003d,0x00000011,0x0000005c,0x000000b6,0x00050051,0x00000006,0x0000005e,
+	0x0000005a,0x00000000,0x00050051,0x00000006,0x0000005f,0x0000005a,0x00000001,0x00050051,
+	0x00000006,0x00000060,0x0000005a,0x00000002,0x00050051,0x00000006,0x00000061,0x0000005b,
+	0x00000000,0x00050051,0x00000006,0x00000062,0x0000005b,0x00000001,0x00050051,0x00000006,
+	0x00000063,0x0000005b,0x00000002,0x00050051,0x00000006,0x00000064,0x0000005c,0x00000000,
+	0x00050051,0x00000006,0x00000065,0x0000005c,0x00000001,0x00050051,0x00000006,0x00000066,
+	0x0000005c,0x00000002,0x00060050,0x00000011,0x00000067,0x0000005e,0x0000005f,0x00000060,
+	0x00060050,0x00000011,0x00000068,0x00000061,0x00000062,0x00000063,0x00060050,0x00000011,
+	0x00000069,0x00000064,0x00000065,0x00000066,0x00060050,0x00000013,0x0000006a,0x00000067,
+	0x00000068,0x00000069,0x0003003e,0x000000b9,0x0000006a,0x00070041,0x000000a3,0x0000006f,
+	0x000000b3,0x00000085,0x000000a5,0x0000006d,0x0004003d,0x00000012,0x00000070,0x0000006f,
+	0x00070041,0x000000a2,0x00000072,0x000000b3,0x00000085,0x000000a5,0x0000007b,0x0004003d,
+	0x0000000c,0x00000074,0x00000072,0x00050041,0x0000001e,0x00000075,0x000000ae,0x00000074,
+	0x0004003d,0x0000000b,0x00000076,0x00000075,0x0004003d,0x00000007,0x00000077,0x000000a8,
+	0x00050057,0x00000012,0x00000078,0x00000076,0x00000077,0x00050085,0x00000012,0x00000079,
+	0x00000070,0x00000078,0x0003003e,0x000000ba,0x00000079,0x00070041,0x000000a4,0x0000007d,
+	0x000000b3,0x00000085,0x000000a5,0x00000085,0x0004003d,0x00000013,0x0000007e,0x0000007d,
+	0x0004003d,0x00000013,0x0000007f,0x000000b9,0x00050092,0x00000013,0x00000080,0x0000007e,
+	0x0000007f,0x0004003d,0x00000011,0x00000081,0x000000b5,0x00050091,0x00000011,0x00000082,
+	0x00000080,0x00000081,0x0006000c,0x00000011,0x00000083,0x00000001,0x00000045,0x00000082,
+	0x0003003e,0x000000bb,0x00000083,0x00050041,0x00000086,0x00000087,0x000000b0,0x00000085,
+	0x0004003d,0x00000011,0x00000088,0x00000087,0x0004003d,0x00000011,0x0000008a,0x000000ab,
+	0x00050083,0x00000011,0x0000008b,0x00000088,0x0000008a,0x0006000c,0x00000011,0x0000008c,
+	0x00000001,0x00000045,0x0000008b,0x0003003e,0x000000bc,0x0000008c,0x0003003e,0x000000bd,
+	0x00000091,0x0004003d,0x00000011,0x00000094,0x000000bb,0x0005008e,0x00000011,0x00000096,
+	0x00000094,0x00000095,0x00060050,0x00000011,0x00000097,0x00000095,0x00000095,0x00000095,
+	0x00050081,0x00000011,0x00000098,0x00000096,0x00000097,0x00050051,0x00000006,0x00000099,
+	0x00000098,0x00000000,0x00050051,0x00000006,0x0000009a,0x00000098,0x00000001,0x00050051,
+	0x00000006,0x0000009b,0x00000098,0x00000002,0x00070050,0x00000012,0x0000009c,0x00000099,
+	0x0000009a,0x0000009b,0x00000028,0x0003003e,0x000000ac,0x0000009c,0x000100fd,0x00010038
 };
@@ -1,4 +1,7 @@
-#include "assets.h"
+#pragma once
+
+#include "ring.h"
+#include "arena.h"
 
 enum LineJoin {
 	LINE_JOIN_MITER,
@@ -11,67 +14,355 @@ enum LineCap {
 	LINE_CAP_SQUARE
 };
 
+// whether a point inside several subpaths is filled: by the sum of their windings around it, or by how many there are
+enum FillRule {
+	FILL_RULE_NONZERO,
+	FILL_RULE_EVEN_ODD
+};
+
 struct SubPath2D {
+	u32 firstPoint;
 	u32 pointCount;
 	bool closed;
-	vec2* points;
 };
 
+// every subpath's points back to back in the frame arena, only the last subpath ever grows
 struct Path2D {
-	u32 subPathCount;
+	vec2* points;
+	u32 pointCount;
+	u32 pointCapacity;
+
 	struct SubPath2D* subPaths;
+	u32 subPathCount;
+	u32 subPathCapacity;
 };
 
-static mat4 viewport;
+// 2D geometry goes to the ring as it's built while the draws wait in a command list until a flush, which merges each
+// command into the newest batch drawn with the same pipeline and image so long as nothing drawn in between overlaps it;
+// color travels with the vertices and the transform is applied as they're written, so neither breaks a batch
+#define FLUSH_2D_LOOKBACK 16 // batches a command may move back past
+#define VERTICES_2D_MAX 65536 // indices are 16 bit and count from the start of the vertex chunk
+#define PATH_2D_TOLERANCE 0.25f // pixels a flattened curve may stray from the real one
+#define PATH_2D_MAX_STEPS 1024 // per curve
+
+struct Vertex2D {
+	vec2 position; // clip space
+	u8vec4 color;
+};
+
+struct VertexText {
+	vec2 position; // clip space
+	u16vec2 uv; // unorm
+	u8vec4 color;
+};
 
-static u16* indices2D;
-static u32 indices2DCount;
+struct Command2D {
+	vec4 bounds; // min xy, max xy in clip space
+	u32 firstIndex; // into batch2D.indices
+	u32 indexCount;
+	u32 next; // in the same batch
+	enum Pipelines pipeline;
+	u16 imageView;
+};
+
+struct Batch2D {
+	vec4 bounds;
+	u32 first, last; // commands
+	enum Pipelines pipeline;
+	u16 imageView;
+};
 
-static vec2* vertices2D;
+static mat4 viewport;
+
+// each vertex stream writes into a chunk of frameRing and counts from the start of it
+static struct RingChunk vertices2DChunk; // vertex binding 0
+static struct Vertex2D* vertices2D;
 static u32 vertices2DCount;
 
-static vec4* verticesText;
+static struct RingChunk verticesTextChunk; // vertex binding 1
+static struct VertexText* verticesText;
 static u32 verticesTextCount;
 
-static struct Path2D path = {
-	.subPathCount = 0,
-	.subPaths = (struct SubPath2D[]){
-		{
-			.points = (vec2[512]){ 0 }
-		}, {
-			.points = (vec2[512]){ 0 }
-		}, {
-			.points = (vec2[512]){ 0 }
+static struct {
+	mat4 transform; // viewport * the current transform
+	float scale; // pixels per path unit along the current transform's longer axis
+
+	// since the last flush, in the frame arena
+	u16* indices;
+	u32 indexCount;
+	u32 indexCapacity;
+	struct Command2D* commands;
+	u32 commandCount;
+	u32 commandCapacity;
+
+	vec4 bounds; // of what's been written since the last command
+
+	// this frame: commands recorded, draws they became and nanoseconds spent flushing
+	u32 recorded;
+	u32 draws;
+	u64 flushTime;
+
+	// this frame: points curves were flattened into and nanoseconds spent on it
+	u32 flattened;
+	u64 flattenTime;
+} batch2D = {
+	.scale = 1.f
+};
+
+static struct Path2D path; // reset with the frame arena
+
+#define BOUNDS_2D_EMPTY ((vec4){ __builtin_inff(), __builtin_inff(), -__builtin_inff(), -__builtin_inff() })
+
+static inline bool boundsOverlap(vec4 a, vec4 b) {
+	return a.x < b.z && b.x < a.z && a.y < b.w && b.y < a.w;
+}
+
+// after the frame's fence has been waited on and the frame arena reset; each stream takes its first chunk when it's
+// first written to
+static inline void streamsBeginFrame(void) {
+	ringBeginFrame(&frameRing);
+
+	vertices2DChunk = (struct RingChunk){ };
+	verticesTextChunk = (struct RingChunk){ };
+	vertices2DCount = 0;
+	verticesTextCount = 0;
+
+	batch2D.indices = NULL;
+	batch2D.indexCount = 0;
+	batch2D.indexCapacity = 0;
+	batch2D.commands = NULL;
+	batch2D.commandCount = 0;
+	batch2D.commandCapacity = 0;
+	batch2D.bounds = BOUNDS_2D_EMPTY;
+
+	batch2D.recorded = 0;
+	batch2D.draws = 0;
+	batch2D.flushTime = 0;
+	batch2D.flattened = 0;
+	batch2D.flattenTime = 0;
+}
+
+// records the commands waiting since the last flush, before anything that has to land on top of them or that moves a
+// stream to another chunk
+static inline void flush2D(void) {
+	if (!batch2D.commandCount)
+		return;
+
+	u64 start = platformClock();
+	u64 mark = frameArena.used;
+
+	struct Batch2D* batches = ARENA_ARRAY(&frameArena, struct Batch2D, batch2D.commandCount);
+	u32 batchCount = 0;
+
+	for (u32 i = 0; i < batch2D.commandCount; i++) {
+		struct Command2D* command = &batch2D.commands[i];
+		command->next = UINT32_MAX;
+
+		struct Batch2D* batch = NULL;
+		for (u32 j = batchCount; j-- > 0 && batchCount - j <= FLUSH_2D_LOOKBACK;) {
+			if (batches[j].pipeline == command->pipeline && batches[j].imageView == command->imageView) {
+				batch = &batches[j];
+				break;
+			}
+
+			if (boundsOverlap(batches[j].bounds, command->bounds))
+				break;
 		}
+
+		if (batch) {
+			batch2D.commands[batch->last].next = i;
+			batch->last = i;
+			batch->bounds.xy = __builtin_elementwise_min(batch->bounds.xy, command->bounds.xy);
+			batch->bounds.zw = __builtin_elementwise_max(batch->bounds.zw, command->bounds.zw);
+		} else
+			batches[batchCount++] = (struct Batch2D){
+				.bounds = command->bounds,
+				.first = i,
+				.last = i,
+				.pipeline = command->pipeline,
+				.imageView = command->imageView
+			};
 	}
-};
 
-static inline void setTransform(mat4 transform) {
-	mat4 m = viewport * transform;
-	vkCmdPushConstants(commandBuffer, pipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(mat4), &m);
+	// each batch's indices are copied out back to back, so it's one draw
+	struct RingChunk chunk = ringTake(&frameRing, batch2D.indexCount * sizeof(u16));
+	u16* indices = (u16*)chunk.data;
+	u32 indexCount = 0;
+
+	vkCmdBindIndexBuffer(commandBuffer, chunk.buffer, chunk.offset, VK_INDEX_TYPE_UINT16);
+
+	enum Pipelines bound = PIPELINE_MAX_ENUM;
+	for (u32 i = 0; i < batchCount; i++) {
+		u32 firstIndex = indexCount;
+
+		for (u32 c = batches[i].first; c != UINT32_MAX; c = batch2D.commands[c].next) {
+			__builtin_memcpy(indices + indexCount, batch2D.indices + batch2D.commands[c].firstIndex, batch2D.commands[c].indexCount * sizeof(u16));
+			indexCount += batch2D.commands[c].indexCount;
+		}
+
+		if (batches[i].pipeline != bound) {
+			bound = batches[i].pipeline;
+			vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelines[bound]);
+		}
+
+		// the image view reaches image2d as the instance index
+		vkCmdDrawIndexed(commandBuffer, indexCount - firstIndex, 1, firstIndex, 0, batches[i].imageView);
+	}
+
+	batch2D.recorded += batch2D.commandCount;
+	batch2D.draws += batchCount;
+
+	batch2D.indexCount = 0;
+	batch2D.commandCount = 0;
+	arenaRewind(&frameArena, mark);
+
+	batch2D.flushTime += platformClock() - start;
 }
 
-static inline void beginPath(void) {
-	path.subPaths[0].pointCount = 0;
-	path.subPaths[0].closed = false;
-	path.subPathCount = 1;
+// room for vertexCount more 2D vertices and indexCount more indices; running out of vertex chunk flushes and moves to a
+// fresh one, so indices are only good for the command being built
+static inline void reserve2D(u32 vertexCount, u32 indexCount) {
+	u32 capacity = __builtin_elementwise_min(vertices2DChunk.size / (u32)sizeof(struct Vertex2D), (u32)VERTICES_2D_MAX);
+
+	if (vertices2DCount + vertexCount > capacity) {
+		flush2D();
+
+		vertices2DChunk = ringTake(&frameRing, vertexCount * sizeof(struct Vertex2D));
+		vertices2D = (struct Vertex2D*)vertices2DChunk.data;
+		vertices2DCount = 0;
+
+		vkCmdBindVertexBuffers(commandBuffer, 0, 1, &vertices2DChunk.buffer, &vertices2DChunk.offset);
+	}
+
+	if (batch2D.indexCount + indexCount > batch2D.indexCapacity) {
+		u32 grown = __builtin_elementwise_max(batch2D.indexCapacity * 2, batch2D.indexCount + indexCount);
+		batch2D.indices = arenaGrow(&frameArena, batch2D.indices, sizeof(u16) * batch2D.indexCapacity, sizeof(u16) * grown, _Alignof(u16));
+		batch2D.indexCapacity = grown;
+	}
 }
 
-static inline void bezierCurveTo(float c1x, float c1y, float c2x, float c2y, float x, float y) {
-	struct SubPath2D* p = &path.subPaths[path.subPathCount - 1];
+static inline void reserveText(u32 vertexCount, u32 indexCount) {
+	u32 capacity = __builtin_elementwise_min(verticesTextChunk.size / (u32)sizeof(struct VertexText), (u32)VERTICES_2D_MAX);
+
+	if (verticesTextCount + vertexCount > capacity) {
+		flush2D();
+
+		verticesTextChunk = ringTake(&frameRing, vertexCount * sizeof(struct VertexText));
+		verticesText = (struct VertexText*)verticesTextChunk.data;
+		verticesTextCount = 0;
+
+		vkCmdBindVertexBuffers(commandBuffer, 1, 1, &verticesTextChunk.buffer, &verticesTextChunk.offset);
+	}
+
+	reserve2D(0, indexCount);
+}
+
+static inline void setTransform(mat4 transform) {
+	batch2D.transform = viewport * transform;
+	batch2D.scale = __builtin_fmaxf(vec2Length((vec2){ transform[0][0], transform[1][0] }), vec2Length((vec2){ transform[0][1], transform[1][1] }));
+}
+
+static inline vec2 transform2D(vec2 point) {
+	vec2 p = vec4TransformMat4((vec4){ point.x, point.y, 0.f, 1.f }, batch2D.transform).xy;
 
-	vec2 start = p->points[p->pointCount - 1];
+	batch2D.bounds.xy = __builtin_elementwise_min(batch2D.bounds.xy, p);
+	batch2D.bounds.zw = __builtin_elementwise_max(batch2D.bounds.zw, p);
 
-	u32 steps = 32;
-	for (u32 i = 1; i <= steps; i++) {
-		float t = (float)i / (float)steps;
-		float u = 1.0f - t;
+	return p;
+}
+
+static inline void vertex2D(vec2 point, u8vec4 color) {
+	vertices2D[vertices2DCount++] = (struct Vertex2D){ transform2D(point), color };
+}
 
-		p->points[p->pointCount++] = (vec2){
-			u * u * u * start.x + 3 * u * u * t * c1x + 3 * u * t * t * c2x + t * t * t * x,
-			u * u * u * start.y + 3 * u * u * t * c1y + 3 * u * t * t * c2y + t * t * t * y
+static inline void index2D(u16 index) {
+	batch2D.indices[batch2D.indexCount++] = index;
+}
+
+// queues the indices written since firstIndex as one command
+static inline void command2D(enum Pipelines pipeline, u16 imageView, u32 firstIndex) {
+	if (batch2D.indexCount > firstIndex) {
+		ARENA_RESERVE(&frameArena, batch2D.commands, batch2D.commandCount, batch2D.commandCapacity);
+
+		batch2D.commands[batch2D.commandCount++] = (struct Command2D){
+			.bounds = batch2D.bounds,
+			.firstIndex = firstIndex,
+			.indexCount = batch2D.indexCount - firstIndex,
+			.pipeline = pipeline,
+			.imageView = imageView
 		};
 	}
+
+	batch2D.bounds = BOUNDS_2D_EMPTY;
+}
+
+// the last subpath if nothing has been added to it yet, otherwise a new one
+static inline struct SubPath2D* pathSubPath(void) {
+	if (path.subPathCount && !path.subPaths[path.subPathCount - 1].pointCount)
+		return &path.subPaths[path.subPathCount - 1];
+
+	ARENA_RESERVE(&frameArena, path.subPaths, path.subPathCount, path.subPathCapacity);
+
+	struct SubPath2D* p = &path.subPaths[path.subPathCount++];
+	*p = (struct SubPath2D){ .firstPoint = path.pointCount };
+
+	return p;
+}
+
+static inline void pathPoint(vec2 point) {
+	ARENA_RESERVE(&frameArena, path.points, path.pointCount, path.pointCapacity);
+
+	path.points[path.pointCount++] = point;
+	path.subPaths[path.subPathCount - 1].pointCount++;
+}
+
+static inline void beginPath(void) {
+	path.pointCount = 0;
+	path.subPathCount = 0;
+	pathSubPath();
+}
+
+// how far a flattened curve may stray in path units, so it's PATH_2D_TOLERANCE pixels however the path is scaled
+static inline float pathTolerance(void) {
+	return PATH_2D_TOLERANCE / __builtin_fmaxf(batch2D.scale, 1e-6f);
+}
+
+// Wang's formula: a cubic cut into n even steps in t strays at most 3 / 4 * M / n^2 from its chords, where M is the
+// larger of its two second differences; the points then come from forward differences, three adds each
+static inline void bezierCurveTo(float c1x, float c1y, float c2x, float c2y, float x, float y) {
+	u64 start = platformClock();
+
+	vec2 p0 = path.points[path.pointCount - 1];
+	vec2 p1 = { c1x, c1y };
+	vec2 p2 = { c2x, c2y };
+	vec2 p3 = { x, y };
+
+	float m = __builtin_fmaxf(vec2Length(p0 - 2.f * p1 + p2), vec2Length(p1 - 2.f * p2 + p3));
+	u32 steps = (u32)__builtin_ceilf(__builtin_sqrtf(0.75f * m / pathTolerance()));
+	steps = __builtin_elementwise_min(__builtin_elementwise_max(steps, 1u), (u32)PATH_2D_MAX_STEPS);
+
+	float h = 1.f / (float)steps;
+	vec2 a = -p0 + 3.f * p1 - 3.f * p2 + p3;
+	vec2 b = 3.f * p0 - 6.f * p1 + 3.f * p2;
+	vec2 c = -3.f * p0 + 3.f * p1;
+
+	vec2 point = p0;
+	vec2 d1 = a * (h * h * h) + b * (h * h) + c * h;
+	vec2 d3 = 6.f * a * (h * h * h);
+	vec2 d2 = d3 + 2.f * b * (h * h);
+
+	for (u32 i = 1; i < steps; i++) {
+		point += d1;
+		d1 += d2;
+		d2 += d3;
+		pathPoint(point);
+	}
+
+	// the end exactly, whatever rounding the differences picked up
+	pathPoint(p3);
+
+	batch2D.flattened += steps;
+	batch2D.flattenTime += platformClock() - start;
 }
 
 static inline void closePath(void) {
@@ -80,143 +371,541 @@ static inline void closePath(void) {
 }
 
 static inline void moveTo(float x, float y) {
-	struct SubPath2D* p;
-
-	if (path.subPaths[path.subPathCount - 1].pointCount == 0)
-		p = &path.subPaths[path.subPathCount - 1];
-	else
-		p = &path.subPaths[path.subPathCount++];
-
-	p->pointCount = 1;
+	struct SubPath2D* p = pathSubPath();
 	p->closed = false;
-	p->points[0] = (vec2){ x, y };
+
+	pathPoint((vec2){ x, y });
 }
 
 static inline void lineTo(float x, float y) {
-	struct SubPath2D* p = &path.subPaths[path.subPathCount - 1];
-	p->points[p->pointCount++] = (vec2){ x, y };
+	pathPoint((vec2){ x, y });
 }
 
+// each step is as wide as a chord can be while its middle stays within tolerance of the circle, and the points come
+// from rotating the last one by that step rather than a cosine and sine apiece
 static inline void arc(float x, float y, float radius, float start, float end) {
-	struct SubPath2D* p;
+	u64 clock = platformClock();
+
+	struct SubPath2D* p = pathSubPath();
+	p->closed = true;
+
+	float sweep = end - start;
+	bool full = __builtin_fabsf(sweep) >= 2.f * M_PI;
+	if (full)
+		sweep = sweep < 0.f ? -2.f * M_PI : 2.f * M_PI;
+
+	float widest = 2.f * __builtin_acosf(fclampf(1.f - pathTolerance() / radius, -1.f, 1.f));
+	u32 steps = (u32)__builtin_ceilf(__builtin_fabsf(sweep) / __builtin_fmaxf(widest, 1e-6f));
+	steps = __builtin_elementwise_min(__builtin_elementwise_max(steps, full ? 3u : 1u), (u32)PATH_2D_MAX_STEPS);
 
-	if (path.subPaths[path.subPathCount - 1].pointCount == 0)
-		p = &path.subPaths[path.subPathCount - 1];
-	else {
-		p = &path.subPaths[path.subPathCount++];
-		p->pointCount = 0;
+	float stepAngle = sweep / (float)steps;
+	float c = __builtin_cosf(stepAngle);
+	float s = __builtin_sinf(stepAngle);
+
+	// a full circle ends where it starts, so that point is left to closing the subpath
+	vec2 offset = { radius * __builtin_cosf(start), radius * __builtin_sinf(start) };
+	u32 count = full ? steps : steps + 1;
+
+	for (u32 i = 0; i < count; i++) {
+		pathPoint((vec2){ x, y } + offset);
+		offset = (vec2){ offset.x * c - offset.y * s, offset.x * s + offset.y * c };
 	}
 
+	batch2D.flattened += count;
+	batch2D.flattenTime += platformClock() - clock;
+}
+
+static inline void rect(float x, float y, float width, float height) {
+	struct SubPath2D* p = pathSubPath();
 	p->closed = true;
 
-	// TODO: fix the calculation to be more efficient
-	u32 steps = (u32)__builtin_fminf(256.f, ((end - start) * radius / M_PI));
+	pathPoint((vec2){ x, y });
+	pathPoint((vec2){ x + width, y });
+	pathPoint((vec2){ x + width, y + height });
+	pathPoint((vec2){ x, y + height });
+}
+
+// fills that aren't a single convex subpath are tessellated once and kept in path units, cached on a hash of their
+// points and fill rule, so the same shape under any transform only pays for copying its triangles out each frame
+#define PATH_CACHE_FILLS 256 // power of two, dropped when three quarters full
+#define PATH_CACHE_VERTICES VERTICES_2D_MAX // the most one tessellation may have, so any fits once the cache is emptied
+#define PATH_CACHE_INDICES (VERTICES_2D_MAX / 4 * 6)
+
+struct PathFill {
+	u64 hash; // zero when the slot is empty
+	u32 pointCount;
+	u32 subPathCount;
+	u32 firstVertex;
+	u32 vertexCount;
+	u32 firstIndex;
+	u32 indexCount;
+};
+
+// open addressing with linear probing like textCache, matched on the hash rather than the points themselves
+static struct {
+	struct PathFill fills[PATH_CACHE_FILLS];
+	vec2 vertices[PATH_CACHE_VERTICES];
+	u16 indices[PATH_CACHE_INDICES]; // from the fill's first vertex
+	u32 fillCount;
+	u32 vertexCount;
+	u32 indexCount;
+
+	u32 hits;
+	u32 misses;
+} pathCache;
+
+struct Edge2D {
+	vec2 top, bottom; // top has the smaller y
+	float slope; // dx / dy
+	i32 winding; // 1 where the subpath runs down, -1 up
+
+	// the edge closing the span this one opens on the left in the current band and in the trapezoid still open, and
+	// where that trapezoid started
+	u32 pairing;
+	u32 partner;
+	float spanTop;
+};
+
+struct Trapezoid2D {
+	u32 left, right; // edges
+	float top, bottom;
+};
+
+struct PathMesh2D {
+	vec2* vertices;
+	u16* indices;
+	u32 vertexCount;
+	u32 indexCount;
+};
+
+static inline float edgeX(const struct Edge2D* edge, float y) {
+	return edge->top.x + (y - edge->top.y) * edge->slope;
+}
+
+// orders floats like their bits as unsigned integers
+static inline u32 pathSortableFloat(float f) {
+	u32 bits;
+	__builtin_memcpy(&bits, &f, sizeof(float));
+
+	return bits & 0x80000000u ? ~bits : bits | 0x80000000u;
+}
 
-	float stepAngle = (end - start) / (float)steps;
+// in-place heapsort, callers pack the sort key into the high half
+static inline void pathSortKeys(u64* keys, u32 count) {
+	for (u32 end = count, start = count / 2; end > 1;) {
+		if (start > 0)
+			start--;
+		else {
+			end--;
+			u64 top = keys[0];
+			keys[0] = keys[end];
+			keys[end] = top;
+		}
 
-	for (u32 i = 0; i < steps; i++) {
-		float angle = normalizeAngle(start + (float)i * stepAngle);
-		float px = x + radius * __builtin_cosf(angle);
-		float py = y + radius * __builtin_sinf(angle);
-		p->points[p->pointCount++] = (vec2){ px, py };
+		for (u32 root = start, child; (child = root * 2 + 1) < end; root = child) {
+			if (child + 1 < end && keys[child + 1] > keys[child])
+				child++;
+
+			if (keys[root] >= keys[child])
+				break;
+
+			u64 swap = keys[root];
+			keys[root] = keys[child];
+			keys[child] = swap;
+		}
 	}
 }
 
-static inline void rect(float x, float y, float width, float height) {
-	struct SubPath2D* p;
+static inline u64 pathHash(enum FillRule rule) {
+	u64 h = 14695981039346656037ull ^ rule;
 
-	if (path.subPaths[path.subPathCount - 1].pointCount == 0)
-		p = &path.subPaths[path.subPathCount - 1];
-	else
-		p = &path.subPaths[path.subPathCount++];
+	for (u32 i = 0; i < path.subPathCount; i++)
+		h = (h ^ path.subPaths[i].pointCount) * 1099511628211ull;
 
-	p->closed = true;
+	for (u32 i = 0; i < path.pointCount; i++) {
+		u64 bits;
+		__builtin_memcpy(&bits, &path.points[i], sizeof(vec2));
+		h = (h ^ bits) * 1099511628211ull;
+		h ^= h >> 32;
+	}
 
-	p->points[0] = (vec2){ x, y };
-	p->points[1] = (vec2){ x + width, y };
-	p->points[2] = (vec2){ x + width, y + height };
-	p->points[3] = (vec2){ x, y + height };
-	p->pointCount = 4;
+	return h ? h : 1;
 }
 
-static inline void fill(u8vec4 color) {
-	u32 firstIndex = indices2DCount;
-	i32 vertexOffset = (i32)vertices2DCount;
+// a sweep down the y axis over every subpath, each closed back to its start: between consecutive vertex heights, cut
+// again wherever two edges cross, no edge starts, ends or crosses another, so counting winding left to right across
+// such a band finds the spans inside it. A span that carries on between the same two edges into the next band stays
+// one trapezoid, so a convex run of a shape costs one however many vertices its sides have. In the frame arena.
+static inline struct PathMesh2D pathTessellate(enum FillRule rule) {
+	struct Edge2D* unsorted = ARENA_ARRAY(&frameArena, struct Edge2D, path.pointCount);
+	u32 edgeCount = 0;
 
-	u16 firstVertexIndex = 0;
 	for (u32 i = 0; i < path.subPathCount; i++) {
 		struct SubPath2D* p = &path.subPaths[i];
+		if (p->pointCount < 3)
+			continue;
+
+		vec2* points = &path.points[p->firstPoint];
+		for (u32 j = 0; j < p->pointCount; j++) {
+			vec2 a = points[j];
+			vec2 b = points[j + 1 < p->pointCount ? j + 1 : 0];
+
+			// horizontal edges bound no band
+			if (a.y == b.y)
+				continue;
+
+			bool down = a.y < b.y;
+			vec2 top = down ? a : b;
+			vec2 bottom = down ? b : a;
+
+			unsorted[edgeCount++] = (struct Edge2D){
+				.top = top,
+				.bottom = bottom,
+				.slope = (bottom.x - top.x) / (bottom.y - top.y),
+				.winding = down ? 1 : -1,
+				.pairing = UINT32_MAX,
+				.partner = UINT32_MAX
+			};
+		}
+	}
 
-		for (u16 j = 0; j < p->pointCount; j++) {
-			vertices2D[vertices2DCount++] = p->points[j];
+	// edges by where they start, then every height one starts or ends at
+	u64* keys = ARENA_ARRAY(&frameArena, u64, 2 * edgeCount);
+	for (u32 i = 0; i < edgeCount; i++)
+		keys[i] = (u64)pathSortableFloat(unsorted[i].top.y) << 32 | i;
 
-			if (j >= 2) {
-				indices2D[indices2DCount++] = firstVertexIndex;
-				indices2D[indices2DCount++] = firstVertexIndex + j - 1;
-				indices2D[indices2DCount++] = firstVertexIndex + j;
+	pathSortKeys(keys, edgeCount);
+
+	struct Edge2D* edges = ARENA_ARRAY(&frameArena, struct Edge2D, edgeCount);
+	for (u32 i = 0; i < edgeCount; i++)
+		edges[i] = unsorted[(u32)keys[i]];
+
+	for (u32 i = 0; i < edgeCount; i++) {
+		keys[2 * i] = (u64)pathSortableFloat(edges[i].top.y) << 32;
+		keys[2 * i + 1] = (u64)pathSortableFloat(edges[i].bottom.y) << 32;
+	}
+
+	pathSortKeys(keys, 2 * edgeCount);
+
+	float* ys = ARENA_ARRAY(&frameArena, float, 2 * edgeCount);
+	u32 yCount = 0;
+	for (u32 i = 0; i < 2 * edgeCount; i++) {
+		if (i && keys[i] == keys[i - 1])
+			continue;
+
+		u32 bits = (u32)(keys[i] >> 32);
+		bits = bits & 0x80000000u ? bits & 0x7fffffffu : ~bits;
+		__builtin_memcpy(&ys[yCount++], &bits, sizeof(float));
+	}
+
+	u32* active = ARENA_ARRAY(&frameArena, u32, edgeCount);
+	u32 activeCount = 0;
+	u32 nextEdge = 0;
+
+	// last, so it grows in place
+	struct Trapezoid2D* trapezoids = NULL;
+	u32 trapezoidCount = 0;
+	u32 trapezoidCapacity = 0;
+
+	// crossings nearer a band's ends than this are where edges meet rather than cross
+	float epsilon = pathTolerance() * 1e-3f;
+
+	float y0 = yCount ? ys[0] : 0.f;
+	for (u32 k = 1; k <= yCount;) {
+		// edges ending here close the trapezoids they open
+		u32 kept = 0;
+		for (u32 i = 0; i < activeCount; i++) {
+			struct Edge2D* e = &edges[active[i]];
+
+			if (e->bottom.y > y0)
+				active[kept++] = active[i];
+			else if (e->partner != UINT32_MAX && e->spanTop < y0) {
+				ARENA_RESERVE(&frameArena, trapezoids, trapezoidCount, trapezoidCapacity);
+				trapezoids[trapezoidCount++] = (struct Trapezoid2D){ active[i], e->partner, e->spanTop, y0 };
+			}
+		}
+
+		activeCount = kept;
+
+		if (k == yCount)
+			break;
+
+		while (nextEdge < edgeCount && edges[nextEdge].top.y <= y0)
+			active[activeCount++] = nextEdge++;
+
+		// ordered across the middle of the band, which ends early at the first crossing; insertion sort since the order
+		// barely changes between bands
+		float y1 = ys[k];
+		for (bool crossed = true; crossed;) {
+			crossed = false;
+			float middle = 0.5f * (y0 + y1);
+
+			for (u32 i = 1; i < activeCount; i++) {
+				u32 e = active[i];
+				float x = edgeX(&edges[e], middle);
+
+				u32 j = i;
+				for (; j > 0 && edgeX(&edges[active[j - 1]], middle) > x; j--)
+					active[j] = active[j - 1];
+
+				active[j] = e;
+			}
+
+			for (u32 i = 1; i < activeCount; i++) {
+				struct Edge2D* a = &edges[active[i - 1]];
+				struct Edge2D* b = &edges[active[i]];
+
+				float d0 = edgeX(b, y0) - edgeX(a, y0);
+				float d1 = edgeX(b, y1) - edgeX(a, y1);
+				if ((d0 >= 0.f && d1 >= 0.f) || d0 == d1)
+					continue;
+
+				float y = y0 + (y1 - y0) * d0 / (d0 - d1);
+				if (y > y0 + epsilon && y < y1 - epsilon) {
+					y1 = y;
+					crossed = true;
+				}
+			}
+		}
+
+		i32 winding = 0;
+		u32 left = UINT32_MAX;
+		for (u32 i = 0; i < activeCount; i++) {
+			struct Edge2D* e = &edges[active[i]];
+			e->pairing = UINT32_MAX;
+
+			bool wasInside = rule == FILL_RULE_NONZERO ? winding != 0 : winding & 1;
+			winding += e->winding;
+			bool inside = rule == FILL_RULE_NONZERO ? winding != 0 : winding & 1;
+
+			if (!wasInside && inside)
+				left = active[i];
+			else if (wasInside && !inside)
+				edges[left].pairing = active[i];
+		}
+
+		for (u32 i = 0; i < activeCount; i++) {
+			struct Edge2D* e = &edges[active[i]];
+			if (e->pairing == e->partner)
+				continue;
+
+			if (e->partner != UINT32_MAX && e->spanTop < y0) {
+				ARENA_RESERVE(&frameArena, trapezoids, trapezoidCount, trapezoidCapacity);
+				trapezoids[trapezoidCount++] = (struct Trapezoid2D){ active[i], e->partner, e->spanTop, y0 };
 			}
+
+			e->partner = e->pairing;
+			e->spanTop = y0;
 		}
 
-		firstVertexIndex += p->pointCount;
+		if (y1 == ys[k])
+			k++;
+
+		y0 = y1;
 	}
 
-	vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelines[PIPELINE_PATH2D]);
-	vkCmdBindIndexBuffer(commandBuffer, buffers[BUFFER_FRAME].handle, BUFFER_OFFSET_INDICES_2D + frame * BUFFER_RANGE_INDICES_2D, VK_INDEX_TYPE_UINT16);
+	// anything past what 16 bit indices reach is dropped
+	trapezoidCount = __builtin_elementwise_min(trapezoidCount, (u32)VERTICES_2D_MAX / 4);
+
+	struct PathMesh2D mesh = {
+		.vertices = ARENA_ARRAY(&frameArena, vec2, 4 * trapezoidCount),
+		.indices = ARENA_ARRAY(&frameArena, u16, 6 * trapezoidCount)
+	};
+
+	for (u32 i = 0; i < trapezoidCount; i++) {
+		struct Trapezoid2D* t = &trapezoids[i];
+		u16 first = (u16)mesh.vertexCount;
+
+		mesh.vertices[mesh.vertexCount++] = (vec2){ edgeX(&edges[t->left], t->top), t->top };
+		mesh.vertices[mesh.vertexCount++] = (vec2){ edgeX(&edges[t->right], t->top), t->top };
+		mesh.vertices[mesh.vertexCount++] = (vec2){ edgeX(&edges[t->right], t->bottom), t->bottom };
+		mesh.vertices[mesh.vertexCount++] = (vec2){ edgeX(&edges[t->left], t->bottom), t->bottom };
+
+		mesh.indices[mesh.indexCount++] = first;
+		mesh.indices[mesh.indexCount++] = first + 1;
+		mesh.indices[mesh.indexCount++] = first + 2;
+		mesh.indices[mesh.indexCount++] = first;
+		mesh.indices[mesh.indexCount++] = first + 2;
+		mesh.indices[mesh.indexCount++] = first + 3;
+	}
 
-	vec4 col = (vec4){ color.x, color.y, color.z, color.w } / 255.f;
-	vkCmdPushConstants(commandBuffer, pipelineLayout, VK_SHADER_STAGE_FRAGMENT_BIT, 96, sizeof(vec4), &col);
-	vkCmdDrawIndexed(commandBuffer, indices2DCount - firstIndex, 1, firstIndex, vertexOffset, 0);
+	return mesh;
 }
 
-static inline void clip(void) {
-	u32 firstIndex = indices2DCount;
-	i32 vertexOffset = (i32)vertices2DCount;
+// the current path's tessellation, good until the next call
+static inline const struct PathFill* pathCacheFill(enum FillRule rule) {
+	u64 hash = pathHash(rule);
 
-	u16 firstVertexIndex = 0;
-	for (u32 i = 0; i < path.subPathCount; i++) {
-		struct SubPath2D* p = &path.subPaths[i];
+	u32 slot = (u32)hash & (PATH_CACHE_FILLS - 1);
+	for (;; slot = (slot + 1) & (PATH_CACHE_FILLS - 1)) {
+		struct PathFill* fill = &pathCache.fills[slot];
+		if (!fill->hash)
+			break;
+
+		if (fill->hash == hash && fill->pointCount == path.pointCount && fill->subPathCount == path.subPathCount) {
+			pathCache.hits++;
+			return fill;
+		}
+	}
+
+	pathCache.misses++;
+
+	u64 mark = frameArena.used;
+	struct PathMesh2D mesh = pathTessellate(rule);
+
+	if (4 * (pathCache.fillCount + 1) > 3 * PATH_CACHE_FILLS || pathCache.vertexCount + mesh.vertexCount > PATH_CACHE_VERTICES || pathCache.indexCount + mesh.indexCount > PATH_CACHE_INDICES) {
+		__builtin_memset(pathCache.fills, 0, sizeof(pathCache.fills));
+		pathCache.fillCount = 0;
+		pathCache.vertexCount = 0;
+		pathCache.indexCount = 0;
+
+		slot = (u32)hash & (PATH_CACHE_FILLS - 1);
+	}
+
+	struct PathFill* fill = &pathCache.fills[slot];
+	*fill = (struct PathFill){
+		.hash = hash,
+		.pointCount = path.pointCount,
+		.subPathCount = path.subPathCount,
+		.firstVertex = pathCache.vertexCount,
+		.vertexCount = mesh.vertexCount,
+		.firstIndex = pathCache.indexCount,
+		.indexCount = mesh.indexCount
+	};
+
+	__builtin_memcpy(pathCache.vertices + fill->firstVertex, mesh.vertices, mesh.vertexCount * sizeof(vec2));
+	__builtin_memcpy(pathCache.indices + fill->firstIndex, mesh.indices, mesh.indexCount * sizeof(u16));
+	pathCache.vertexCount += mesh.vertexCount;
+	pathCache.indexCount += mesh.indexCount;
+	pathCache.fillCount++;
+
+	arenaRewind(&frameArena, mark);
+
+	return fill;
+}
+
+// turns one way all round and its edges go left and right, and up and down, only once each, so it doesn't cross itself
+static inline bool pathConvex(const vec2* points, u32 count) {
+	float turn = 0.f;
+	i32 first[2] = { }, last[2] = { };
+	u32 flips[2] = { };
+
+	for (u32 i = 0; i < count; i++) {
+		vec2 a = points[i + 1 < count ? i + 1 : 0] - points[i];
+		vec2 b = points[i + 2 < count ? i + 2 : i + 2 - count] - points[i + 1 < count ? i + 1 : 0];
+
+		float cross = a.x * b.y - a.y * b.x;
+		if (cross != 0.f) {
+			if (turn * cross < 0.f)
+				return false;
+
+			turn = cross;
+		}
+
+		for (u32 axis = 0; axis < 2; axis++) {
+			i32 sign = (a[axis] > 0.f) - (a[axis] < 0.f);
+			if (!sign)
+				continue;
+
+			if (last[axis] && sign != last[axis])
+				flips[axis]++;
 
-		for (u16 j = 0; j < p->pointCount; j++) {
-			vertices2D[vertices2DCount++] = p->points[j];
+			if (!first[axis])
+				first[axis] = sign;
+
+			last[axis] = sign;
+		}
+	}
+
+	for (u32 axis = 0; axis < 2; axis++)
+		if (last[axis] != first[axis])
+			flips[axis]++;
+
+	return flips[0] <= 2 && flips[1] <= 2;
+}
+
+// fill and clip: a lone convex subpath is a fan from its first point under either rule, anything else comes from
+// pathCache
+static inline void pathFill(enum Pipelines pipeline, u8vec4 color, enum FillRule rule) {
+	struct SubPath2D* only = NULL;
+	u32 shapes = 0;
+	for (u32 i = 0; i < path.subPathCount; i++)
+		if (path.subPaths[i].pointCount >= 3) {
+			only = &path.subPaths[i];
+			shapes++;
+		}
+
+	if (!shapes)
+		return;
+
+	if (shapes == 1 && pathConvex(&path.points[only->firstPoint], only->pointCount)) {
+		reserve2D(only->pointCount, 3 * (only->pointCount - 2));
+
+		u32 firstIndex = batch2D.indexCount;
+		vec2* points = &path.points[only->firstPoint];
+		u16 firstVertexIndex = (u16)vertices2DCount;
+
+		for (u16 j = 0; j < only->pointCount; j++) {
+			vertex2D(points[j], color);
 
 			if (j >= 2) {
-				indices2D[indices2DCount++] = firstVertexIndex;
-				indices2D[indices2DCount++] = firstVertexIndex + j - 1;
-				indices2D[indices2DCount++] = firstVertexIndex + j;
+				index2D(firstVertexIndex);
+				index2D(firstVertexIndex + j - 1);
+				index2D(firstVertexIndex + j);
 			}
 		}
 
-		firstVertexIndex += p->pointCount;
+		command2D(pipeline, 0, firstIndex);
+		return;
 	}
 
-	vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelines[PIPELINE_PATH2D_CLIP]);
-	vkCmdBindIndexBuffer(commandBuffer, buffers[BUFFER_FRAME].handle, BUFFER_OFFSET_INDICES_2D + frame * BUFFER_RANGE_INDICES_2D, VK_INDEX_TYPE_UINT16);
-	vkCmdDrawIndexed(commandBuffer, indices2DCount - firstIndex, 1, firstIndex, vertexOffset, 0);
+	const struct PathFill* cached = pathCacheFill(rule);
+	reserve2D(cached->vertexCount, cached->indexCount);
+
+	u32 firstIndex = batch2D.indexCount;
+	u16 firstVertexIndex = (u16)vertices2DCount;
+
+	for (u32 i = 0; i < cached->vertexCount; i++)
+		vertex2D(pathCache.vertices[cached->firstVertex + i], color);
+
+	for (u32 i = 0; i < cached->indexCount; i++)
+		index2D(firstVertexIndex + pathCache.indices[cached->firstIndex + i]);
+
+	command2D(pipeline, 0, firstIndex);
+}
+
+static inline void fill(u8vec4 color, enum FillRule rule) {
+	pathFill(PIPELINE_PATH2D, color, rule);
+}
+
+static inline void clip(enum FillRule rule) {
+	pathFill(PIPELINE_PATH2D_CLIP, (u8vec4){ }, rule);
 }
 
 static inline void stroke(u8vec4 color, float lineWidth, enum LineJoin join, enum LineCap cap) {
-	u32 firstIndex = indices2DCount;
-	i32 vertexOffset = (i32)vertices2DCount;
+	reserve2D(2 * path.pointCount, 6 * path.pointCount);
+
+	u32 firstIndex = batch2D.indexCount;
 
 	switch (join) {
 		case LINE_JOIN_MITER: {
-			u16 first = 0;
-
 			for (u32 i = 0; i < path.subPathCount; i++) {
 				struct SubPath2D* p = &path.subPaths[i];
+				vec2* points = &path.points[p->firstPoint];
+				u16 first = (u16)vertices2DCount;
 
 				for (u16 j = 0; j < p->pointCount; j++) {
-					vec2 current = p->points[j];
+					vec2 current = points[j];
 					vec2 previous, next;
 					vec2 edge1, edge2;
 
 					if (j != 0 || p->closed) {
-						previous = p->points[(j == 0) ? p->pointCount - 1 : j - 1];
+						previous = points[(j == 0) ? p->pointCount - 1 : j - 1];
 						edge1 = vec2Normalize(previous - current);
 					}
 
 					if (j != p->pointCount - 1 || p->closed) {
-						next = p->points[(j == p->pointCount - 1) ? 0 : j + 1];
+						next = points[(j == p->pointCount - 1) ? 0 : j + 1];
 						edge2 = vec2Normalize(next - current);
 					}
 
@@ -230,8 +919,8 @@ static inline void stroke(u8vec4 color, float lineWidth, enum LineJoin join, enu
 						miter /= vec2Cross(edge1, miter);
 					}
 
-					vertices2D[vertices2DCount++] = current + (miter * lineWidth * 0.5f);
-					vertices2D[vertices2DCount++] = current - (miter * lineWidth * 0.5f);
+					vertex2D(current + (miter * lineWidth * 0.5f), color);
+					vertex2D(current - (miter * lineWidth * 0.5f), color);
 
 					if (j == 0 || p->closed || j < p->pointCount - 1) {
 						u16 i0 = first + (j * 2);
@@ -246,16 +935,14 @@ static inline void stroke(u8vec4 color, float lineWidth, enum LineJoin join, enu
 							i3 = first + (j * 2) + 3;
 						}
 
-						indices2D[indices2DCount++] = i0;
-						indices2D[indices2DCount++] = i1;
-						indices2D[indices2DCount++] = i2;
-						indices2D[indices2DCount++] = i2;
-						indices2D[indices2DCount++] = i1;
-						indices2D[indices2DCount++] = i3;
+						index2D(i0);
+						index2D(i1);
+						index2D(i2);
+						index2D(i2);
+						index2D(i1);
+						index2D(i3);
 					}
 				}
-
-				first = (u16)(vertices2DCount - (u32)vertexOffset);
 			}
 		} break;
 		case LINE_JOIN_ROUND: {
@@ -263,26 +950,30 @@ static inline void stroke(u8vec4 color, float lineWidth, enum LineJoin join, enu
 		} break;
 	}
 
-	vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelines[PIPELINE_PATH2D]);
-	vkCmdBindIndexBuffer(commandBuffer, buffers[BUFFER_FRAME].handle, BUFFER_OFFSET_INDICES_2D + frame * BUFFER_RANGE_INDICES_2D, VK_INDEX_TYPE_UINT16);
-
-	vec4 col = (vec4){ color.x, color.y, color.z , color.w } / 255.f;
-	vkCmdPushConstants(commandBuffer, pipelineLayout, VK_SHADER_STAGE_FRAGMENT_BIT, 96, sizeof(vec4), &col);
-	vkCmdDrawIndexed(commandBuffer, indices2DCount - firstIndex, 1, firstIndex, vertexOffset, 0);
+	command2D(PIPELINE_PATH2D, 0, firstIndex);
 }
 
+// image2d takes its texture coordinates from the vertex index, so every quad starts on a multiple of four
 static inline void drawImage(enum ImageViews imageView, float x, float y, float w, float h) {
+	reserve2D(4 + 3, 6);
+
 	while (vertices2DCount % 4 != 0)
 		vertices2DCount++;
 
-	i32 vertexOffset = (i32)vertices2DCount;
+	u32 firstIndex = batch2D.indexCount;
+	u16 first = (u16)vertices2DCount;
+
+	vertex2D((vec2){ x, y }, (u8vec4){ });
+	vertex2D((vec2){ x + w, y }, (u8vec4){ });
+	vertex2D((vec2){ x, y + h }, (u8vec4){ });
+	vertex2D((vec2){ x + w, y + h }, (u8vec4){ });
 
-	vertices2D[vertices2DCount++] = (vec2){ x, y };
-	vertices2D[vertices2DCount++] = (vec2){ x + w, y };
-	vertices2D[vertices2DCount++] = (vec2){ x, y + h };
-	vertices2D[vertices2DCount++] = (vec2){ x + w, y + h };
+	index2D(first + 0);
+	index2D(first + 1);
+	index2D(first + 2);
+	index2D(first + 2);
+	index2D(first + 1);
+	index2D(first + 3);
 
-	vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelines[PIPELINE_IMAGE2D]);
-	vkCmdBindIndexBuffer(commandBuffer, buffers[BUFFER_DEVICE].handle, 0, VK_INDEX_TYPE_UINT16);
-	vkCmdDrawIndexed(commandBuffer, 6, 1, BUFFER_OFFSET_QUAD_INDICES / sizeof(u16), vertexOffset, imageView);
+	command2D(PIPELINE_IMAGE2D, imageView, firstIndex);
 }
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "platform.h"
+
+// bump allocators for scratch that lives until the next reset: address space is reserved up front and committed as the
+// arena first reaches it, so what fits scales with what's drawn instead of with a guess baked into an array size
+#define ARENA_COMMIT_STEP (64 * 1024)
+
+struct Arena {
+	u8* base;
+	u64 used;
+	u64 committed;
+	u64 reserved;
+	u64 highWater; // most ever used between resets
+};
+
+// render thread, reset at the start of every frame
+static struct Arena frameArena;
+
+// simulation thread, reset at the start of every tick
+static struct Arena tickArena;
+
+static inline void arenaInit(struct Arena* arena, u64 reserve) {
+	*arena = (struct Arena){
+		.base = platformMemoryReserve(reserve),
+		.reserved = reserve
+	};
+}
+
+static inline void* arenaAlloc(struct Arena* arena, u64 size, u64 align) {
+	u64 offset = (arena->used + align - 1) & ~(align - 1);
+
+	if (offset + size > arena->reserved)
+		platformOutOfMemory("arenaAlloc");
+
+	if (offset + size > arena->committed) {
+		u64 committed = (offset + size + ARENA_COMMIT_STEP - 1) & ~(u64)(ARENA_COMMIT_STEP - 1);
+		committed = __builtin_elementwise_min(committed, arena->reserved);
+
+		platformMemoryCommit(arena->base + arena->committed, committed - arena->committed);
+		arena->committed = committed;
+	}
+
+	arena->used = offset + size;
+	arena->highWater = __builtin_elementwise_max(arena->highWater, arena->used);
+
+	return arena->base + offset;
+}
+
+// resizes an allocation, in place when nothing was allocated after it
+static inline void* arenaGrow(struct Arena* arena, void* data, u64 size, u64 newSize, u64 align) {
+	if (data && (u8*)data + size == arena->base + arena->used) {
+		u64 offset = (u64)((u8*)data - arena->base);
+		arena->used = offset;
+		return arenaAlloc(arena, newSize, 1);
+	}
+
+	void* grown = arenaAlloc(arena, newSize, align);
+	if (data)
+		__builtin_memcpy(grown, data, size);
+
+	return grown;
+}
+
+// frees everything allocated since used was mark
+static inline void arenaRewind(struct Arena* arena, u64 mark) {
+	arena->used = mark;
+}
+
+// memory committed once stays committed, so a steady workload stops calling into the OS after its first frames
+static inline void arenaReset(struct Arena* arena) {
+	arena->used = 0;
+}
+
+#define ARENA_ARRAY(arena, T, count) ((T*)arenaAlloc(arena, sizeof(T) * (count), _Alignof(T)))
+
+// doubles an array held as data and capacity once count reaches capacity
+#define ARENA_RESERVE(arena, data, count, capacity) do { \
+	if ((count) >= (capacity)) { \
+		u32 grown = __builtin_elementwise_max((u32)(capacity) * 2, (u32)(count) + 16); \
+		(data) = arenaGrow(arena, data, sizeof(*(data)) * (capacity), sizeof(*(data)) * grown, _Alignof(typeof(*(data)))); \
+		(capacity) = grown; \
+	} \
+} while (0)
@@ -3,8 +3,8 @@
 #pragma comment(lib, "vcruntime.lib")
 #pragma comment(lib, "ucrt.lib")
 
-#include "math.h"
-#include <Windows.h>
+#include "platform.h"
+#include "ttf.h"
 #define CGLTF_IMPLEMENTATION
 #include "cgltf.h"
 
@@ -60,24 +60,14 @@ struct VertexAttributes {
 	u16 u, v;
 };
 
-#define INCBIN(name, file) \
-	__asm__(".section .rdata, \"dr\"\n" \
-			".global incbin_" #name "_start\n" \
-			".balign 16\n" \
-			"incbin_" #name "_start:\n" \
-			".incbin \"" file "\"\n" \
-			".global incbin_" #name "_end\n" \
-			".balign 1\n" \
-			"incbin_" #name "_end:\n" \
-	); \
-	extern __attribute__((aligned(16))) const char incbin_ ## name ## _start[]; \
-	extern const char incbin_ ## name ## _end[]
-
 // INCBIN(planks033B_1K_Color, "Planks033B_1K_Color.ktx2");
 INCBIN(gear, "gear.ktx2");
 INCBIN(discord, "discord.ktx2");
+INCBIN(ubuntuBold, "assets/Ubuntu-B.ttf");
 
+#ifdef _WIN32
 INCBIN(tada, "C:/Windows/Media/tada.wav");
+#endif
 
 static inline void writeNode(cgltf_node* node, int depth) {
 	char indent[128];
@@ -106,13 +96,20 @@ static inline void writeNode(cgltf_node* node, int depth) {
 
 int _fltused;
 
+#ifdef _WIN32
 __attribute__((noreturn)) void WinMainCRTStartup(void) {
+#else
+int main(void) {
+#endif
 	FILE* geometry_bin = fopen("geometry", "wb");
 	FILE* icons_bin = fopen("icons", "wb");
 	FILE* textures_bin = fopen("textures", "wb");
+	FILE* font_bin = fopen("font", "wb");
 
+#ifdef _WIN32
 	FILE* tada_bin = fopen("tada", "wb");
 	struct WAV* tada = incbin_tada_start;
+#endif
 
 	struct KTX2* gear = incbin_gear_start;
 	struct KTX2* discord = incbin_discord_start;
@@ -120,6 +117,22 @@ __attribute__((noreturn)) void WinMainCRTStartup(void) {
 	fwrite(incbin_gear_start + gear->levels[0].byteOffset, 1, gear->levels[0].byteLength, icons_bin);
 	fwrite(incbin_discord_start + discord->levels[0].byteOffset, 1, discord->levels[0].byteLength, icons_bin);
 
+	static u8 fontPixels[FONT_ATLAS_SIZE * FONT_ATLAS_SIZE];
+	static struct FontAtlas fontAtlas;
+	struct Ttf ttf;
+
+	if (!ttfInit(&ttf, (const u8*)incbin_ubuntuBold_start, (u32)(incbin_ubuntuBold_end - incbin_ubuntuBold_start))
+		|| !ttfBakeAtlas(&ttf, FONT_PIXELS_PER_EM, FONT_SPREAD, fontPixels, FONT_ATLAS_SIZE, FONT_ATLAS_SIZE, &fontAtlas)) {
+		printf("can't bake assets/Ubuntu-B.ttf\n");
+		platformExit(1);
+	}
+
+	printf("font: %u rows\n", fontAtlas.rows);
+
+	fwrite(&fontAtlas, sizeof(fontAtlas), 1, font_bin);
+	fwrite(fontPixels, 1, (u32)fontAtlas.width * fontAtlas.rows, font_bin);
+	fclose(font_bin);
+
 	// struct KTX2* planks033B_1K_Color = incbin_planks033B_1K_Color_start;
 	// for (u32 i = 0; i < planks033B_1K_Color->levelCount; i++) {
 	// 	fwrite(incbin_planks033B_1K_Color_start + planks033B_1K_Color->levels[i].byteOffset, 1, planks033B_1K_Color->levels[i].byteLength, textures_bin);
@@ -421,7 +434,7 @@ __attribute__((noreturn)) void WinMainCRTStartup(void) {
 	fwrite(vertexPositions, sizeof(struct VertexPosition), vertexCount, geometry_bin);
 	fwrite(vertexAttributes, sizeof(struct VertexAttributes), vertexCount, geometry_bin);
 
-	ExitProcess(0);
+	platformExit(0);
 
 // 	cgltf_options options = { 0 };
 // 	cgltf_data* data;
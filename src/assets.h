@@ -1,4 +1,7 @@
-#include "engine.h"
+#pragma once
+
+#include "gpu.h"
+#include "ttf.h"
 
 static struct {
 	u8vec4 black;
@@ -24,6 +27,7 @@ struct Buffer {
 	VkBufferUsageFlags usage;
 	VkMemoryPropertyFlags requiredMemoryPropertyFlagBits;
 	VkMemoryPropertyFlags optionalMemoryPropertyFlagBits;
+	struct GpuAllocation allocation;
 	void* data;
 };
 
@@ -34,8 +38,7 @@ enum Buffers : u8 {
 };
 
 static struct Buffer buffers[] = {
-	[BUFFER_STAGING] = {
-		.size = 128 * 1024 * 1024,
+	[BUFFER_STAGING] = { // sized to what the first frame uploads, and released once it has
 		.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
 		.requiredMemoryPropertyFlagBits = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
 	}, [BUFFER_DEVICE] = {
@@ -43,8 +46,8 @@ static struct Buffer buffers[] = {
 		.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
 		.requiredMemoryPropertyFlagBits = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
 	}, [BUFFER_FRAME] = {
-		.size = FRAMES_IN_FLIGHT * (BUFFER_RANGE_MODEL_MATRICES + BUFFER_RANGE_INDICES_2D + BUFFER_RANGE_VERTICES_2D + BUFFER_RANGE_TEXT),
-		.usage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
+		.size = FRAMES_IN_FLIGHT * (BUFFER_RANGE_MODEL_MATRICES + BUFFER_RANGE_INSTANCES + BUFFER_RANGE_DRAW_COMMANDS) + BUFFER_RANGE_STREAMS,
+		.usage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT,
 		.requiredMemoryPropertyFlagBits = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
 		.optionalMemoryPropertyFlagBits = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
 	}
@@ -55,6 +58,7 @@ struct Image {
 	VkFormat format;
 	u16 width, height;
 	u16 mipLevels, arrayLayers;
+	struct GpuAllocation allocation;
 };
 
 enum Images : u8 {
@@ -68,8 +72,8 @@ enum Images : u8 {
 static struct Image images[] = {
 	[IMAGE_FONT] = {
 		.format = VK_FORMAT_R8_UNORM,
-		.width = 2048,
-		.height = 2048,
+		.width = FONT_ATLAS_SIZE,
+		.height = FONT_ATLAS_SIZE,
 		.mipLevels = 1,
 		.arrayLayers = 1
 	}, [IMAGE_SKYBOX] = {
@@ -173,13 +177,6 @@ struct Material {
 	enum ImageViews metalRough;
 };
 
-struct ShaderMaterial {
-	vec4 color;
-	mat3 normalMatrix;
-	enum ImageViews colorIndex;
-	enum ImageViews normalIndex;
-};
-
 enum Materials : u8 {
 	MATERIAL_PURPLE,
 	MATERIAL_ROCK,
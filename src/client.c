@@ -1,12 +1,8 @@
-#define TICKS_PER_SECOND 50
-
 #include "gui.h"
+#include "stats.h"
 
 static mat4 projection;
 
-static mat4* modelMatrices;
-static u32 modelMatricesCount;
-
 static struct {
 	float pitch;
 	float yaw;
@@ -24,50 +20,119 @@ struct PlayingSound {
 	u16 sound;
 	u16 left, right;
 	u16 samplesPlayed;
-
-	u8 next;
 };
 
+static POOL(struct PlayingSound) playingSounds = POOL_INIT(struct PlayingSound, UINT8_MAX);
+
+static PlatformFile saveFile;
+
+static u64 clockStart;
+
+// latest input sampled by the render thread, yaw | buttons << 16, read by the simulation thread each tick
+static u32 simulationInput;
+
+// the room list arrives on the simulation thread and is applied by the UI; sequence is odd while a copy is being made
 static struct {
-	struct PlayingSound* data;
-	u8 firstFree;
-	u8 head;
-	u8 count;
-} playingSounds = {
-	.data = (struct PlayingSound[UINT8_MAX]){ },
-	.firstFree = (u8)-1,
-	.head = (u8)-1
-};
+	u8 data[2 + sizeof(rooms)];
+	u32 sequence;
+} roomListMailbox;
 
-struct Client {
-	u16 family;
-	union {
-		char v4[4];
-		char v6[16];
-	} ip;
-	u16 port;
+static u32 roomListApplied;
 
-	char name[32];
+static inline void roomListPost(const u8* buff, u32 size) {
+	size = __builtin_elementwise_min(size, (u32)sizeof(roomListMailbox.data));
 
-	u16 entity;
+	__atomic_store_n(&roomListMailbox.sequence, roomListMailbox.sequence + 1, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
 
-	u16 next;
-};
+	__builtin_memcpy(roomListMailbox.data, buff, size);
 
-static struct {
-	struct Client* data;
-	u16 firstFree;
-	u16 head;
-	u16 count;
-} clients = {
-	.data = (struct Client[UINT16_MAX]){ },
-	.firstFree = (u16)-1,
-	.head = (u16)-1
+	__atomic_store_n(&roomListMailbox.sequence, roomListMailbox.sequence + 1, __ATOMIC_RELEASE);
+}
+
+static inline void roomListPoll(void) {
+	u32 sequence = __atomic_load_n(&roomListMailbox.sequence, __ATOMIC_ACQUIRE);
+	if (sequence & 1 || sequence == roomListApplied)
+		return;
+
+	u8* buff = ARENA_ARRAY(&frameArena, u8, sizeof(roomListMailbox.data));
+	__builtin_memcpy(buff, roomListMailbox.data, sizeof(roomListMailbox.data));
+
+	// torn by a newer post, pick that up next frame instead
+	__atomic_thread_fence(__ATOMIC_ACQUIRE);
+	if (__atomic_load_n(&roomListMailbox.sequence, __ATOMIC_RELAXED) != sequence)
+		return;
+
+	roomListApplied = sequence;
+	roomList.childCount = 1 + buff[1];
+
+	for (u16 i = 0; i < roomList.childCount && 2 + (i + 1) * sizeof(struct Room) <= sizeof(roomListMailbox.data); i++) {
+		__builtin_memcpy(&rooms[i], &buff[2 + i * sizeof(struct Room)], sizeof(struct Room));
+
+		roomList.children[1 + i].text = rooms[i].description;
+	}
+}
+
+struct DrawBodies {
+	const struct WorldState* state;
+	float alpha;
 };
 
-static HANDLE saveFile;
+// walks the node tree of each body in the range, runs on the job workers
+static inline void drawBodies(void* data, u32 first, u32 count, u32 worker) {
+	const struct DrawBodies* draw = data;
+
+	for (u32 i = first; i < first + count; i++) {
+		const struct WorldBody* body = &draw->state->bodies[i];
+
+		float yaw;
+		vec3 position = worldBodyPosition(body, draw->alpha, &yaw);
+
+		quat pitchQuat = quatFromAxisAngle((vec3){ 1.f, 0.f, 0.f }, -body->pitch);
+		quat yawQuat = quatFromAxisAngle((vec3){ 0.f, 1.f, 0.f }, -yaw);
+		quat rotation = quatMultiply(yawQuat, pitchQuat);
+		float radius = body->radius;
+
+		struct Node* node = &nodes[NODE_PURPLE_CUBE];
+		struct Node* tree[64];
+		u16 childOffsets[64];
+		mat4 transforms[64];
+		u16 depth = 0;
+
+		transforms[0] = mat4FromRotationTranslationScale(rotation, position, (vec3){ radius, radius, radius });
+
+		for (;;) {
+			transforms[depth + 1] = transforms[depth] * mat4FromRotationTranslationScale(node->rotation, node->translation, node->scale);
+
+			if (node->mesh != (u16)-1) {
+				struct Mesh* mesh = &meshes[node->mesh];
 
-static inline void drawScene(vec3 cameraPosition, vec3 right, vec3 up, vec3 forward, u32 stencilReference) {
+				mat3 normalMatrix = mat3Adjoint(mat3FromMat4(transforms[depth]));
+
+				for (u16 i = 0; i < mesh->count; i++)
+					drawPrimitive(worker, mesh->elements[i].primitive, mesh->elements[i].material, transforms[depth + 1], normalMatrix);
+			}
+
+			if (node->childCount) {
+				tree[depth] = node;
+				childOffsets[depth++] = 0;
+				node = &nodes[node->firstChild];
+			} else {
+				while (depth) {
+					node = tree[--depth];
+					if (++childOffsets[depth] < node->childCount) {
+						node = &nodes[node->firstChild + childOffsets[depth++]];
+						break;
+					}
+				}
+				if (!depth)
+					break;
+			}
+		}
+	}
+}
+
+static inline void drawScene(const struct WorldState* state, float alpha, vec3 cameraPosition, vec3 right, vec3 up, vec3 forward, u32 stencilReference) {
 	mat4 view;
 	view[0][0] = right.x;
 	view[1][0] = up.x;
@@ -93,111 +158,144 @@ static inline void drawScene(vec3 cameraPosition, vec3 right, vec3 up, vec3 forw
 		(vec4){ 0.f, 0.f, 0.f, 0.f }
 	});
 
-	vkCmdPushConstants(commandBuffer, pipelineLayout, VK_SHADER_STAGE_FRAGMENT_BIT, 80, sizeof(vec3), &cameraPosition);
+	vkCmdPushConstants(commandBuffer, pipelineLayout, VK_SHADER_STAGE_FRAGMENT_BIT, 80, 3 * sizeof(float), &cameraPosition);
 
 	vkCmdSetStencilReference(commandBuffer, VK_STENCIL_FACE_FRONT_AND_BACK, stencilReference);
 	vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelines[PIPELINE_TRIANGLE]);
 	vkCmdBindIndexBuffer(commandBuffer, buffers[BUFFER_DEVICE].handle, 0, VK_INDEX_TYPE_UINT16);
 
 	for (u16 i = 0; i < _countof(primitives); i++) {
-		struct Primitive* primitive = &primitives[i];
-		struct Material* material = &materials[i];
-
 		mat4 transform = mat4FromRotationTranslationScale((quat){ 0.f, 0.f, 0.f, 1.f }, (vec3){ i * 10.f, 0.f, -10.f }, (vec3){ 1.f, 1.f, 1.f });
-		modelMatrices[modelMatricesCount] = mat4TranslateScale(transform, primitive->min, primitive->max - primitive->min);
+		drawPrimitive(0, i, i, transform, mat3Adjoint(mat3FromMat4(transform)));
+	}
 
-		vkCmdPushConstants(commandBuffer, pipelineLayout, VK_SHADER_STAGE_FRAGMENT_BIT, 96, sizeof(struct ShaderMaterial), &(struct ShaderMaterial){
-			.color = { material->rgba.r / 255.f, material->rgba.g / 255.f, material->rgba.b / 255.f, material->rgba.a / 255.f },
-			.normalMatrix = mat3Adjoint(mat3FromMat4(transform)),
-			.colorIndex = material->color,
-			.normalIndex = material->normal
-		});
+	jobsParallelFor(0, drawBodies, &(struct DrawBodies){ state, alpha }, state->count, DRAW_BODY_BATCH);
 
-		if (primitive->indexed)
-			vkCmdDrawIndexed(commandBuffer, primitive->indexCount, 1, primitive->firstIndex, primitive->vertexOffset, modelMatricesCount);
-		else
-			vkCmdDraw(commandBuffer, primitive->vertexCount, 1, primitive->firstVertex, modelMatricesCount);
+	drawFlush(viewProjection);
 
-		modelMatricesCount++;
-	}
+	vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelines[PIPELINE_SKYBOX]);
+	vkCmdDraw(commandBuffer, 3, 1, 0, 0);
+}
 
+// runs the network and the fixed tick on its own clock so a stalled frame can't hold either up; everything it touches
+// besides the input word and the room list mailbox is its own, the renderer only sees what worldPublish hands over
+static inline PLATFORM_THREAD_FUNCTION(simulationThread) {
+	for (;;) {
+		while (netReceive()) {
+			for (u32 p = 0; p < netInbox.count; p++) {
+				struct NetPacket* packet = &netInbox.packets[p];
+				char* buff = (char*)packet->data;
+
+				bool isServer = netAddressEqual(&packet->address, &serverAddress);
+				bool isGameHost = netAddressEqual(&packet->address, &gameHostAddress);
+
+				u16 idx = clientFind(&packet->address);
+				if (idx == (u16)-1)
+					idx = clientCreate(&packet->address);
+				if (idx == POOL_NONE)
+					continue;
+
+				struct Client* client = &clients.data[idx];
+				client->lastSeen = ticksElapsed;
+
+				// a datagram may carry several messages back to back; stop at the first one we can't size
+				for (u32 j = 0; j < packet->size;) {
+					switch (buff[j]) {
+						case 0x00: // receive room list
+							if (isServer)
+								roomListPost((u8*)&buff[j], packet->size - j);
+
+							j = packet->size;
+							break;
+						case 0x01: { // welcome
+							if (packet->size - j < 3)
+								goto next;
+
+							u16 entity;
+							__builtin_memcpy(&entity, &buff[j + 1], sizeof(u16));
+
+							// predictionBegin indexes entities with it
+							if (entity >= entities.index.capacity)
+								goto next;
+
+							if (isGameHost)
+								predictionBegin(entity);
+
+							j += 3;
+							break;
+						}
+						case 0x02: { // snapshot
+							if (!isGameHost)
+								goto next;
 
-	u16 idx = entities.head;
-	while (idx != (u16)-1) {
-		struct Entity* entity = &entities.data[idx];
+							u32 size = snapshotReceive((u8*)&buff[j], packet->size - j, &packet->address);
+							if (!size)
+								goto next;
 
-		quat pitchQuat = quatFromAxisAngle((vec3){ 1.f, 0.f, 0.f }, -entity->pitch);
-		quat yawQuat = quatFromAxisAngle((vec3){ 0.f, 1.f, 0.f }, -entity->yaw);
-		quat rotation = quatMultiply(yawQuat, pitchQuat);
+							j += size;
+							break;
+						}
+						case 0x04: { // player correction
+							if (!isGameHost)
+								goto next;
 
-		vec3 position = (vec3)(entity->position >> 16);
+							u32 size = predictionCorrect((u8*)&buff[j], packet->size - j);
+							if (!size)
+								goto next;
 
-		struct Node* node = &nodes[NODE_PURPLE_CUBE];
-		struct Node* tree[64];
-		u16 childOffsets[64];
-		mat4 transforms[64];
-		u16 depth = 0;
+							j += size;
+							break;
+						}
+						default:
+							goto next;
+					}
+				}
 
-		transforms[0] = mat4FromRotationTranslationScale(rotation, position, (vec3){ entity->radius, entity->radius, entity->radius });
+			next:;
+			}
+		}
 
-		for (;;) {
-			transforms[depth + 1] = transforms[depth] * mat4FromRotationTranslationScale(node->rotation, node->translation, node->scale);
+		u64 nsElapsed = platformClock() - clockStart;
+		u64 targetTicks = nsElapsed / NANOSECONDS_PER_TICK;
 
-			if (node->mesh != (u16)-1) {
-				struct Mesh* mesh = &meshes[node->mesh];
-
-				for (u16 i = 0; i < mesh->count; i++) {
-					struct Primitive* primitive = &primitives[mesh->elements[i].primitive];
-					struct Material* material = &materials[mesh->elements[i].material];
+		while (ticksElapsed < targetTicks) {
+			clientsExpire(ticksElapsed);
 
-					modelMatrices[modelMatricesCount] = mat4TranslateScale(transforms[depth + 1], primitive->min, primitive->max - primitive->min);
+			u32 packed = __atomic_load_n(&simulationInput, __ATOMIC_RELAXED);
+			predictionInput((struct PlayerInput){ .yaw = (u16)packed, .buttons = (u8)(packed >> 16) });
 
-					vkCmdPushConstants(commandBuffer, pipelineLayout, VK_SHADER_STAGE_FRAGMENT_BIT, 96, sizeof(struct ShaderMaterial), &(struct ShaderMaterial){
-						.color = { material->rgba.r / 255.f, material->rgba.g / 255.f, material->rgba.b / 255.f, material->rgba.a / 255.f },
-						.normalMatrix = mat3Adjoint(mat3FromMat4(transforms[depth])),
-						.colorIndex = material->color,
-						.normalIndex = material->normal
-					});
+			bodiesIntegrate();
+			gridRebuild();
 
-					if (primitive->indexed)
-						vkCmdDrawIndexed(commandBuffer, primitive->indexCount, 1, primitive->firstIndex, primitive->vertexOffset, modelMatricesCount);
-					else
-						vkCmdDraw(commandBuffer, primitive->vertexCount, 1, primitive->firstVertex, modelMatricesCount);
+			predictionCommit(&serverAddress);
 
-					modelMatricesCount++;
-				}
+			if (!prediction.active && ticksElapsed % CLIENT_HELLO_INTERVAL_TICKS == 0) {
+				u8* hello = netSend(&serverAddress, CLIENT_HELLO_SIZE);
+				hello[0] = 0x01;
+				hello[1] = CLIENT_PROTOCOL_VERSION;
 			}
 
-			if (node->childCount) {
-				tree[depth] = node;
-				childOffsets[depth++] = 0;
-				node = &nodes[node->firstChild];
-			} else {
-				while (depth) {
-					node = tree[--depth];
-					if (++childOffsets[depth] < node->childCount) {
-						node = &nodes[node->firstChild + childOffsets[depth++]];
-						break;
-					}
-				}
-				if (!depth)
-					break;
-			}
+			ticksElapsed++;
+
+			u64 time = ticksElapsed * NANOSECONDS_PER_TICK;
+			interpolationUpdate(clockStart + time);
+			worldPublish(time);
 		}
 
-		idx = entity->next;
-	}
+		netFlush();
 
-	vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelines[PIPELINE_SKYBOX]);
-	vkCmdDraw(commandBuffer, 3, 1, 0, 0);
+		// sleep until the next tick is due unless a datagram arrives first
+		u64 next = (ticksElapsed + 1) * NANOSECONDS_PER_TICK;
+		nsElapsed = platformClock() - clockStart;
+		if (next > nsElapsed)
+			platformSocketWait((u32)((next - nsElapsed) / 1000000));
+	}
 }
 
 static inline LRESULT CALLBACK wndProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam) {
 	switch (msg) {
 		case WM_DESTROY:
-			DWORD bytesWritten;
-			if (!WriteFile(saveFile, &saves, sizeof(struct Saves), &bytesWritten, NULL))
-				win32Fatal("WriteFile", GetLastError());
+			platformFileWrite(saveFile, &saves, sizeof(struct Saves));
 
 			PostQuitMessage(0);
 			break;
@@ -275,6 +373,9 @@ static inline LRESULT CALLBACK wndProc(HWND hWnd, UINT msg, WPARAM wParam, LPARA
 							ShowCursor(TRUE);
 						}
 						break;
+					case VK_F3:
+						frameStats.visible = !frameStats.visible;
+						break;
 					case VK_F4:
 						if (altDown) {
 							if (!isAnimating(&altF4Dialog)) {
@@ -472,7 +573,6 @@ __attribute__((noreturn)) void WinMainCRTStartup(void) {
 				break;
 		}
 
-	VkDevice device;
 	if ((r = vkCreateDevice(physicalDevice, &(const VkDeviceCreateInfo){
 		.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
 		.queueCreateInfoCount = 1,
@@ -490,7 +590,8 @@ __attribute__((noreturn)) void WinMainCRTStartup(void) {
 			.textureCompressionBC = physicalDeviceFeatures.textureCompressionBC,
 			.depthClamp = physicalDeviceFeatures.depthClamp,
 			.shaderClipDistance = physicalDeviceFeatures.shaderClipDistance,
-			.shaderInt16 = physicalDeviceFeatures.shaderClipDistance
+			.shaderInt16 = physicalDeviceFeatures.shaderClipDistance,
+			.drawIndirectFirstInstance = physicalDeviceFeatures.drawIndirectFirstInstance
 			// .samplerAnisotropy = physicalDeviceFeatures.samplerAnisotropy
 		}
 	}, NULL, &device)) != VK_SUCCESS)
@@ -606,15 +707,8 @@ __attribute__((noreturn)) void WinMainCRTStartup(void) {
 
 	vkGetImageMemoryRequirements(device, colorImage, &memoryRequirements);
 
-	VkDeviceMemory colorImageDeviceMemory;
-	if ((r = vkAllocateMemory(device, &(VkMemoryAllocateInfo){
-		.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
-		.allocationSize = memoryRequirements.size,
-		.memoryTypeIndex = vkGetMemoryTypeIndex(VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 0)
-	}, NULL, &colorImageDeviceMemory)) != VK_SUCCESS)
-		vkFatal("vkAllocateMemory", r);
-
-	if ((r = vkBindImageMemory(device, colorImage, colorImageDeviceMemory, 0)) != VK_SUCCESS)
+	struct GpuAllocation colorImageAllocation = gpuAllocate(device, GPU_RESOURCE_OPTIMAL, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 0);
+	if ((r = vkBindImageMemory(device, colorImage, colorImageAllocation.memory, colorImageAllocation.offset)) != VK_SUCCESS)
 		vkFatal("vkBindImageMemory", r);
 
 	VkImageView colorImageView;
@@ -651,15 +745,8 @@ __attribute__((noreturn)) void WinMainCRTStartup(void) {
 
 	vkGetImageMemoryRequirements(device, depthImage, &memoryRequirements);
 
-	VkDeviceMemory depthImageDeviceMemory;
-	if ((r = vkAllocateMemory(device, &(VkMemoryAllocateInfo){
-		.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
-		.allocationSize = memoryRequirements.size,
-		.memoryTypeIndex = vkGetMemoryTypeIndex(VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 0)
-	}, NULL, &depthImageDeviceMemory)) != VK_SUCCESS)
-		vkFatal("vkAllocateMemory", r);
-
-	if ((r = vkBindImageMemory(device, depthImage, depthImageDeviceMemory, 0)) != VK_SUCCESS)
+	struct GpuAllocation depthImageAllocation = gpuAllocate(device, GPU_RESOURCE_OPTIMAL, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 0);
+	if ((r = vkBindImageMemory(device, depthImage, depthImageAllocation.memory, depthImageAllocation.offset)) != VK_SUCCESS)
 		vkFatal("vkBindImageMemory", r);
 
 	VkImageView depthImageView;
@@ -708,6 +795,11 @@ __attribute__((noreturn)) void WinMainCRTStartup(void) {
 			vkFatal("vkCreateFramebuffer", r);
 	}
 
+	// laid out the way the first frame fills it
+	buffers[BUFFER_STAGING].size = BUFFER_RANGE_QUAD_INDICES + BUFFER_RANGE_VERTEX_INDICES + BUFFER_RANGE_VERTEX_POSITIONS + BUFFER_RANGE_VERTEX_ATTRIBUTES
+		+ (ALIGN_FORWARD((u32)(incbin_font_end - incbin_font_start) - sizeof(struct FontAtlas) + sizeof(float), 8u))
+		+ (images[IMAGE_ICONS].width * images[IMAGE_ICONS].height * images[IMAGE_ICONS].arrayLayers) / 2;
+
 	for (u32 i = 0; i < _countof(buffers); i++) {
 		if ((r = vkCreateBuffer(device, &(VkBufferCreateInfo){
 			.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
@@ -718,20 +810,11 @@ __attribute__((noreturn)) void WinMainCRTStartup(void) {
 
 		vkGetBufferMemoryRequirements(device, buffers[i].handle, &memoryRequirements);
 
-		VkDeviceMemory deviceMemory;
-		if ((r = vkAllocateMemory(device, &(VkMemoryAllocateInfo){
-			.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
-			.allocationSize = memoryRequirements.size,
-			.memoryTypeIndex = vkGetMemoryTypeIndex(buffers[i].requiredMemoryPropertyFlagBits, buffers[i].optionalMemoryPropertyFlagBits)
-		}, NULL, &deviceMemory)) != VK_SUCCESS)
-			vkFatal("vkAllocateMemory", r);
+		buffers[i].allocation = gpuAllocate(device, GPU_RESOURCE_LINEAR, buffers[i].requiredMemoryPropertyFlagBits, buffers[i].optionalMemoryPropertyFlagBits);
+		buffers[i].data = buffers[i].allocation.data;
 
-		if ((r = vkBindBufferMemory(device, buffers[i].handle, deviceMemory, 0)) != VK_SUCCESS)
+		if ((r = vkBindBufferMemory(device, buffers[i].handle, buffers[i].allocation.memory, buffers[i].allocation.offset)) != VK_SUCCESS)
 			vkFatal("vkBindBufferMemory", r);
-
-		if (buffers[i].requiredMemoryPropertyFlagBits & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)
-			if ((r = vkMapMemory(device, deviceMemory, 0, VK_WHOLE_SIZE, 0, &buffers[i].data)) != VK_SUCCESS)
-				vkFatal("vkMapMemory", r);
 	}
 
 	VkImageMemoryBarrier imageMemoryBarriers[_countof(images)];
@@ -755,15 +838,8 @@ __attribute__((noreturn)) void WinMainCRTStartup(void) {
 
 		vkGetImageMemoryRequirements(device, images[i].handle, &memoryRequirements);
 
-		VkDeviceMemory deviceMemory;
-		if ((r = vkAllocateMemory(device, &(VkMemoryAllocateInfo){
-			.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
-			.allocationSize = memoryRequirements.size,
-			.memoryTypeIndex = vkGetMemoryTypeIndex(VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 0)
-		}, NULL, &deviceMemory)) != VK_SUCCESS)
-			vkFatal("vkAllocateMemory", r);
-
-		if ((r = vkBindImageMemory(device, images[i].handle, deviceMemory, 0)) != VK_SUCCESS)
+		images[i].allocation = gpuAllocate(device, GPU_RESOURCE_OPTIMAL, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 0);
+		if ((r = vkBindImageMemory(device, images[i].handle, images[i].allocation.memory, images[i].allocation.offset)) != VK_SUCCESS)
 			vkFatal("vkBindImageMemory", r);
 
 		imageMemoryBarriers[i] = (VkImageMemoryBarrier){
@@ -821,7 +897,7 @@ __attribute__((noreturn)) void WinMainCRTStartup(void) {
 	VkDescriptorSetLayout descriptorSetLayout;
 	if ((r = vkCreateDescriptorSetLayout(device, &(VkDescriptorSetLayoutCreateInfo){
 		.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
-		.bindingCount = 1,
+		.bindingCount = 2,
 		.pBindings = (VkDescriptorSetLayoutBinding[]){
 			{
 				.binding = 0,
@@ -829,7 +905,7 @@ __attribute__((noreturn)) void WinMainCRTStartup(void) {
 				.descriptorCount = _countof(descriptorImageInfos),
 				.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT,
 				.pImmutableSamplers = (VkSampler[]){
-					[IMAGE_VIEW_FONT] = sampler,
+					[IMAGE_VIEW_FONT] = samplerLinear, // distance fields need filtering
 					[IMAGE_VIEW_SKYBOX] = sampler,
 					[IMAGE_VIEW_BLACK] = sampler,
 					[IMAGE_VIEW_WHITE] = sampler,
@@ -838,6 +914,11 @@ __attribute__((noreturn)) void WinMainCRTStartup(void) {
 					[IMAGE_VIEW_DISCORD] = samplerLinear,
 					[IMAGE_VIEW_UNDISPUTED] = samplerLinear,
 				}
+			}, {
+				.binding = 1,
+				.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC,
+				.descriptorCount = 1,
+				.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT
 			}
 		}
 	}, NULL, &descriptorSetLayout)) != VK_SUCCESS)
@@ -847,11 +928,14 @@ __attribute__((noreturn)) void WinMainCRTStartup(void) {
 	if ((r = vkCreateDescriptorPool(device, &(VkDescriptorPoolCreateInfo){
 		.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
 		.maxSets = 1,
-		.poolSizeCount = 1,
+		.poolSizeCount = 2,
 		.pPoolSizes = (VkDescriptorPoolSize[]){
 			{
 				.type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
 				.descriptorCount = _countof(descriptorImageInfos)
+			}, {
+				.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC,
+				.descriptorCount = 1
 			}
 		}
 	}, NULL, &descriptorPool)) != VK_SUCCESS)
@@ -866,7 +950,7 @@ __attribute__((noreturn)) void WinMainCRTStartup(void) {
 	}, &descriptorSet)) != VK_SUCCESS)
 		vkFatal("vkAllocateDescriptorSets", r);
 
-	vkUpdateDescriptorSets(device, 1, (VkWriteDescriptorSet[]){
+	vkUpdateDescriptorSets(device, 2, (VkWriteDescriptorSet[]){
 		{
 			.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
 			.dstSet = descriptorSet,
@@ -875,6 +959,18 @@ __attribute__((noreturn)) void WinMainCRTStartup(void) {
 			.descriptorCount = _countof(descriptorImageInfos),
 			.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
 			.pImageInfo = descriptorImageInfos
+		}, {
+			.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+			.dstSet = descriptorSet,
+			.dstBinding = 1,
+			.dstArrayElement = 0,
+			.descriptorCount = 1,
+			.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC,
+			.pBufferInfo = &(VkDescriptorBufferInfo){
+				.buffer = buffers[BUFFER_FRAME].handle,
+				.offset = BUFFER_OFFSET_INSTANCES,
+				.range = BUFFER_RANGE_INSTANCES
+			}
 		}
 	}, 0, NULL);
 
@@ -891,7 +987,7 @@ __attribute__((noreturn)) void WinMainCRTStartup(void) {
 			}, {
 				.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT,
 				.offset = 80,
-				.size = 88
+				.size = 3 * sizeof(float)
 			}
 		}
 	}, NULL, &pipelineLayout)) != VK_SUCCESS)
@@ -1079,14 +1175,21 @@ __attribute__((noreturn)) void WinMainCRTStartup(void) {
 		.vertexBindingDescriptionCount = 1,
 		.pVertexBindingDescriptions = &(VkVertexInputBindingDescription){
 			.binding = 0,
-			.stride = sizeof(vec2)
+			.stride = sizeof(struct Vertex2D)
 		},
-		.vertexAttributeDescriptionCount = 1,
-		.pVertexAttributeDescriptions = &(VkVertexInputAttributeDescription){
-			.location = 0,
-			.binding = 0,
-			.format = VK_FORMAT_R32G32_SFLOAT,
-			.offset = 0
+		.vertexAttributeDescriptionCount = 2,
+		.pVertexAttributeDescriptions = (VkVertexInputAttributeDescription[]){
+			{
+				.location = 0,
+				.binding = 0,
+				.format = VK_FORMAT_R32G32_SFLOAT,
+				.offset = offsetof(struct Vertex2D, position)
+			}, {
+				.location = 1,
+				.binding = 0,
+				.format = VK_FORMAT_R8G8B8A8_UNORM,
+				.offset = offsetof(struct Vertex2D, color)
+			}
 		}
 	};
 
@@ -1095,14 +1198,26 @@ __attribute__((noreturn)) void WinMainCRTStartup(void) {
 		.vertexBindingDescriptionCount = 1,
 		.pVertexBindingDescriptions = &(VkVertexInputBindingDescription){
 			.binding = 1,
-			.stride = sizeof(vec4)
+			.stride = sizeof(struct VertexText)
 		},
-		.vertexAttributeDescriptionCount = 1,
-		.pVertexAttributeDescriptions = &(VkVertexInputAttributeDescription){
-			.location = 0,
-			.binding = 1,
-			.format = VK_FORMAT_R32G32B32A32_SFLOAT,
-			.offset = 0
+		.vertexAttributeDescriptionCount = 3,
+		.pVertexAttributeDescriptions = (VkVertexInputAttributeDescription[]){
+			{
+				.location = 0,
+				.binding = 1,
+				.format = VK_FORMAT_R32G32_SFLOAT,
+				.offset = offsetof(struct VertexText, position)
+			}, {
+				.location = 1,
+				.binding = 1,
+				.format = VK_FORMAT_R16G16_UNORM,
+				.offset = offsetof(struct VertexText, uv)
+			}, {
+				.location = 2,
+				.binding = 1,
+				.format = VK_FORMAT_R8G8B8A8_UNORM,
+				.offset = offsetof(struct VertexText, color)
+			}
 		}
 	};
 
@@ -1816,86 +1931,20 @@ __attribute__((noreturn)) void WinMainCRTStartup(void) {
 		}
 	};
 
-	static const GUID CLSID_MMDeviceEnumerator = { 0xbcde0395, 0xe52f, 0x467c, { 0x8e, 0x3d, 0xc4, 0x57, 0x92, 0x91, 0x69, 0x2e } };
-	static const GUID IID_IMMDeviceEnumerator = { 0xa95664d2, 0x9614, 0x4f35, { 0xa7, 0x46, 0xde, 0x8d, 0xb6, 0x36, 0x17, 0xe6 } };
-	static const GUID IID_IAudioClient = { 0x1cb9ad4c, 0xdbfa, 0x4c32, { 0xb1, 0x78, 0xc2, 0xf5, 0x68, 0xa7, 0x03, 0xb2 } };
-	static const GUID IID_IAudioRenderClient = { 0xf294acfc, 0x3146, 0x4483, { 0xa7, 0xbf, 0xad, 0xdc, 0xa7, 0xc2, 0x60, 0xe2 } };
-
-	HRESULT hr;
-	if (FAILED(hr = CoInitializeEx(NULL, COINIT_DISABLE_OLE1DDE | COINIT_SPEED_OVER_MEMORY)))
-		win32Fatal("CoInitializeEx", (DWORD)hr);
-
-	IMMDeviceEnumerator* audioDeviceEnumerator;
-	if (FAILED(hr = CoCreateInstance(&CLSID_MMDeviceEnumerator, NULL, CLSCTX_ALL, &IID_IMMDeviceEnumerator, (void**)&audioDeviceEnumerator)))
-		win32Fatal("CoCreateInstance", (DWORD)hr);
-
-	IMMDevice* audioDevice;
-	if (FAILED(hr = audioDeviceEnumerator->lpVtbl->GetDefaultAudioEndpoint(audioDeviceEnumerator, eRender, eConsole, &audioDevice)))
-		win32Fatal("GetDefaultAudioEndpoint", (DWORD)hr);
-
-	IAudioClient* audioClient;
-	if (FAILED(hr = audioDevice->lpVtbl->Activate(audioDevice, &IID_IAudioClient, CLSCTX_ALL, NULL, (void**)&audioClient)))
-		win32Fatal("Activate", (DWORD)hr);
-
-	WAVEFORMATEX waveFormat = {
-		.wFormatTag = WAVE_FORMAT_PCM,
-		.nChannels = 2,
-		.nSamplesPerSec = 43200,
-		.wBitsPerSample = sizeof(u16) * 8,
-	};
-	waveFormat.nBlockAlign = (waveFormat.nChannels * waveFormat.wBitsPerSample) / 8;
-	waveFormat.nAvgBytesPerSec = waveFormat.nSamplesPerSec * waveFormat.nBlockAlign;
-
-	if (FAILED(hr = audioClient->lpVtbl->Initialize(audioClient, AUDCLNT_SHAREMODE_SHARED, AUDCLNT_STREAMFLAGS_AUTOCONVERTPCM | AUDCLNT_STREAMFLAGS_SRC_DEFAULT_QUALITY, 10000000, 0, &waveFormat, NULL)))
-		win32Fatal("Initialize", (DWORD)hr);
-
-	IAudioRenderClient* audioRenderClient;
-	if (FAILED(hr = audioClient->lpVtbl->GetService(audioClient, &IID_IAudioRenderClient, (void**)&audioRenderClient)))
-		win32Fatal("GetService", (DWORD)hr);
-
-	UINT32 audioBufferSize;
-	if (FAILED(hr = audioClient->lpVtbl->GetBufferSize(audioClient, &audioBufferSize)))
-		win32Fatal("GetBufferSize", (DWORD)hr);
-
-	if (FAILED(hr = audioClient->lpVtbl->Start(audioClient)))
-		win32Fatal("Start", (DWORD)hr);
-
-	serverAddress = (struct sockaddr_in){
-		.sin_family = AF_INET,
-		.sin_port = htons(9000),
-		.sin_addr.s_addr = inet_addr("172.23.52.49")
-	};
-
-	WSADATA wsaData;
-	int wr = WSAStartup(MAKEWORD(2, 2), &wsaData);
-	if (wr != NO_ERROR)
-		win32Fatal("WSAStartup", (DWORD)wr);
+	platformAudioOpen(43200);
+	jobsInit();
+	arenaInit(&frameArena, 256ull << 20);
 
-	if ((sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP)) == INVALID_SOCKET)
-		win32Fatal("socket", (DWORD)WSAGetLastError());
+	serverAddress = netAddressV4(172, 23, 52, 49, 9000);
 
-	if (ioctlsocket(sock, FIONBIO, &(u_long){ 1 }) == SOCKET_ERROR)
-		win32Fatal("ioctlsocket", (DWORD)WSAGetLastError());
+	platformSocketOpen(0);
 
-	if (bind(sock, (struct sockaddr*)&(struct sockaddr_in){
-		.sin_family = AF_INET
-	}, sizeof(struct sockaddr_in)) == SOCKET_ERROR)
-		win32Fatal("bind", (DWORD)WSAGetLastError());
+	saveFile = platformFileOpen("Saves", PLATFORM_FILE_READ_WRITE);
 
-	if (!(saveFile = CreateFileW(L"Saves", GENERIC_READ | GENERIC_WRITE, 0, NULL, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL)))
-		win32Fatal("CreateFileW", GetLastError());
-
-	if (GetLastError() == ERROR_ALREADY_EXISTS) {
-		LARGE_INTEGER fileSize;
-		if (!GetFileSizeEx(saveFile, &fileSize))
-			win32Fatal("GetFileSizeEx", GetLastError());
-
-		DWORD bytesRead;
-		if (!ReadFile(saveFile, &saves, (DWORD)fileSize.QuadPart, &bytesRead, NULL))
-			win32Fatal("ReadFile", GetLastError());
-
-		if (SetFilePointer(saveFile, 0, NULL, FILE_BEGIN) == INVALID_SET_FILE_POINTER)
-			win32Fatal("SetFilePointer", GetLastError());
+	u64 saveFileSize = platformFileSize(saveFile);
+	if (saveFileSize) {
+		platformFileRead(saveFile, &saves, saveFileSize < sizeof(struct Saves) ? (u32)saveFileSize : sizeof(struct Saves));
+		platformFileRewind(saveFile);
 	} else {
 		saves = (struct Saves){
 			.keyBindings = {
@@ -1917,33 +1966,23 @@ __attribute__((noreturn)) void WinMainCRTStartup(void) {
 		};
 	}
 
-	// u16 idx;
-	// if (entities.firstFree == (u16)-1) {
-	// 	idx = entities.count++;
-	// } else {
-	// 	idx = entities.firstFree;
-	// 	entities.firstFree = entities.data[entities.firstFree].next;
-	// }
+	// u16 idx = poolInsert(&entities.index);
 
 	// entities.data[idx] = (struct Entity){
 	// 	.type = ENTITY_TYPE_PLAYER,
 	// 	.flags = ENTITY_IS_PLAYER_CONTROLLED,
-	// 	.speed = 1 << 15,
-	// 	.next = entities.head
+	// 	.speed = 1 << 15
 	// };
-	// entities.head = idx;
 
 	// u16 playerID = idx;
 
-	LARGE_INTEGER frequency;
-	if (!QueryPerformanceFrequency(&frequency))
-		win32Fatal("QueryPerformanceFrequency", GetLastError());
-
-	LARGE_INTEGER start;
-	if (!QueryPerformanceCounter(&start))
-		win32Fatal("QueryPerformanceCounter", GetLastError());
+	clockStart = platformClock();
+	platformThreadStart(simulationThread, NULL);
 
 	for (;;) {
+		arenaReset(&frameArena);
+		path = (struct Path2D){ };
+
 		u32 swapchainImageIndex;
 		if ((r = vkAcquireNextImageKHR(device, swapchain, UINT64_MAX, imageAcquireSemaphores[frame], VK_NULL_HANDLE, &swapchainImageIndex)) != VK_SUCCESS)
 			vkFatal("vkAcquireNextImageKHR", r);
@@ -1965,8 +2004,20 @@ __attribute__((noreturn)) void WinMainCRTStartup(void) {
 			vkFatal("vkBeginCommandBuffer", r);
 
 		static bool copied;
+		static u32 copiedFrame;
+
+		// the fence just waited on covered the upload, so nothing reads the staging buffer anymore
+		if (copied && frame == copiedFrame && buffers[BUFFER_STAGING].handle) {
+			vkDestroyBuffer(device, buffers[BUFFER_STAGING].handle, NULL);
+			gpuFree(&buffers[BUFFER_STAGING].allocation);
+
+			buffers[BUFFER_STAGING].handle = VK_NULL_HANDLE;
+			buffers[BUFFER_STAGING].data = NULL;
+		}
+
 		if (!copied) {
 			copied = true;
+			copiedFrame = frame;
 
 			u16* quadIndices = buffers[BUFFER_STAGING].data + BUFFER_OFFSET_QUAD_INDICES;
 			u16 j = 0;
@@ -2007,7 +2058,7 @@ __attribute__((noreturn)) void WinMainCRTStartup(void) {
 				}
 			});
 
-			createFontBitmap(buffers[BUFFER_STAGING].data + stagingDataOffset);
+			u32 fontRows = loadFontAtlas(buffers[BUFFER_STAGING].data + stagingDataOffset);
 			vkCmdCopyBufferToImage(commandBuffer, buffers[BUFFER_STAGING].handle, images[IMAGE_FONT].handle, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &(VkBufferImageCopy){
 				.bufferOffset = stagingDataOffset,
 				.imageSubresource = {
@@ -2018,12 +2069,12 @@ __attribute__((noreturn)) void WinMainCRTStartup(void) {
 				},
 				.imageExtent = {
 					.width = images[IMAGE_FONT].width,
-					.height = images[IMAGE_FONT].height,
+					.height = fontRows,
 					.depth = 1
 				}
 			});
 
-			stagingDataOffset += images[IMAGE_FONT].width * images[IMAGE_FONT].height;
+			stagingDataOffset += images[IMAGE_FONT].width * fontRows;
 
 			vkCmdCopyBufferToImage(commandBuffer, buffers[BUFFER_STAGING].handle, images[IMAGE_DEFAULT].handle, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &(VkBufferImageCopy){
 				.bufferOffset = stagingDataOffset,
@@ -2089,260 +2140,53 @@ __attribute__((noreturn)) void WinMainCRTStartup(void) {
 			vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, NULL, 0, NULL, _countof(imageMemoryBarriers), imageMemoryBarriers);
 		}
 
-		MSG msg;
-		while (PeekMessageW(&msg, NULL, 0, 0, PM_REMOVE)) {
-			if (msg.message == WM_QUIT)
-				ExitProcess(EXIT_SUCCESS);
-			else {
-				TranslateMessage(&msg);
-				DispatchMessageW(&msg);
-			}
-		}
+		if (!platformPollEvents())
+			platformExit(EXIT_SUCCESS);
 
-		for (;;) {
-			char buff[8192];
-			struct sockaddr_storage address;
-			struct sockaddr_in* v4 = (struct sockaddr_in*)&address;
-			struct sockaddr_in6* v6 = (struct sockaddr_in6*)&address;
-
-			int bytesReceived;
-			if ((bytesReceived = recvfrom(sock, buff, sizeof(buff), 0, (struct sockaddr*)&address, &(int){ sizeof(struct sockaddr_storage) })) == SOCKET_ERROR) {
-				if ((wr = WSAGetLastError()) == WSAEWOULDBLOCK)
-					break;
+		roomListPoll();
 
-				win32Fatal("recvfrom", (DWORD)wr);
-			}
+		u64 nsElapsed = platformClock() - clockStart;
 
-			if (address.ss_family != AF_INET && address.ss_family != AF_INET6)
-				continue;
-
-			bool isServer = (address.ss_family == serverAddress.sin_family &&
-				__builtin_memcmp(&v4->sin_addr, &serverAddress.sin_addr, sizeof(v4->sin_addr)) == 0 &&
-				v4->sin_port == serverAddress.sin_port);
-
-			bool isGameHost = false;
-			if (address.ss_family == gameHostAddress.ss_family) {
-
-				if (gameHostAddress.ss_family == AF_INET) {
-					struct sockaddr_in* in = (struct sockaddr_in*)&gameHostAddress;
-					isGameHost = __builtin_memcmp(&v4->sin_addr, &in->sin_addr, sizeof(v4->sin_addr)) == 0 && v4->sin_port == in->sin_port;
-				} else {
-					struct sockaddr_in6* in6 = (struct sockaddr_in6*)&gameHostAddress;
-					isGameHost = __builtin_memcmp(&v6->sin6_addr, &in6->sin6_addr, sizeof(v6->sin6_addr)) == 0 && v4->sin_port == in6->sin6_port;
-				}
-			}
-
-			struct Client* client;
-
-			u16 idx = clients.head;
-			while (idx != (u16)-1) {
-				client = &clients.data[idx];
-
-				if (address.ss_family == client->family) {
-					if (address.ss_family == AF_INET) {
-						if (__builtin_memcmp(&client->ip.v4, &v4->sin_addr, sizeof(v4->sin_addr)) == 0 && client->port == v4->sin_port)
-							goto found;
-					} else {
-						if (__builtin_memcmp(&client->ip.v6, &v6->sin6_addr, sizeof(v6->sin6_addr)) == 0 && client->port == v6->sin6_port)
-							goto found;
-					}
-				}
-
-				idx = client->next;
-			}
-
-			if (clients.firstFree == (u16)-1)
-				idx = clients.count++;
-			else {
-				idx = clients.firstFree;
-				clients.firstFree = clients.data[clients.firstFree].next;
-			}
-
-			client = &clients.data[idx];
-			client->next = clients.head;
-			clients.head = idx;
-
-			client->family = address.ss_family;
-			if (address.ss_family == AF_INET) {
-				__builtin_memcpy(&client->ip.v4, &v4->sin_addr, sizeof(v4->sin_addr));
-				client->port = v4->sin_port;
-			} else {
-				__builtin_memcpy(&client->ip.v6, &v6->sin6_addr, sizeof(v6->sin6_addr));
-				client->port = v6->sin6_port;
-			}
-
-		found:
-			switch (buff[0]) {
-				case 0x00: // receive room list
-					if (isServer) {
-						roomList.childCount = 1 + (u8)buff[1];
-
-						for (u16 i = 0; i < roomList.childCount; i++) {
-							__builtin_memcpy(&rooms[i], &buff[2 + i * sizeof(struct Room)], sizeof(struct Room));
-
-							roomList.children[1 + i].text = rooms[i].description;
-						}
-					}
-					break;
-				case 0x01:
-					// if (isGameHost)
-					// 	__builtin_memcpy(&playerID, &buff[1], sizeof(u16));
-					break;
-				case 0x02:
-					if (isGameHost) {
-						u16 entityCount;
-	            		__builtin_memcpy(&entityCount, &buff[1], sizeof(u16));
-
-						for (u16 i = 0, j = 3; i < entityCount; i++, j += 14) {
-							u16 id = (u16)(buff[j] << 8 | buff[j + 1]);
-
-							// if (id != playerID)
-							// 	__builtin_memcpy(&entities.data[id].position, &buff[2], 3 * sizeof(u32));
-
-							entities.data[id].next = entities.head;
-							entities.head = id;
-						}
-					}
-					break;
-			}
-		}
-
-		LARGE_INTEGER counter;
-		if (!QueryPerformanceCounter(&counter))
-			win32Fatal("QueryPerformanceCounter", GetLastError());
-
-		i64 countsElapsed = counter.QuadPart - start.QuadPart;
-
-		u32 now = (u32)((countsElapsed * 1000) / frequency.QuadPart);
+		u32 now = (u32)(nsElapsed / 1000000);
 		deltaTime = (float)(now - msElapsed) / 1000;
 		msElapsed = now;
 
-		i64 countsPerTick = frequency.QuadPart / TICKS_PER_SECOND;
-		i64 targetTicks = countsElapsed / countsPerTick;
-		float alpha = (float)(countsElapsed % countsPerTick) / (float)countsPerTick;
-
-		while (ticksElapsed < targetTicks) {
-			// grid.elementCount = 0;
-			// for (u32 i = 0; i < 256 * 256; i++)
-			// 	grid.cells[i].head = (u16)-1;
-
-			u16 idx = entities.head;
-			while (idx != (u16)-1) {
-				struct Entity* entity = &entities.data[idx];
-
-				if (entity->flags & ENTITY_IS_PLAYER_CONTROLLED && cursorLocked) {
-					bool forward = keys[settings.keyBindings[INPUT_FORWARD].primary] || keys[settings.keyBindings[INPUT_FORWARD].secondary];
-					bool left = keys[settings.keyBindings[INPUT_LEFT].primary] || keys[settings.keyBindings[INPUT_LEFT].secondary];
-					bool down = keys[settings.keyBindings[INPUT_DOWN].primary] || keys[settings.keyBindings[INPUT_DOWN].secondary];
-					bool right = keys[settings.keyBindings[INPUT_RIGHT].primary] || keys[settings.keyBindings[INPUT_RIGHT].secondary];
-
-					entity->yaw = camera.yaw;
-
-					vec3 acceleration = { 0, 0, 0 };
+		struct PlayerInput input = { .yaw = radToBinaryAngle(camera.yaw) };
 
-					if (forward && !down)
-						acceleration -= (vec3){ camera.forward.x, 0.f, camera.forward.z };
-					else if (down && !forward)
-						acceleration += (vec3){ camera.forward.x, 0.f, camera.forward.z };
+		if (cursorLocked) {
+			bool forward = keys[settings.keyBindings[INPUT_FORWARD].primary] || keys[settings.keyBindings[INPUT_FORWARD].secondary];
+			bool left = keys[settings.keyBindings[INPUT_LEFT].primary] || keys[settings.keyBindings[INPUT_LEFT].secondary];
+			bool down = keys[settings.keyBindings[INPUT_DOWN].primary] || keys[settings.keyBindings[INPUT_DOWN].secondary];
+			bool right = keys[settings.keyBindings[INPUT_RIGHT].primary] || keys[settings.keyBindings[INPUT_RIGHT].secondary];
 
-					if (left && !right)
-						acceleration -= (vec3){ camera.right.x, 0.f, camera.right.z };
-					else if (right && !left)
-						acceleration += (vec3){ camera.right.x, 0.f, camera.right.z };
-
-					entity->velocity += acceleration * entity->speed;
-				}
-
-				// static i32 drag = 0x0000F000;
-				// entity->velocity *= drag;
-				// entity->position += entity->velocity;
-
-				// if (entity->position.x + entity->radius > UINT16_MAX) {
-				// 	entity->position.x = UINT16_MAX - entity->radius;
-				// 	entity->velocity.x = 0;
-				// } else if (entity->position.x < entity->radius) {
-				// 	entity->position.x = entity->radius;
-				// 	entity->velocity.x = 0;
-				// }
-
-				// if (entity->position.y + entity->radius > UINT16_MAX) {
-				// 	entity->position.y = UINT16_MAX - entity->radius;
-				// 	entity->velocity.y = 0;
-				// } else if (entity->position.y < entity->radius) {
-				// 	entity->position.y = entity->radius;
-				// 	entity->velocity.y = 0;
-				// }
-
-				// if (entity->position.z + entity->radius > UINT16_MAX) {
-				// 	entity->position.z = UINT16_MAX - entity->radius;
-				// 	entity->velocity.z = 0;
-				// } else if (entity->position.z < entity->radius) {
-				// 	entity->position.z = entity->radius;
-				// 	entity->velocity.z = 0;
-				// }
-
-				if (entity->flags & ENTITY_IS_PLAYER_CONTROLLED) {
-					char buff[17];
-
-					buff[0] = 0x00;
-					__builtin_memcpy(&buff[1], &entity->yaw, sizeof(entity->yaw));
-					__builtin_memcpy(&buff[5], &entity->position, 3 * sizeof(u32));
-
-					if (sendto(sock, buff, sizeof(buff), 0, (struct sockaddr*)&serverAddress, sizeof(serverAddress)) == SOCKET_ERROR)
-						win32Fatal("sendto", (DWORD)WSAGetLastError());
-				}
-
-				// float magnitude = vec3Length(entity->velocity);
-				// if (magnitude > 0.f) {
-				// 	float co = 0.1f;
-				// 	float friction = co * magnitude;
-				// 	entity->velocity += friction * -entity->velocity / magnitude;
-				// }
-
-				idx = entity->next;
-			}
-
-			ticksElapsed++;
+			input.buttons = (forward ? PLAYER_FORWARD : 0) | (left ? PLAYER_LEFT : 0) | (down ? PLAYER_BACK : 0) | (right ? PLAYER_RIGHT : 0);
 		}
 
-		UINT32 padding;
-		if (FAILED(hr = audioClient->lpVtbl->GetCurrentPadding(audioClient, &padding)))
-			win32Fatal("GetCurrentPadding", (DWORD)hr);
+		__atomic_store_n(&simulationInput, (u32)input.buttons << 16 | input.yaw, __ATOMIC_RELAXED);
 
-		UINT32 framesAvailable = audioBufferSize - padding;
+		float alpha;
+		const struct WorldState* state = worldAcquire(nsElapsed, &alpha);
 
-		INT16* audioBuffer;
-		if (FAILED(hr = audioRenderClient->lpVtbl->GetBuffer(audioRenderClient, framesAvailable, (BYTE**)&audioBuffer)))
-			win32Fatal("GetBuffer", (DWORD)hr);
+		u32 framesAvailable;
+		i16* audioBuffer = platformAudioAcquire(&framesAvailable);
 
-		for (UINT32 i = 0; i < framesAvailable; i++) {
+		for (u32 i = 0; i < framesAvailable; i++) {
 			*audioBuffer++ = 0; // left
 			*audioBuffer++ = 0; // right
 		}
 
-		if (FAILED(hr = audioRenderClient->lpVtbl->ReleaseBuffer(audioRenderClient, framesAvailable, 0)))
-			win32Fatal("ReleaseBuffer", (DWORD)hr);
-
-		indices2D = buffers[BUFFER_FRAME].data + BUFFER_OFFSET_INDICES_2D + frame * BUFFER_RANGE_INDICES_2D;
-		vertices2D = buffers[BUFFER_FRAME].data + BUFFER_OFFSET_VERTICES_2D + frame * BUFFER_RANGE_VERTICES_2D;
-		verticesText = buffers[BUFFER_FRAME].data + BUFFER_OFFSET_TEXT + frame * BUFFER_RANGE_TEXT;
-		modelMatrices = buffers[BUFFER_FRAME].data + BUFFER_OFFSET_MODEL_MATRICES + frame * BUFFER_RANGE_MODEL_MATRICES;
+		platformAudioRelease(framesAvailable);
 
-		indices2DCount = 0;
-		vertices2DCount = 0;
-		verticesTextCount = 0;
-		modelMatricesCount = 0;
+		streamsBeginFrame();
+		drawBeginFrame();
 
-		vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, 0, 1, &descriptorSet, 0, NULL);
-		vkCmdBindVertexBuffers(commandBuffer, 0, 5, (VkBuffer[]){
-			buffers[BUFFER_FRAME].handle,
-			buffers[BUFFER_FRAME].handle,
+		vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, 0, 1, &descriptorSet, 1, &(u32){ frame * BUFFER_RANGE_INSTANCES });
+		// bindings 0 and 1 follow the 2D and text streams as they move between chunks
+		vkCmdBindVertexBuffers(commandBuffer, 2, 3, (VkBuffer[]){
 			buffers[BUFFER_FRAME].handle,
 			buffers[BUFFER_DEVICE].handle,
 			buffers[BUFFER_DEVICE].handle,
 		}, (VkDeviceSize[]){
-			BUFFER_OFFSET_VERTICES_2D + frame * BUFFER_RANGE_VERTICES_2D,
-			BUFFER_OFFSET_TEXT + frame * BUFFER_RANGE_TEXT,
 			BUFFER_OFFSET_MODEL_MATRICES + frame * BUFFER_RANGE_MODEL_MATRICES,
 			BUFFER_OFFSET_VERTEX_POSITIONS,
 			BUFFER_OFFSET_VERTEX_ATTRIBUTES
@@ -2383,13 +2227,13 @@ __attribute__((noreturn)) void WinMainCRTStartup(void) {
 				setTransform(mat4From2DAffine(1.f, 0.f, 0.f, 1.f, (float)windowWidth / 2, (float)windowHeight / 2));
 				beginPath();
 				arc(0.f, 0.f, radius, 0.f, M_PI * 2.f);
-				clip();
+				clip(FILL_RULE_NONZERO);
 
 				stencilReference = 1;
 			}
 
-			// uvec3 camPos = entities.data[playerID].position >> 16; // + alpha * entities.data[playerID].velocity;
-			drawScene(camera.position, camera.right, camera.up, camera.forward, stencilReference);
+			flush2D();
+			drawScene(state, alpha, camera.position, camera.right, camera.up, camera.forward, stencilReference);
 
 			vkCmdSetStencilReference(commandBuffer, VK_STENCIL_FACE_FRONT_AND_BACK, 0);
 
@@ -2404,6 +2248,7 @@ __attribute__((noreturn)) void WinMainCRTStartup(void) {
 		drawUINode(&discordButton);
 		drawUINode(&settingsButton);
 		drawUINode(&exitButton);
+		frameStatsDraw();
 
 		if (lButtonDown && !clickedElement && !cursorLocked && radius == transitionCircle.new && radius > 0) {
 			cursorLocked = TRUE;
@@ -2411,7 +2256,11 @@ __attribute__((noreturn)) void WinMainCRTStartup(void) {
 		} else
 			SetCursor(cursor);
 
+		flush2D();
 		vkCmdEndRenderPass(commandBuffer);
+		ringEndFrame(&frameRing);
+		frameStatsCollect();
+
 		if ((r = vkEndCommandBuffer(commandBuffer)) != VK_SUCCESS)
 			vkFatal("vkEndCommandBuffer", r);
 
@@ -0,0 +1,252 @@
+#pragma once
+
+#include "assets.h"
+#include "jobs.h"
+
+// mesh elements are queued as a scene pass walks its nodes, then grouped by primitive and material so each group is
+// one indirect draw over consecutive instances; per-instance material data goes to a storage buffer, not push constants
+#define DRAW_MAX_INSTANCES (BUFFER_RANGE_MODEL_MATRICES / sizeof(mat4))
+#define DRAW_MAX_COMMANDS (BUFFER_RANGE_DRAW_COMMANDS / sizeof(VkDrawIndexedIndirectCommand))
+#define DRAW_BUCKETS (_countof(primitives) * _countof(materials))
+
+// workers claim queue slots a block at a time so the shared counter is touched rarely
+#define DRAW_BLOCK 64
+#define DRAW_MAX_BLOCKS (DRAW_MAX_INSTANCES / DRAW_BLOCK)
+
+#define DRAW_PARALLEL_SCATTER 2048 // fewer instances than this are cheaper to cull and scatter than to wake the pool for
+#define DRAW_BODY_BATCH 32
+
+static mat4* modelMatrices;
+static u32 modelMatricesCount;
+
+static struct ShaderInstance* shaderInstances;
+
+// both command layouts share one stride, VkDrawIndirectCommand just leaves the last field unused
+static VkDrawIndexedIndirectCommand* drawCommands;
+static u32 drawCommandsCount;
+
+#define DRAW_KEY_CULLED UINT16_MAX
+
+// what one worker queued: its blocks and how many elements it put in each bucket, which become its write offsets
+struct DrawList {
+	u32 counts[DRAW_BUCKETS];
+	u16 blocks[DRAW_MAX_BLOCKS];
+	u16 blockCount;
+	u16 used; // slots filled in the newest block
+	u32 culled;
+};
+
+static struct {
+	mat4 models[DRAW_MAX_INSTANCES];
+	mat3 normalMatrices[DRAW_MAX_INSTANCES];
+	u16 keys[DRAW_MAX_INSTANCES];
+	u32 reserved;
+
+	// world-space bounding box of each element as center and half extent, laid out for testing 8 at a time
+	__attribute__((aligned(32))) float centers[3][DRAW_MAX_INSTANCES];
+	__attribute__((aligned(32))) float extents[3][DRAW_MAX_INSTANCES];
+
+	vec4 planes[6]; // xyz inward normal, w distance
+	struct DrawList lists[JOB_MAX_WORKERS];
+
+	// this frame: indirect draws recorded, elements kept and elements outside the frustum
+	u32 draws;
+	u32 visible;
+	u32 culled;
+} drawQueue;
+
+static inline void drawBeginFrame(void) {
+	modelMatrices = buffers[BUFFER_FRAME].data + BUFFER_OFFSET_MODEL_MATRICES + frame * BUFFER_RANGE_MODEL_MATRICES;
+	shaderInstances = buffers[BUFFER_FRAME].data + BUFFER_OFFSET_INSTANCES + frame * BUFFER_RANGE_INSTANCES;
+	drawCommands = buffers[BUFFER_FRAME].data + BUFFER_OFFSET_DRAW_COMMANDS + frame * BUFFER_RANGE_DRAW_COMMANDS;
+
+	modelMatricesCount = 0;
+	drawCommandsCount = 0;
+	drawQueue.draws = 0;
+	drawQueue.visible = 0;
+	drawQueue.culled = 0;
+}
+
+// transform places the unit primitive, elements past what the frame's buffers can hold are dropped; safe to call from
+// any number of workers at once as long as each passes its own index
+static inline void drawPrimitive(u32 worker, enum Primitives primitive, enum Materials material, mat4 transform, mat3 normalMatrix) {
+	struct DrawList* list = &drawQueue.lists[worker];
+
+	if (!list->blockCount || list->used == DRAW_BLOCK) {
+		u32 first = __atomic_fetch_add(&drawQueue.reserved, DRAW_BLOCK, __ATOMIC_RELAXED);
+		if (first + DRAW_BLOCK > DRAW_MAX_INSTANCES - modelMatricesCount)
+			return;
+
+		list->blocks[list->blockCount++] = (u16)(first / DRAW_BLOCK);
+		list->used = 0;
+	}
+
+	u32 i = list->blocks[list->blockCount - 1] * DRAW_BLOCK + list->used++;
+	u16 key = (u16)(primitive * _countof(materials) + material);
+
+	mat4 model = mat4TranslateScale(transform, primitives[primitive].min, primitives[primitive].max - primitives[primitive].min);
+
+	// the model matrix maps the primitive's unit box into the world
+	for (u8 axis = 0; axis < 3; axis++) {
+		drawQueue.centers[axis][i] = model[axis][3] + .5f * (model[axis][0] + model[axis][1] + model[axis][2]);
+		drawQueue.extents[axis][i] = .5f * (__builtin_fabsf(model[axis][0]) + __builtin_fabsf(model[axis][1]) + __builtin_fabsf(model[axis][2]));
+	}
+
+	drawQueue.models[i] = model;
+	drawQueue.normalMatrices[i] = normalMatrix;
+	drawQueue.keys[i] = key;
+	list->counts[key]++;
+}
+
+// marks every element of a list whose box is wholly outside one of the frustum planes and takes it out of the counts
+static inline void drawCull(void*, u32 first, u32 count, u32) {
+	for (u32 l = first; l < first + count; l++) {
+		struct DrawList* list = &drawQueue.lists[l];
+
+		for (u16 b = 0; b < list->blockCount; b++) {
+			u32 start = list->blocks[b] * DRAW_BLOCK;
+			u32 end = start + (b == list->blockCount - 1 ? list->used : DRAW_BLOCK);
+
+			// a partly filled block's tail is tested along with the rest and ignored
+			for (u32 i = start; i < end; i += 8) {
+				vec8 cx = *(vec8*)&drawQueue.centers[0][i];
+				vec8 cy = *(vec8*)&drawQueue.centers[1][i];
+				vec8 cz = *(vec8*)&drawQueue.centers[2][i];
+				vec8 ex = *(vec8*)&drawQueue.extents[0][i];
+				vec8 ey = *(vec8*)&drawQueue.extents[1][i];
+				vec8 ez = *(vec8*)&drawQueue.extents[2][i];
+
+				ivec8 outside = { };
+				for (u8 p = 0; p < 6; p++) {
+					vec4 plane = drawQueue.planes[p];
+					vec8 distance = cx * plane.x + cy * plane.y + cz * plane.z + plane.w;
+					vec8 radius = ex * __builtin_fabsf(plane.x) + ey * __builtin_fabsf(plane.y) + ez * __builtin_fabsf(plane.z);
+					outside |= distance + radius < 0.f;
+				}
+
+				for (u32 j = 0; j < 8 && i + j < end; j++) {
+					if (!outside[j])
+						continue;
+
+					list->counts[drawQueue.keys[i + j]]--;
+					drawQueue.keys[i + j] = DRAW_KEY_CULLED;
+					list->culled++;
+				}
+			}
+		}
+	}
+}
+
+// each list writes only the instance slots its offsets were given, so lists scatter in parallel
+static inline void drawScatter(void*, u32 first, u32 count, u32) {
+	for (u32 l = first; l < first + count; l++) {
+		struct DrawList* list = &drawQueue.lists[l];
+
+		for (u16 b = 0; b < list->blockCount; b++) {
+			u32 start = list->blocks[b] * DRAW_BLOCK;
+			u32 end = start + (b == list->blockCount - 1 ? list->used : DRAW_BLOCK);
+
+			for (u32 i = start; i < end; i++) {
+				u16 key = drawQueue.keys[i];
+				if (key == DRAW_KEY_CULLED)
+					continue;
+
+				struct Material* material = &materials[key % _countof(materials)];
+				u32 instance = list->counts[key]++;
+
+				modelMatrices[instance] = drawQueue.models[i];
+				shaderInstances[instance] = (struct ShaderInstance){
+					.normalMatrix = drawQueue.normalMatrices[i],
+					.color = { material->rgba.r / 255.f, material->rgba.g / 255.f, material->rgba.b / 255.f, material->rgba.a / 255.f },
+					.colorIndex = material->color,
+					.normalIndex = material->normal
+				};
+			}
+		}
+	}
+}
+
+// culls what the workers queued against the view, merges their lists into the frame's instance buffers grouped by key
+// and records one draw per group
+static inline void drawFlush(mat4 viewProjection) {
+	// planes from sums and differences of the clip-space rows; reversed depth puts near at z = w and far at z = 0
+	vec4 rows[4];
+	for (u8 r = 0; r < 4; r++)
+		rows[r] = (vec4){ viewProjection[r][0], viewProjection[r][1], viewProjection[r][2], viewProjection[r][3] };
+
+	drawQueue.planes[0] = rows[3] + rows[0];
+	drawQueue.planes[1] = rows[3] - rows[0];
+	drawQueue.planes[2] = rows[3] + rows[1];
+	drawQueue.planes[3] = rows[3] - rows[1];
+	drawQueue.planes[4] = rows[3] - rows[2];
+	drawQueue.planes[5] = rows[2];
+
+	bool parallel = drawQueue.reserved >= DRAW_PARALLEL_SCATTER;
+
+	if (parallel)
+		jobsParallelFor(0, drawCull, NULL, JOB_MAX_WORKERS, 1);
+	else
+		drawCull(NULL, 0, JOB_MAX_WORKERS, 0);
+
+	u32 firsts[DRAW_BUCKETS];
+	u32 first = modelMatricesCount;
+
+	// a bucket's instances are laid out list after list, turning each list's counts into its write offsets
+	for (u16 key = 0; key < DRAW_BUCKETS; key++) {
+		firsts[key] = first;
+
+		for (u32 l = 0; l < JOB_MAX_WORKERS; l++) {
+			u32 count = drawQueue.lists[l].counts[key];
+			drawQueue.lists[l].counts[key] = first;
+			first += count;
+		}
+	}
+
+	if (parallel)
+		jobsParallelFor(0, drawScatter, NULL, JOB_MAX_WORKERS, 1);
+	else
+		drawScatter(NULL, 0, JOB_MAX_WORKERS, 0);
+
+	for (u32 l = 0; l < JOB_MAX_WORKERS; l++)
+		drawQueue.culled += drawQueue.lists[l].culled;
+
+	drawQueue.visible += first - modelMatricesCount;
+
+	for (u16 key = 0; key < DRAW_BUCKETS && drawCommandsCount < DRAW_MAX_COMMANDS; key++) {
+		u32 end = key + 1 < DRAW_BUCKETS ? firsts[key + 1] : first;
+		u32 instanceCount = end - firsts[key];
+		if (!instanceCount)
+			continue;
+
+		struct Primitive* primitive = &primitives[key / _countof(materials)];
+		VkDrawIndexedIndirectCommand* command = &drawCommands[drawCommandsCount++];
+		VkDeviceSize offset = (u8*)command - (u8*)buffers[BUFFER_FRAME].data;
+
+		if (primitive->indexed) {
+			*command = (VkDrawIndexedIndirectCommand){
+				.indexCount = primitive->indexCount,
+				.instanceCount = instanceCount,
+				.firstIndex = primitive->firstIndex,
+				.vertexOffset = primitive->vertexOffset,
+				.firstInstance = firsts[key]
+			};
+
+			vkCmdDrawIndexedIndirect(commandBuffer, buffers[BUFFER_FRAME].handle, offset, 1, sizeof(VkDrawIndexedIndirectCommand));
+		} else {
+			*(VkDrawIndirectCommand*)command = (VkDrawIndirectCommand){
+				.vertexCount = primitive->vertexCount,
+				.instanceCount = instanceCount,
+				.firstVertex = primitive->firstVertex,
+				.firstInstance = firsts[key]
+			};
+
+			vkCmdDrawIndirect(commandBuffer, buffers[BUFFER_FRAME].handle, offset, 1, sizeof(VkDrawIndirectCommand));
+		}
+
+		drawQueue.draws++;
+	}
+
+	modelMatricesCount = first;
+	drawQueue.reserved = 0;
+	__builtin_memset(drawQueue.lists, 0, sizeof(drawQueue.lists));
+}
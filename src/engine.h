@@ -1,9 +1,5 @@
-#pragma comment(lib, "kernel32.lib")
-#pragma comment(lib, "user32.lib")
-#pragma comment(lib, "ws2_32.lib")
 #pragma comment(lib, "shell32.lib")
 #pragma comment(lib, "ucrt.lib")
-#pragma comment(lib, "ole32.lib")
 #pragma comment(lib, "vcruntime.lib")
 
 #define VK_USE_PLATFORM_WIN32_KHR
@@ -17,14 +13,10 @@
 #include "vulkan/vulkan.h"
 #include <windowsx.h>
 #include "hidusage.h"
-#include <WinSock2.h>
-#include <WS2tcpip.h>
 #include <shellapi.h>
-#include <mmdeviceapi.h>
-#include <Audioclient.h>
 #include <stdio.h>
 
-#include "math.h"
+#include "platform.h"
 
 #define FRAMES_IN_FLIGHT 2
 
@@ -84,6 +76,7 @@
 	F(vkCreateSemaphore) \
 	F(vkCreateShaderModule) \
 	F(vkCreateSwapchainKHR) \
+	F(vkDestroyBuffer) \
 	F(vkEndCommandBuffer) \
 	F(vkGetBufferMemoryRequirements) \
 	F(vkGetDeviceQueue) \
@@ -98,19 +91,6 @@
 	F(vkUpdateDescriptorSets) \
 	F(vkWaitForFences)
 
-#define INCBIN(name, file) \
-	__asm__(".section .rdata, \"dr\"\n" \
-			".global incbin_" #name "_start\n" \
-			".balign 16\n" \
-			"incbin_" #name "_start:\n" \
-			".incbin \"" file "\"\n" \
-			".global incbin_" #name "_end\n" \
-			".balign 1\n" \
-			"incbin_" #name "_end:\n" \
-	); \
-	extern __attribute__((aligned(16))) const char incbin_ ## name ## _start[]; \
-	extern const char incbin_ ## name ## _end[]
-
 enum AnimationTarget : u16 {
 	ANIMATION_TARGET_TRANSLATION,
 	ANIMATION_TARGET_ROTATION,
@@ -152,9 +132,18 @@ struct VertexAttributes {
 	u16 u, v;
 };
 
+// std430 layout, read by the triangle shader at gl_InstanceIndex alongside the instance's model matrix
+struct ShaderInstance {
+	mat3 normalMatrix;
+	vec4 color;
+	u32 colorIndex;
+	u32 normalIndex;
+};
+
 INCBIN(icons, "icons");
 INCBIN(textures, "textures");
 INCBIN(geometry, "geometry");
+INCBIN(font, "font");
 INCBIN(shaders, "shaders.spv");
 
 enum BufferRange {
@@ -164,9 +153,9 @@ enum BufferRange {
 	BUFFER_RANGE_VERTEX_ATTRIBUTES = 660 * sizeof(struct VertexAttributes),
 
 	BUFFER_RANGE_MODEL_MATRICES = 16 * 1024 * sizeof(mat4),
-	BUFFER_RANGE_INDICES_2D = 1024 * 1024,
-	BUFFER_RANGE_VERTICES_2D = 1024 * 1024,
-	BUFFER_RANGE_TEXT = 1024 * 1024,
+	BUFFER_RANGE_INSTANCES = 16 * 1024 * sizeof(struct ShaderInstance),
+	BUFFER_RANGE_STREAMS = 4 * 1024 * 1024, // shared by every frame in flight
+	BUFFER_RANGE_DRAW_COMMANDS = 1024 * sizeof(VkDrawIndexedIndirectCommand),
 };
 
 enum BufferOffset {
@@ -176,9 +165,9 @@ enum BufferOffset {
 	BUFFER_OFFSET_VERTEX_ATTRIBUTES = BUFFER_OFFSET_VERTEX_POSITIONS + BUFFER_RANGE_VERTEX_POSITIONS,
 
 	BUFFER_OFFSET_MODEL_MATRICES = 0,
-	BUFFER_OFFSET_INDICES_2D = BUFFER_OFFSET_MODEL_MATRICES + FRAMES_IN_FLIGHT * BUFFER_RANGE_MODEL_MATRICES,
-	BUFFER_OFFSET_VERTICES_2D = BUFFER_OFFSET_INDICES_2D + FRAMES_IN_FLIGHT * BUFFER_RANGE_INDICES_2D,
-	BUFFER_OFFSET_TEXT = BUFFER_OFFSET_VERTICES_2D + FRAMES_IN_FLIGHT * BUFFER_RANGE_VERTICES_2D,
+	BUFFER_OFFSET_INSTANCES = BUFFER_OFFSET_MODEL_MATRICES + FRAMES_IN_FLIGHT * BUFFER_RANGE_MODEL_MATRICES,
+	BUFFER_OFFSET_STREAMS = BUFFER_OFFSET_INSTANCES + FRAMES_IN_FLIGHT * BUFFER_RANGE_INSTANCES,
+	BUFFER_OFFSET_DRAW_COMMANDS = BUFFER_OFFSET_STREAMS + BUFFER_RANGE_STREAMS,
 };
 
 int _fltused;
@@ -188,6 +177,7 @@ BEFORE_INSTANCE_FUNCS(F)
 INSTANCE_FUNCS(F)
 DEVICE_FUNCS(F)
 
+static VkDevice device;
 static VkCommandBuffer commandBuffer;
 static VkPipelineLayout pipelineLayout;
 static VkSurfaceCapabilitiesKHR surfaceCapabilities;
@@ -206,9 +196,8 @@ static HANDLE cursorNormal;
 static HANDLE cursorHand;
 static HANDLE cursorBeam;
 
-static SOCKET sock;
-static struct sockaddr_in serverAddress;
-static struct sockaddr_storage gameHostAddress;
+static struct NetAddress serverAddress;
+static struct NetAddress gameHostAddress;
 static bool isHost;
 
 static u32 msElapsed;
@@ -310,14 +299,3 @@ __attribute__((noreturn)) static inline void vkFatal(const char* fn, VkResult r)
 	MessageBoxA(NULL, buff, NULL, MB_OK | MB_ICONEXCLAMATION);
 	ExitProcess(EXIT_FAILURE);
 }
-
-__attribute__((noreturn)) static inline void win32Fatal(const char* fn, DWORD err) {
-	char buff[1024];
-	if (FormatMessageA(FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS, NULL, err, MAKELANGID(LANG_NEUTRAL, SUBLANG_NEUTRAL), buff, sizeof(buff), NULL)) {
-		char buff2[1024];
-		__builtin_sprintf(buff2, "%s: %s", fn, buff);
-		MessageBoxA(NULL, buff2, NULL, MB_OK | MB_ICONEXCLAMATION);
-	}
-
-	ExitProcess(EXIT_FAILURE);
-}
@@ -1,332 +1,264 @@
-#include "2d.h"
+#pragma once
 
-typedef u32 Fixed;
-typedef i64 longDateTime;
-typedef i16 FWord;
+#include "2d.h"
+#include "ttf.h"
 
-struct TableDirectory {
-	u32	tag;
-	u32	checkSum;
-	u32	offset;
-	u32	length;
-};
+// text is laid out once into runs of quads relative to where it starts, cached on the text, its size and the width it
+// wraps at, so labels that don't change only pay for copying their quads out each frame
+#define TEXT_CACHE_RUNS 512 // power of two, dropped when three quarters full
+#define TEXT_CACHE_QUADS 16384
+#define TEXT_CACHE_CHARS 32768
 
-struct OffsetSubTable {
-	u32 scalerType;
-	u16 numTables;
-	u16 searchRange;
-	u16 entrySelector;
-	u16 rangeShift;
+struct TextQuad {
+	vec4 rect; // left, top, right, bottom in pixels from the top left of the text, y down
+	u16vec4 uv; // the same corners in the atlas, unorm
 };
 
-struct FontDirectory {
-	struct OffsetSubTable offsetSubTable;
-	struct TableDirectory tableDirectory[];
+struct TextRun {
+	u32 hash; // zero when the slot is empty
+	u32 text; // into textCache.chars
+	u32 length;
+	float size;
+	float maxWidth;
+	u32 firstQuad;
+	u32 quadCount;
+	vec2 extent; // the widest line's advance, line count times line height
 };
 
-struct __attribute__((packed)) head {
-	Fixed version;
-	Fixed fontRevision;
-	u32 checkSumAdjustment;
-	u32 magicNumber;
-	u16 flags;
-	u16 unitsPerEm;
-	longDateTime created;
-	longDateTime modified;
-	FWord xMin;
-	FWord yMin;
-	FWord xMax;
-	FWord yMax;
-	u16 macStyle;
-	u16 lowestRecPPEM;
-	i16 fontDirectionHint;
-	i16 indexToLocFormat;
-	i16 glyphDataFormat;
-};
+// open addressing with linear probing; when any of it fills up everything goes at once and whatever is still drawn
+// gets laid out again
+static struct {
+	struct TextRun runs[TEXT_CACHE_RUNS];
+	struct TextQuad quads[TEXT_CACHE_QUADS];
+	char chars[TEXT_CACHE_CHARS];
+	u32 runCount;
+	u32 quadCount;
+	u32 charCount;
 
-struct cmapEncodingSubtable {
-	u16 platformID;
-	u16 platformSpecificID;
-	u32 offset;
-};
-
-struct cmap {
-	u16 version;
-	u16 numberSubtables;
-	struct cmapEncodingSubtable subtables[];
-};
+	u32 hits;
+	u32 misses;
+} textCache;
 
-struct format4 {
-	u16 format;
-	u16 length;
-	u16 language;
-	u16 segCountX2;
-	u16 searchRange;
-	u16 entrySelector;
-	u16 rangeShift;
-	u16 endCode[]; // [segCountX2 / 2];
-	// u16 reservedPad;
-	// u16 startCode[segCountX2 / 2];
-	// u16 idDelta[segCountX2 / 2];
-	// u16 idRangeOffset[segCountX2 / 2];
-	// u16 glyphIdArray[segCountX2 / 2];
-};
+// baked by assets.c, metrics first and then the atlas rows
+static const struct FontAtlas* fontAtlas = (const struct FontAtlas*)incbin_font_start;
 
-struct GlyphDescription {
-	i16 numberOfContours;
-	FWord xMin;
-	FWord yMin;
-	FWord xMax;
-	FWord yMax;
-};
+// copies the atlas into the font image's staging memory and returns how many rows to upload
+static inline u32 loadFontAtlas(u8* imageData) {
+	__builtin_memcpy(imageData, incbin_font_start + sizeof(struct FontAtlas), (u32)fontAtlas->width * fontAtlas->rows);
 
-struct GlyphFlags {
-	u8 onCurve : 1;
-	u8 xShort : 1;
-	u8 yShort : 1;
-	u8 repeat : 1;
-	u8 xShortPos : 1;
-	u8 yShortPos : 1;
-};
+	return fontAtlas->rows;
+}
 
-// struct SimpleGlyph {
-// 	u16 endPtsOfContours[];
-//	u16 instructionLength;
-//	u8 instructions[instructionLength];
-//	u8 flags[variable];
-//	u8|u16 xCoordinates[];
-//	u8|u16 yCoordinates[];
-// };
-
-static inline void createFontBitmap(u8* imageData) {
-	HANDLE consola;
-	if (!(consola = CreateFileW(L"C:/Windows/Fonts/consola.ttf", GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL)))
-		win32Fatal("CreateFileW", GetLastError());
-
-	LARGE_INTEGER fileSize;
-	if (!GetFileSizeEx(consola, &fileSize))
-		win32Fatal("GetFileSizeEx", GetLastError());
-
-	static char buff[1 << 19];
-
-	DWORD bytesRead;
-	if (!ReadFile(consola, buff, (DWORD)fileSize.QuadPart, &bytesRead, NULL))
-		win32Fatal("ReadFile", GetLastError());
-
-	struct FontDirectory* fontDirectory = (struct FontDirectory*)buff;
-
-	fontDirectory->offsetSubTable.scalerType = __builtin_bswap32(fontDirectory->offsetSubTable.scalerType);
-	fontDirectory->offsetSubTable.numTables = __builtin_bswap16(fontDirectory->offsetSubTable.numTables);
-	fontDirectory->offsetSubTable.searchRange = __builtin_bswap16(fontDirectory->offsetSubTable.searchRange);
-	fontDirectory->offsetSubTable.entrySelector = __builtin_bswap16(fontDirectory->offsetSubTable.entrySelector);
-	fontDirectory->offsetSubTable.rangeShift = __builtin_bswap16(fontDirectory->offsetSubTable.rangeShift);
-
-	char* glyf;
-	void* loca;
-	struct head* head;
-	struct cmap* cmap;
-
-	for (u16 i = 0; i < fontDirectory->offsetSubTable.numTables; i++) {
-		fontDirectory->tableDirectory[i].tag = __builtin_bswap32(fontDirectory->tableDirectory[i].tag);
-		fontDirectory->tableDirectory[i].checkSum = __builtin_bswap32(fontDirectory->tableDirectory[i].checkSum);
-		fontDirectory->tableDirectory[i].offset = __builtin_bswap32(fontDirectory->tableDirectory[i].offset);
-		fontDirectory->tableDirectory[i].length = __builtin_bswap32(fontDirectory->tableDirectory[i].length);
-
-		switch (fontDirectory->tableDirectory[i].tag) {
-			case 'glyf':
-				glyf = buff + fontDirectory->tableDirectory[i].offset;
-				break;
-			case 'loca':
-				loca = buff + fontDirectory->tableDirectory[i].offset;
-				break;
-			case 'head':
-				head = (struct head*)__builtin_assume_aligned(buff + fontDirectory->tableDirectory[i].offset, alignof(struct head));
-				head->version = __builtin_bswap32(head->version);
-				head->fontRevision = __builtin_bswap32(head->fontRevision);
-				head->checkSumAdjustment = __builtin_bswap32(head->checkSumAdjustment);
-				head->magicNumber = __builtin_bswap32(head->magicNumber);
-				head->flags = __builtin_bswap16(head->flags);
-				head->unitsPerEm = __builtin_bswap16(head->unitsPerEm);
-				head->created = (i64)__builtin_bswap64((u64)head->created);
-				head->modified = (i64)__builtin_bswap64((u64)head->modified);
-				head->xMin = (i16)__builtin_bswap16((u16)head->xMin);
-				head->yMin = (i16)__builtin_bswap16((u16)head->yMin);
-				head->xMax = (i16)__builtin_bswap16((u16)head->xMax);
-				head->yMax = (i16)__builtin_bswap16((u16)head->yMax);
-				head->macStyle = __builtin_bswap16(head->macStyle);
-				head->lowestRecPPEM = __builtin_bswap16(head->lowestRecPPEM);
-				head->fontDirectionHint = (i16)__builtin_bswap16((u16)head->fontDirectionHint);
-				head->indexToLocFormat = (i16)__builtin_bswap16((u16)head->indexToLocFormat);
-				head->glyphDataFormat = (i16)__builtin_bswap16((u16)head->glyphDataFormat);
-				break;
-			case 'cmap':
-				cmap = (struct cmap*)__builtin_assume_aligned(buff + fontDirectory->tableDirectory[i].offset, alignof(struct cmap));
-				cmap->version = __builtin_bswap16(cmap->version);
-				cmap->numberSubtables = __builtin_bswap16(cmap->numberSubtables);
-				break;
-		}
+static inline u32 textHash(const char* text, u32 length, float size, float maxWidth) {
+	u32 h = 2166136261u;
+	for (u32 i = 0; i < length; i++)
+		h = (h ^ (u8)text[i]) * 16777619u;
+
+	u32 bits[2];
+	__builtin_memcpy(&bits[0], &size, sizeof(float));
+	__builtin_memcpy(&bits[1], &maxWidth, sizeof(float));
+
+	for (u32 i = 0; i < 2; i++) {
+		h ^= bits[i];
+		h ^= h >> 16;
+		h *= 0x7feb352d;
+		h ^= h >> 15;
+		h *= 0x846ca68b;
+		h ^= h >> 16;
 	}
 
-	struct format4* f4;
-	u16* reservedPad;
-	u16* startCode;
-	u16* idDelta;
-	u16* idRangeOffset;
-	u16* glyphIdArray;
-
-	u16 glyphCount;
-
-	for (u16 i = 0; i < cmap->numberSubtables; i++) {
-		cmap->subtables[i].platformID = __builtin_bswap16(cmap->subtables[i].platformID);
-		cmap->subtables[i].platformSpecificID = __builtin_bswap16(cmap->subtables[i].platformSpecificID);
-		cmap->subtables[i].offset = __builtin_bswap32(cmap->subtables[i].offset);
-
-		f4 = (void*)((char*)cmap + cmap->subtables[i].offset);
-		f4->format = __builtin_bswap16(f4->format);
-
-		if (cmap->subtables[i].platformID == 0 && cmap->subtables[i].platformSpecificID == 3 && f4->format == 4) {
-			f4->length = __builtin_bswap16(f4->length);
-			f4->language = __builtin_bswap16(f4->language);
-			f4->segCountX2 = __builtin_bswap16(f4->segCountX2);
-			f4->searchRange = __builtin_bswap16(f4->searchRange);
-			f4->entrySelector = __builtin_bswap16(f4->entrySelector);
-			f4->rangeShift = __builtin_bswap16(f4->rangeShift);
-
-			reservedPad = f4->endCode + f4->segCountX2 / 2;
-			startCode = reservedPad + 1;
-			idDelta = startCode + f4->segCountX2 / 2;
-			idRangeOffset = idDelta + f4->segCountX2 / 2;
-			glyphIdArray = idRangeOffset + f4->segCountX2 / 2;
-
-			for (u16 j = 0; j < f4->segCountX2 / 2; j++) {
-				f4->endCode[j] = __builtin_bswap16(f4->endCode[j]);
-				startCode[j] = __builtin_bswap16(startCode[j]);
-				idDelta[j] = __builtin_bswap16(idDelta[j]);
-				idRangeOffset[j] = __builtin_bswap16(idRangeOffset[j]);
-			}
-
-			glyphCount = (f4->length - (u16)((char*)glyphIdArray - (char*)f4)) / 2;
-
-			for (u16 j = 0; j < glyphCount; j++)
-				glyphIdArray[j] = __builtin_bswap16(glyphIdArray[j]);
+	return h ? h : 1;
+}
 
+// size is pixels per em; a nonzero maxWidth breaks lines at the last space before a glyph would pass it. Anything
+// outside printable ASCII draws as '?'. The run is only good until the next call.
+static inline const struct TextRun* layoutText(const char* text, float size, float maxWidth) {
+	// at most a quad a character, so clamping to both keeps a single run inside the emptied cache
+	u32 length = __builtin_elementwise_min((u32)__builtin_strlen(text), __builtin_elementwise_min((u32)TEXT_CACHE_CHARS - 1, (u32)TEXT_CACHE_QUADS));
+	u32 hash = textHash(text, length, size, maxWidth);
+
+	u32 slot = hash & (TEXT_CACHE_RUNS - 1);
+	for (;; slot = (slot + 1) & (TEXT_CACHE_RUNS - 1)) {
+		struct TextRun* run = &textCache.runs[slot];
+		if (!run->hash)
 			break;
+
+		if (run->hash == hash && run->length == length && run->size == size && run->maxWidth == maxWidth && !__builtin_memcmp(textCache.chars + run->text, text, length)) {
+			textCache.hits++;
+			return run;
 		}
 	}
 
-	u16 codePoint = 'A';
+	textCache.misses++;
 
-	u16 glyphIndex;
+	if (4 * (textCache.runCount + 1) > 3 * TEXT_CACHE_RUNS || textCache.quadCount + length > TEXT_CACHE_QUADS || textCache.charCount + length > TEXT_CACHE_CHARS) {
+		__builtin_memset(textCache.runs, 0, sizeof(textCache.runs));
+		textCache.runCount = 0;
+		textCache.quadCount = 0;
+		textCache.charCount = 0;
 
-	u16 index = (u16)-1;
-	u16 *ptr = NULL;
-	for (u16 i = 0; i < f4->segCountX2 / 2; i++)
-		if (f4->endCode[i] > codePoint) {
-			index = i;
-
-			if (startCode[index] < codePoint) {
-				if (idRangeOffset[index] != 0) {
-					ptr = idRangeOffset + index + idRangeOffset[index] / 2;
-					ptr += codePoint - startCode[index];
-
-					if (*ptr == 0) {
-						glyphIndex = 0;
-						break;
-					}
-
-					glyphIndex = *ptr + idDelta[index];
-				} else {
-					glyphIndex = codePoint + idDelta[index];
-				}
-				goto ok;
-			}
+		slot = hash & (TEXT_CACHE_RUNS - 1);
+	}
 
-			break;
+	struct TextRun* run = &textCache.runs[slot];
+	*run = (struct TextRun){
+		.hash = hash,
+		.text = textCache.charCount,
+		.length = length,
+		.size = size,
+		.maxWidth = maxWidth,
+		.firstQuad = textCache.quadCount
+	};
+
+	__builtin_memcpy(textCache.chars + textCache.charCount, text, length);
+	textCache.charCount += length;
+	textCache.runCount++;
+
+	const struct FontAtlas* font = fontAtlas;
+	struct TextQuad* quads = &textCache.quads[run->firstQuad];
+	u32 quadCount = 0;
+
+	float lineHeight = (font->ascender - font->descender + font->lineGap) * size;
+	float baseline = font->ascender * size;
+	float pen = 0.f;
+	float widest = 0.f;
+	u32 lines = 1;
+
+	// the last space on this line: where the line ends if it breaks there, and where the word after it starts
+	bool breakable = false;
+	float lineEnd = 0.f;
+	float wordStart = 0.f;
+	u32 wordQuad = 0;
+
+	u8 previous = FONT_CHAR_COUNT;
+	for (u32 i = 0; i < length; i++) {
+		if (text[i] == '\n') {
+			widest = __builtin_fmaxf(widest, pen);
+			pen = 0.f;
+			baseline += lineHeight;
+			lines++;
+			breakable = false;
+			previous = FONT_CHAR_COUNT;
+			continue;
 		}
 
-	glyphIndex = 0;
-
-ok:
-	u32 offset;
-	if (head->indexToLocFormat)
-		offset = __builtin_bswap32(((u32*)loca)[glyphIndex]);
-	else
-		offset = __builtin_bswap16(((u16*)loca)[glyphIndex]) * 2;
-
-	struct GlyphDescription* glyphDescription = (struct GlyphDescription*)__builtin_assume_aligned(glyf + offset, alignof(struct GlyphDescription));
-	glyphDescription->numberOfContours = (i16)__builtin_bswap16((u16)glyphDescription->numberOfContours);
-	glyphDescription->xMin = (i16)__builtin_bswap16((u16)glyphDescription->xMin);
-	glyphDescription->yMin = (i16)__builtin_bswap16((u16)glyphDescription->yMin);
-	glyphDescription->xMax = (i16)__builtin_bswap16((u16)glyphDescription->xMax);
-	glyphDescription->yMax = (i16)__builtin_bswap16((u16)glyphDescription->yMax);
+		u8 c = (u8)text[i] - FONT_FIRST_CHAR;
+		if (c >= FONT_CHAR_COUNT)
+			c = '?' - FONT_FIRST_CHAR;
 
-	u16* endPtsOfContours = (u16*)(glyphDescription + 1);
-	for (u16 j = 0; j < glyphDescription->numberOfContours; j++)
-		endPtsOfContours[j] = __builtin_bswap16(endPtsOfContours[j]);
+		if (previous != FONT_CHAR_COUNT)
+			pen += font->kerning[previous][c] * size;
 
-	u16* instructionLength = endPtsOfContours + glyphDescription->numberOfContours;
-	*instructionLength = __builtin_bswap16(*instructionLength);
+		previous = c;
+		const struct FontGlyph* glyph = &font->glyphs[c];
 
-	u8* instructions = (u8*)(instructionLength + 1);
-
-	struct GlyphFlags* flags = (struct GlyphFlags*)(instructions + *instructionLength);
+		if (c == ' ' - FONT_FIRST_CHAR) {
+			breakable = true;
+			lineEnd = pen;
+			pen += glyph->advance * size;
+			wordStart = pen;
+			wordQuad = quadCount;
+			continue;
+		}
 
-	u16 lastIndex = endPtsOfContours[glyphDescription->numberOfContours - 1];
+		if (maxWidth > 0.f && breakable && pen + glyph->advance * size > maxWidth) {
+			for (u32 q = wordQuad; q < quadCount; q++)
+				quads[q].rect += (vec4){ -wordStart, lineHeight, -wordStart, lineHeight };
 
-	u16 j = 0;
-	for (; j <= lastIndex; j++) {
-		if (flags[j].repeat) {
-			u8 repeatCount = ((u8*)flags)[j + 1];
-			while (repeatCount-- > 0) {
-				flags[j + 1] = flags[j];
-				j++;
-			}
+			widest = __builtin_fmaxf(widest, lineEnd);
+			pen -= wordStart;
+			baseline += lineHeight;
+			lines++;
+			breakable = false;
 		}
-	}
 
-	i16 prevCoordinate = 0;
-	i16 currentCoordinate = 0;
-
-	void* xCoordinates = flags + lastIndex;
-
-	i16 result[512];
-
-	for (j = 0; j <= lastIndex; j++) {
-		u8 combined = (u8)(flags[j].xShort << 1 | flags[j].xShortPos);
-
-		switch (combined) {
-			case 0:
-				currentCoordinate = (i16)__builtin_bswap16(*(u16*)xCoordinates);
-				xCoordinates += sizeof(i16);
-				break;
-			case 1:
-				currentCoordinate = 0;
-				break;
-			case 2:
-				currentCoordinate = *(u8*)xCoordinates++ * -1;
-				break;
-			case 3:
-				currentCoordinate = *(u8*)xCoordinates++;
-				break;
+		if (glyph->width) {
+			vec4 uv = (vec4){ glyph->x, glyph->y, glyph->x + glyph->width, glyph->y + glyph->height };
+			uv /= (vec4){ font->width, font->height, font->width, font->height };
+
+			quads[quadCount++] = (struct TextQuad){
+				.rect = { pen + glyph->left * size, baseline - glyph->top * size, pen + glyph->right * size, baseline - glyph->bottom * size },
+				.uv = __builtin_convertvector(uv * 65535.f + 0.5f, u16vec4)
+			};
 		}
 
-		result[j] = currentCoordinate + prevCoordinate;
-		prevCoordinate = result[j];
+		pen += glyph->advance * size;
 	}
 
-	// __debugbreak();
+	run->quadCount = quadCount;
+	run->extent = (vec2){ __builtin_fmaxf(widest, pen), (float)lines * lineHeight };
+	textCache.quadCount += quadCount;
 
+	return run;
 }
 
 static inline u32 textWidth(const char* text, float size) {
-	return 0;
+	return (u32)__builtin_ceilf(layoutText(text, size, 0.f)->extent.x);
 }
 
-static inline void drawText(const char* text, i32 x, i32 y, float size, u8vec4 color) {
-	u32 vertexOffset = verticesTextCount;
+// x and y are the top left of the text under the current transform
+static inline void drawText(const char* text, float x, float y, float size, float maxWidth, u8vec4 color) {
+	const struct TextRun* run = layoutText(text, size, maxWidth);
+	if (!run->quadCount)
+		return;
+
+	reserveText(4 * run->quadCount, 6 * run->quadCount);
+
+	u32 firstIndex = batch2D.indexCount;
+	u16 first = (u16)verticesTextCount;
+
+	// the transform is affine, so a corner lands at origin + xAxis * x + yAxis * y; each quad's four corners go through
+	// as one vector per axis and are transposed into four whole vertices
+	mat4 m = batch2D.transform;
+	vec4 originX = m[0][0] * x + m[0][1] * y + m[0][3];
+	vec4 originY = m[1][0] * x + m[1][1] * y + m[1][3];
+
+	u32 colorBits;
+	__builtin_memcpy(&colorBits, &color, sizeof(colorBits));
+
+	vec4 minimumX = __builtin_inff(), minimumY = __builtin_inff();
+	vec4 maximumX = -__builtin_inff(), maximumY = -__builtin_inff();
+
+	uvec4* vertices = (uvec4*)&verticesText[verticesTextCount];
+	for (u32 i = 0; i < run->quadCount; i++) {
+		const struct TextQuad* quad = &textCache.quads[run->firstQuad + i];
+
+		vec4 xs = quad->rect.xzxz;
+		vec4 ys = quad->rect.yyww;
+		vec4 px = originX + m[0][0] * xs + m[0][1] * ys;
+		vec4 py = originY + m[1][0] * xs + m[1][1] * ys;
+
+		minimumX = __builtin_elementwise_min(minimumX, px);
+		minimumY = __builtin_elementwise_min(minimumY, py);
+		maximumX = __builtin_elementwise_max(maximumX, px);
+		maximumY = __builtin_elementwise_max(maximumY, py);
+
+		uvec4 uv = __builtin_convertvector(quad->uv.xzxz, uvec4) | __builtin_convertvector(quad->uv.yyww, uvec4) << 16;
+		uvec4 lo = __builtin_shufflevector((uvec4)px, (uvec4)py, 0, 4, 1, 5);
+		uvec4 hi = __builtin_shufflevector((uvec4)px, (uvec4)py, 2, 6, 3, 7);
+		uvec4 uvColorLo = __builtin_shufflevector(uv, (uvec4)colorBits, 0, 4, 1, 5);
+		uvec4 uvColorHi = __builtin_shufflevector(uv, (uvec4)colorBits, 2, 6, 3, 7);
+
+		vertices[4 * i + 0] = __builtin_shufflevector(lo, uvColorLo, 0, 1, 4, 5);
+		vertices[4 * i + 1] = __builtin_shufflevector(lo, uvColorLo, 2, 3, 6, 7);
+		vertices[4 * i + 2] = __builtin_shufflevector(hi, uvColorHi, 0, 1, 4, 5);
+		vertices[4 * i + 3] = __builtin_shufflevector(hi, uvColorHi, 2, 3, 6, 7);
+
+		u16 base = first + (u16)(4 * i);
+		index2D(base + 0);
+		index2D(base + 1);
+		index2D(base + 2);
+		index2D(base + 2);
+		index2D(base + 1);
+		index2D(base + 3);
+	}
+
+	verticesTextCount += 4 * run->quadCount;
 
+	vec4 low = __builtin_elementwise_min(__builtin_shufflevector(minimumX, minimumY, 0, 4, 1, 5), __builtin_shufflevector(minimumX, minimumY, 2, 6, 3, 7));
+	vec4 high = __builtin_elementwise_max(__builtin_shufflevector(maximumX, maximumY, 0, 4, 1, 5), __builtin_shufflevector(maximumX, maximumY, 2, 6, 3, 7));
+	batch2D.bounds.xy = __builtin_elementwise_min(batch2D.bounds.xy, __builtin_elementwise_min(low.xy, low.zw));
+	batch2D.bounds.zw = __builtin_elementwise_max(batch2D.bounds.zw, __builtin_elementwise_max(high.xy, high.zw));
 
-	vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelines[PIPELINE_TEXT]);
-	vkCmdBindIndexBuffer(commandBuffer, buffers[BUFFER_DEVICE].handle, 0, VK_INDEX_TYPE_UINT16);
-	vkCmdDrawIndexed(commandBuffer, ((verticesTextCount - vertexOffset) / 4) * 6, 1, BUFFER_OFFSET_QUAD_INDICES / sizeof(u16), (int32_t)vertexOffset, 0);
+	command2D(PIPELINE_TEXT, IMAGE_VIEW_FONT, firstIndex);
 }
@@ -1,4 +1,9 @@
 #include "font.h"
+#include "draw.h"
+#include "grid.h"
+#include "interpolation.h"
+#include "world.h"
+#include "prediction.h"
 
 enum Games : u8 {
 	GAME_WAVES,
@@ -57,18 +62,9 @@ struct Barrel {
 
 	u16 width;
 	u16 length;
-
-	u16 next;
 };
 
-static struct {
-	struct Barrel* data;
-	u16 firstFree;
-	u16 count;
-} barrels = {
-	.data = (struct Barrel[UINT16_MAX]){ },
-	.firstFree = (u16)-1
-};
+static POOL(struct Barrel) barrels = POOL_INIT(struct Barrel, UINT16_MAX);
 
 enum Input {
 	INPUT_FORWARD,
@@ -101,42 +97,6 @@ struct Saves {
 static struct Saves saves;
 #define settings saves
 
-enum EntityType : u8 {
-	ENTITY_TYPE_PLAYER
-};
-
-enum EntityFlags : u16 {
-	ENTITY_IS_PLAYER_CONTROLLED = 1 << 0
-};
-
-struct Entity {
-	uvec3 position;
-	ivec3 velocity;
-
-	float pitch;
-	float yaw;
-
-	u16 speed;
-	u16 radius;
-	u16 mass;
-
-	u16 flags;
-	u16 next;
-
-	enum EntityType type;
-};
-
-static struct {
-	struct Entity* data;
-	u16 firstFree;
-	u16 head;
-	u16 count;
-} entities = {
-	.data = (struct Entity[UINT16_MAX]){ },
-	.firstFree = (u16)-1,
-	.head = (u16)-1
-};
-
 enum Directions : u8 {
 	DIRECTION_NORTH,
 	DIRECTION_EAST,
@@ -168,38 +128,3 @@ static struct Region region = {
 		}
 	}
 };
-
-// struct GridElement {
-// 	u16 entity;
-// 	u16 next;
-// };
-
-// struct GridCell {
-// 	u16 head;
-// };
-
-// static struct {
-// 	struct GridCell cells[256 * 256];
-// 	struct GridElement elements[UINT16_MAX];
-// 	u16 elementCount;
-// } grid;
-
-// static inline void gridInsert(u16 idx) {
-// 	struct Entity* entity = &entities.data[idx];
-
-// 	u16 firstX = (entity->position.x >> 16) - entity->radius;
-// 	u16 lastX = (entity->position.x >> 16) + entity->radius;
-// 	u16 firstZ = (entity->position.z >> 16) - entity->radius;
-// 	u16 lastZ = (entity->position.z >> 16) + entity->radius;
-
-// 	for (u16 z = firstZ; z < lastZ; z++) {
-// 		for (u16 x = firstX; x < lastX; x++) {
-// 			grid.elements[grid.elementCount] = (struct GridElement){
-// 				.entity = idx,
-// 				.next = grid.cells[x + z * 256].head
-// 			};
-
-// 			grid.cells[x + z * 256].head = grid.elementCount++;
-// 		}
-// 	}
-// }
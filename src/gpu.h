@@ -0,0 +1,95 @@
+#pragma once
+
+#include "engine.h"
+#include "tlsf.h"
+
+// device memory comes in large blocks per memory type that resources are placed into, rather than a vkAllocateMemory
+// each: drivers cap how many allocations may be live and every one is a trip into the kernel. Buffers and optimal-tiling
+// images get heaps of their own so bufferImageGranularity never has to be kept between neighbours.
+#define GPU_BLOCK_SIZE (64ull * 1024 * 1024)
+#define GPU_MAX_BLOCKS 64
+
+enum GpuResource : u8 {
+	GPU_RESOURCE_LINEAR, // buffers
+	GPU_RESOURCE_OPTIMAL, // images
+	GPU_RESOURCE_MAX_ENUM
+};
+
+struct GpuBlock {
+	VkDeviceMemory memory;
+	void* data; // mapped for the life of the block when its type is host visible
+};
+
+struct GpuAllocation {
+	VkDeviceMemory memory;
+	VkDeviceSize offset;
+	void* data;
+	u16 region;
+	u8 memoryType;
+	enum GpuResource resource;
+};
+
+static struct {
+	struct Tlsf heaps[VK_MAX_MEMORY_TYPES][GPU_RESOURCE_MAX_ENUM];
+	struct GpuBlock blocks[GPU_MAX_BLOCKS];
+	u16 blockCount;
+	VkDeviceSize allocated; // across every block
+} gpu;
+
+static inline void gpuAddBlock(VkDevice device, u32 memoryType, enum GpuResource resource, VkDeviceSize size) {
+	if (gpu.blockCount == GPU_MAX_BLOCKS)
+		vkFatal("gpuAddBlock", VK_ERROR_TOO_MANY_OBJECTS);
+
+	struct GpuBlock* block = &gpu.blocks[gpu.blockCount];
+
+	VkResult r;
+	if ((r = vkAllocateMemory(device, &(VkMemoryAllocateInfo){
+		.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+		.allocationSize = size,
+		.memoryTypeIndex = memoryType
+	}, NULL, &block->memory)) != VK_SUCCESS)
+		vkFatal("vkAllocateMemory", r);
+
+	if (physicalDeviceMemoryProperties.memoryTypes[memoryType].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)
+		if ((r = vkMapMemory(device, block->memory, 0, VK_WHOLE_SIZE, 0, &block->data)) != VK_SUCCESS)
+			vkFatal("vkMapMemory", r);
+
+	if (!tlsfAddBlock(&gpu.heaps[memoryType][resource], gpu.blockCount, size))
+		vkFatal("gpuAddBlock", VK_ERROR_TOO_MANY_OBJECTS);
+
+	gpu.blockCount++;
+	gpu.allocated += size;
+}
+
+// places whatever memoryRequirements was last filled in with, adding a block when the heap has no room; anything bigger
+// than a block gets one sized to it
+static inline struct GpuAllocation gpuAllocate(VkDevice device, enum GpuResource resource, VkMemoryPropertyFlags required, VkMemoryPropertyFlags optional) {
+	u32 memoryType = vkGetMemoryTypeIndex(required, optional);
+	struct Tlsf* heap = &gpu.heaps[memoryType][resource];
+
+	u16 region = tlsfAllocate(heap, memoryRequirements.size, memoryRequirements.alignment);
+	if (region == TLSF_NONE) {
+		gpuAddBlock(device, memoryType, resource, __builtin_elementwise_max(tlsfFitSize(memoryRequirements.size, memoryRequirements.alignment), GPU_BLOCK_SIZE));
+
+		if ((region = tlsfAllocate(heap, memoryRequirements.size, memoryRequirements.alignment)) == TLSF_NONE)
+			vkFatal("gpuAllocate", VK_ERROR_OUT_OF_DEVICE_MEMORY);
+	}
+
+	struct TlsfRegion* placed = &tlsfRegions.data[region];
+	struct GpuBlock* block = &gpu.blocks[placed->block];
+
+	return (struct GpuAllocation){
+		.memory = block->memory,
+		.offset = placed->offset,
+		.data = block->data ? (u8*)block->data + placed->offset : NULL,
+		.region = region,
+		.memoryType = (u8)memoryType,
+		.resource = resource
+	};
+}
+
+// the space goes back to its heap once the GPU is done with it; blocks themselves stay until exit
+static inline void gpuFree(struct GpuAllocation* allocation) {
+	tlsfFree(&gpu.heaps[allocation->memoryType][allocation->resource], allocation->region);
+	*allocation = (struct GpuAllocation){ .region = TLSF_NONE };
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "simulation.h"
+
+// entities are binned by centre into 256x256 cells of 256 world units; queries widen by the largest radius seen
+#define GRID_SIZE 256
+#define GRID_CELLS (GRID_SIZE * GRID_SIZE)
+#define GRID_CELL_SHIFT 24 // 16.16 fixed point to cell coordinate
+
+struct GridElement {
+	u32 x, z;
+	u16 entity;
+	u16 radius;
+};
+
+static struct {
+	u16 cellStart[GRID_CELLS + 1]; // elements of cell i are [cellStart[i], cellStart[i + 1])
+	struct GridElement* elements;
+	u16* elementCell;
+	u16 elementCount;
+	u16 maxRadius;
+} grid = {
+	.elements = (struct GridElement[UINT16_MAX]){ },
+	.elementCell = (u16[UINT16_MAX]){ }
+};
+
+static inline u16 gridCell(u32 x, u32 z) {
+	return (u16)((x >> GRID_CELL_SHIFT) + (z >> GRID_CELL_SHIFT) * GRID_SIZE);
+}
+
+// counting sort of every live entity into its cell, so each cell is a contiguous run of elements
+static inline void gridRebuild(void) {
+	static struct GridElement unsorted[UINT16_MAX];
+
+	__builtin_memset(grid.cellStart, 0, sizeof(grid.cellStart));
+
+	u16 count = bodies.count;
+	u16 maxRadius = 0;
+	for (u16 i = 0; i < count; i++) {
+		u16 cell = gridCell(bodies.positionX[i], bodies.positionZ[i]);
+
+		unsorted[i] = (struct GridElement){
+			.x = bodies.positionX[i],
+			.z = bodies.positionZ[i],
+			.entity = bodies.entity[i],
+			.radius = bodies.radius[i]
+		};
+		grid.elementCell[i] = cell;
+		grid.cellStart[cell]++;
+
+		if (bodies.radius[i] > maxRadius)
+			maxRadius = bodies.radius[i];
+	}
+
+	// inclusive prefix sum gives the end of each cell; scattering walks those back down to the start
+	u16 sum = 0;
+	for (u32 i = 0; i < GRID_CELLS; i++) {
+		sum += grid.cellStart[i];
+		grid.cellStart[i] = sum;
+	}
+	grid.cellStart[GRID_CELLS] = count;
+
+	for (u16 i = count; i-- > 0;)
+		grid.elements[--grid.cellStart[grid.elementCell[i]]] = unsorted[i];
+
+	grid.elementCount = count;
+	grid.maxRadius = maxRadius;
+}
+
+// writes up to maxResults entities whose circle on the xz plane overlaps the query circle, returns how many were written
+static inline u32 gridQuery(uvec3 position, u16 radius, u16* results, u32 maxResults) {
+	i32 reach = (i32)radius + (i32)grid.maxRadius;
+	i32 centerX = (i32)(position.x >> 16);
+	i32 centerZ = (i32)(position.z >> 16);
+
+	i32 firstX = __builtin_elementwise_max(centerX - reach, 0) >> (GRID_CELL_SHIFT - 16);
+	i32 lastX = __builtin_elementwise_min(centerX + reach, UINT16_MAX) >> (GRID_CELL_SHIFT - 16);
+	i32 firstZ = __builtin_elementwise_max(centerZ - reach, 0) >> (GRID_CELL_SHIFT - 16);
+	i32 lastZ = __builtin_elementwise_min(centerZ + reach, UINT16_MAX) >> (GRID_CELL_SHIFT - 16);
+
+	u32 resultCount = 0;
+
+	for (i32 z = firstZ; z <= lastZ; z++) {
+		u32 rowStart = grid.cellStart[firstX + z * GRID_SIZE];
+		u32 rowEnd = grid.cellStart[lastX + z * GRID_SIZE + 1];
+
+		// cells in a row are adjacent in the sorted array, so a row is a single contiguous scan
+		for (u32 i = rowStart; i < rowEnd; i++) {
+			struct GridElement* element = &grid.elements[i];
+
+			// 24.8 keeps the squares inside 64 bits
+			i64 dx = ((i64)element->x - (i64)position.x) >> 8;
+			i64 dz = ((i64)element->z - (i64)position.z) >> 8;
+			i64 r = ((i64)radius + (i64)element->radius) << 8;
+
+			if (dx * dx + dz * dz > r * r)
+				continue;
+
+			if (resultCount == maxResults)
+				return resultCount;
+
+			results[resultCount++] = element->entity;
+		}
+	}
+
+	return resultCount;
+}
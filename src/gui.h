@@ -133,18 +133,27 @@ static struct {
 #define ANIMATION_TIME 256
 #define TRANSITION_ANIMATION_TIME 512
 
+// where dialogs grow from and shrink back to
+#define center ((i16vec2){ (i16)windowWidth / 2, (i16)windowHeight / 2 })
+
 static inline bool isAnimating(struct UINode* node) {
 	return (i64)msElapsed - (i64)node->position.startTime < ANIMATION_TIME ||
 		(i64)msElapsed - (i64)node->scale.startTime < ANIMATION_TIME;
 }
 
 static inline void drawUINode(struct UINode* node) {
-	struct UINode* tree[64];
-	u32 childOffsets[512];
-	mat4 transforms[64];
+	// per level: the node whose children are being walked, the next of them and the transform at that level
+	struct {
+		struct UINode* node;
+		u32 childOffset;
+		mat4 transform;
+	}* levels = NULL;
+	u32 levelCapacity = 0;
 	u32 depth = 0;
 
 	for (;;) {
+		ARENA_RESERVE(&frameArena, levels, depth, levelCapacity);
+
 		if (node->flags & UI_FLAG_INVISIBLE)
 			goto bubble;
 
@@ -169,13 +178,13 @@ static inline void drawUINode(struct UINode* node) {
 		float c = __builtin_cosf(rotation);
 		float s = __builtin_sinf(rotation);
 
-		transforms[depth] = mat4From2DAffine(c * scale, s * scale, -s * scale, c * scale, localPosition.x, localPosition.y);
+		levels[depth].transform = mat4From2DAffine(c * scale, s * scale, -s * scale, c * scale, localPosition.x, localPosition.y);
 		if (depth)
-			transforms[depth] = transforms[depth - 1] * transforms[depth];
+			levels[depth].transform = levels[depth - 1].transform * levels[depth].transform;
 
-		setTransform(transforms[depth]);
+		setTransform(levels[depth].transform);
 
-		vec2 position = { transforms[depth][0][3], transforms[depth][1][3] };
+		vec2 position = { levels[depth].transform[0][3], levels[depth].transform[1][3] };
 
 		u8vec4 color = blendColor(
 			node->color.old,
@@ -193,7 +202,7 @@ static inline void drawUINode(struct UINode* node) {
 				inBounds = (float)mouse.x > position.x && (float)mouse.x < position.x + node->extent.x && (float)mouse.y > position.y && (float)mouse.y < position.y + node->extent.y;
 				beginPath();
 				rect(0.f, 0.f, node->extent.x, node->extent.y);
-				fill(color);
+				fill(color, FILL_RULE_NONZERO);
 				stroke(node->color.border, 3.f, LINE_JOIN_MITER, LINE_CAP_BUTT);
 				break;
 			case UI_BODY_CIRCLE:
@@ -202,7 +211,7 @@ static inline void drawUINode(struct UINode* node) {
 				inBounds = dx * dx + dy * dy <= node->radius * node->radius;
 				beginPath();
 				arc(0.f, 0.f, node->radius, 0.f, M_PI * 2.f);
-				fill(color);
+				fill(color, FILL_RULE_NONZERO);
 				stroke(node->color.border, 3.f, LINE_JOIN_MITER, LINE_CAP_BUTT);
 				break;
 		}
@@ -347,8 +356,7 @@ static inline void drawUINode(struct UINode* node) {
 						ShellExecuteW(NULL, L"open", L"https://discord.gg/E3pKkpqHPE", NULL, NULL, SW_SHOWNORMAL);
 						break;
 					case UI_ON_CLICK_ENTER_LOBBY:
-						if (sendto(sock, &(char){ 0 }, 1, 0, (struct sockaddr*)&serverAddress, (int){ sizeof(serverAddress) }) == SOCKET_ERROR)
-							win32Fatal("sendto", (DWORD)WSAGetLastError());
+						platformSocketSend(&(char){ 0 }, 1, &serverAddress);
 
 						ANIMATE(nameDiv.position, ((i16vec2){ center.x, center.y }), 0);
 						ANIMATE(nameDiv.scale, 0, 0);
@@ -427,8 +435,7 @@ static inline void drawUINode(struct UINode* node) {
 						// __builtin_memcpy(&msg[1 + 32 + 64 + 1 + 1], &(u16){ 1 }, sizeof(u16));
 						// __builtin_memcpy(&msg[1 + 32 + 64 + 1 + 1 + 2], &(u16){ 16 }, sizeof(u16));
 
-						// if (sendto(sock, (char*)msg, sizeof(msg), 0, (struct sockaddr*)&serverAddress, (int){ sizeof(serverAddress) }) == SOCKET_ERROR)
-						// 	win32Fatal("sendto", (DWORD)WSAGetLastError());
+						// platformSocketSend(msg, sizeof(msg), &serverAddress);
 
 						break;
 				}
@@ -450,7 +457,7 @@ static inline void drawUINode(struct UINode* node) {
 			lineTo(8.f, 24.f);
 			closePath();
 			u8vec4 col = (u8vec4){ 204, 204, 204, color.a };
-			fill(col);
+			fill(col, FILL_RULE_NONZERO);
 			stroke(blendColor(col, colors.black, 0.25), 2.f, LINE_JOIN_MITER, LINE_CAP_BUTT);
 		}
 
@@ -458,18 +465,18 @@ static inline void drawUINode(struct UINode* node) {
 			drawImage(node->imageView, -node->extent.x * 0.5f, -node->extent.y * 0.5f, node->extent.x, node->extent.y);
 
 		if (node->text && __builtin_strlen(node->text))
-			drawText(node->text, 0, 0, 32.f, color);
+			drawText(node->text, 0.f, 0.f, 32.f, node->body == UI_BODY_SQUARE ? (float)node->extent.x : 0.f, (u8vec4){ 255, 255, 255, color.a });
 
 		if (node->childCount) {
-			tree[depth] = node;
-			childOffsets[depth++] = 0;
+			levels[depth].node = node;
+			levels[depth++].childOffset = 0;
 			node = node->children;
 		} else {
 		bubble:
 			while (depth) {
-				node = tree[--depth];
-				if (++childOffsets[depth] < node->childCount) {
-					node = &node->children[childOffsets[depth++]];
+				node = levels[--depth].node;
+				if (++levels[depth].childOffset < node->childCount) {
+					node = &node->children[levels[depth++].childOffset];
 					break;
 				}
 			}
@@ -0,0 +1,177 @@
+#pragma once
+
+#include "snapshot.h"
+
+// remote entities are drawn a little in the past, between the two snapshots that straddle the render time; the delay
+// follows the measured arrival jitter so late snapshots rarely leave nothing to interpolate towards
+#define INTERPOLATION_SAMPLES 8 // power of two
+#define INTERPOLATION_MIN_DELAY NANOSECONDS_PER_TICK
+#define INTERPOLATION_MAX_DELAY (6 * NANOSECONDS_PER_TICK)
+#define INTERPOLATION_JITTER_SCALE 3 // delay covers this many mean deviations of arrival time
+#define INTERPOLATION_EXTRAPOLATE_LIMIT (4 * NANOSECONDS_PER_TICK)
+#define INTERPOLATION_STALE_TICKS TICKS_PER_SECOND // a gap this long starts an entity's history over
+
+struct InterpolationSample {
+	u32 x, y, z;
+	u32 tick;
+	i8 yaw;
+};
+
+struct InterpolationHistory {
+	struct InterpolationSample samples[INTERPOLATION_SAMPLES];
+	u8 head; // next write
+	u8 count;
+};
+
+static struct InterpolationHistory interpolationHistories[UINT16_MAX];
+
+static struct {
+	i64 offset; // local clock minus server time, from the fastest recent snapshot
+	i64 jitter; // mean deviation of arrival from that offset
+	i64 delay;
+	i64 renderTime; // server time being drawn this frame
+	u32 latestTick; // newest recorded snapshot, unwrapped
+	u16 recordedSequence;
+	bool started;
+
+	// frames drawn with no snapshot new enough, and entities extrapolated past their newest sample in those frames;
+	// running totals the stats overlay reads from the render thread
+	u32 underruns;
+	u32 extrapolations;
+	u32 frames;
+} interpolation;
+
+static inline i64 interpolationTickTime(u32 tick) {
+	return (i64)tick * NANOSECONDS_PER_TICK;
+}
+
+static inline void interpolationRecord(const struct SnapshotFrame* frame) {
+	u64 now = frame->receivedAt;
+	u32 tick;
+
+	if (!interpolation.started) {
+		tick = frame->sequence;
+		interpolation.offset = (i64)now - interpolationTickTime(tick);
+		interpolation.delay = INTERPOLATION_MIN_DELAY;
+		interpolation.started = true;
+	} else
+		tick = interpolation.latestTick + (u32)(i32)(i16)(frame->sequence - (u16)interpolation.latestTick);
+
+	interpolation.latestTick = tick;
+	interpolation.recordedSequence = frame->sequence;
+
+	// the offset snaps down to the quickest delivery and creeps up slowly so clock drift is still followed
+	i64 observed = (i64)now - interpolationTickTime(tick);
+	if (observed < interpolation.offset)
+		interpolation.offset = observed;
+	else
+		interpolation.offset += (observed - interpolation.offset) / 256;
+
+	interpolation.jitter += (observed - interpolation.offset - interpolation.jitter) / 16;
+
+	for (u16 i = 0; i < frame->count; i++) {
+		const struct SnapshotEntity* entity = &frame->entities[i];
+
+		if (entities.data[entity->id].flags & ENTITY_IS_PLAYER_CONTROLLED)
+			continue;
+
+		struct InterpolationHistory* history = &interpolationHistories[entity->id];
+		struct InterpolationSample* newest = &history->samples[(history->head - 1) & (INTERPOLATION_SAMPLES - 1)];
+
+		if (history->count && tick - newest->tick > INTERPOLATION_STALE_TICKS)
+			history->count = 0;
+
+		// unchanged entities add nothing to interpolate between; the newest sample holds until something moves
+		if (history->count && newest->x == entity->x && newest->y == entity->y && newest->z == entity->z && newest->yaw == entity->yaw)
+			continue;
+
+		history->samples[history->head] = (struct InterpolationSample){ entity->x, entity->y, entity->z, tick, entity->yaw };
+		history->head = (history->head + 1) & (INTERPOLATION_SAMPLES - 1);
+		if (history->count < INTERPOLATION_SAMPLES)
+			history->count++;
+	}
+}
+
+// records every snapshot completed since the last call, at the time it arrived, then picks the server time to place
+// remote entities at for the tick ending now; the render thread blends between ticks itself
+static inline void interpolationUpdate(u64 now) {
+	if (snapshotApplied) {
+		u16 first = interpolation.started ? interpolation.recordedSequence + 1 : snapshotLatest;
+		if (sequenceNewer(snapshotLatest - SNAPSHOT_HISTORY, first))
+			first = snapshotLatest - SNAPSHOT_HISTORY + 1;
+
+		for (u16 sequence = first; !sequenceNewer(sequence, snapshotLatest); sequence++) {
+			const struct SnapshotFrame* frame = &snapshotFrames[sequence & (SNAPSHOT_HISTORY - 1)];
+
+			if (frame->valid && frame->complete && frame->sequence == sequence)
+				interpolationRecord(frame);
+		}
+	}
+
+	if (!interpolation.started)
+		return;
+
+	i64 target = __builtin_elementwise_min(__builtin_elementwise_max(INTERPOLATION_MIN_DELAY + INTERPOLATION_JITTER_SCALE * interpolation.jitter, (i64)INTERPOLATION_MIN_DELAY), (i64)INTERPOLATION_MAX_DELAY);
+	interpolation.delay += (target - interpolation.delay) / 32;
+
+	interpolation.renderTime = (i64)now - interpolation.offset - interpolation.delay;
+	__atomic_store_n(&interpolation.frames, interpolation.frames + 1, __ATOMIC_RELAXED);
+
+	if (interpolation.renderTime > interpolationTickTime(interpolation.latestTick)) {
+		__atomic_store_n(&interpolation.underruns, interpolation.underruns + 1, __ATOMIC_RELAXED);
+
+		// running dry means the delay is too short right now, don't wait for the average to catch up
+		interpolation.delay = __builtin_elementwise_min(interpolation.delay + NANOSECONDS_PER_TICK / 8, (i64)INTERPOLATION_MAX_DELAY);
+	}
+}
+
+// world-space position and yaw to draw a body at; the local player is where prediction put it
+static inline vec3 interpolationPosition(u16 body, float* yaw) {
+	u16 id = bodies.entity[body];
+	const struct Entity* entity = &entities.data[id];
+	const struct InterpolationHistory* history = &interpolationHistories[id];
+
+	*yaw = entity->yaw;
+
+	if (entity->flags & ENTITY_IS_PLAYER_CONTROLLED || !interpolation.started || !history->count)
+		return __builtin_convertvector(bodyPosition(body), vec3) / 65536.f;
+
+	// newest sample at or before the render time, scanning back from the newest
+	u8 newestIndex = (history->head - 1) & (INTERPOLATION_SAMPLES - 1);
+	u8 index = newestIndex;
+	for (u8 i = 1; i < history->count && interpolationTickTime(history->samples[index].tick) > interpolation.renderTime; i++)
+		index = (index - 1) & (INTERPOLATION_SAMPLES - 1);
+
+	const struct InterpolationSample* a = &history->samples[index];
+	const struct InterpolationSample* b = NULL;
+	float t = 0.f;
+
+	i64 aTime = interpolationTickTime(a->tick);
+
+	if (index != newestIndex) {
+		b = &history->samples[(index + 1) & (INTERPOLATION_SAMPLES - 1)];
+		t = (float)(interpolation.renderTime - aTime) / (float)(interpolationTickTime(b->tick) - aTime);
+	} else if (a->tick == interpolation.latestTick && history->count > 1 && interpolation.renderTime > aTime) {
+		// still moving in the newest snapshot and we're past it, so carry on along the last segment for a while
+		b = a;
+		a = &history->samples[(index - 1) & (INTERPOLATION_SAMPLES - 1)];
+
+		i64 span = aTime - interpolationTickTime(a->tick);
+		t = 1.f + (float)__builtin_elementwise_min(interpolation.renderTime - aTime, (i64)INTERPOLATION_EXTRAPOLATE_LIMIT) / (float)span;
+
+		__atomic_store_n(&interpolation.extrapolations, interpolation.extrapolations + 1, __ATOMIC_RELAXED);
+	}
+
+	t = __builtin_elementwise_max(t, 0.f);
+
+	vec3 from = { (float)a->x, (float)a->y, (float)a->z };
+	if (!b) {
+		*yaw = i8ToRad(a->yaw);
+		return (from + .5f) * (float)(1 << SNAPSHOT_POSITION_SHIFT) / 65536.f;
+	}
+
+	vec3 to = { (float)b->x, (float)b->y, (float)b->z };
+	*yaw = i8ToRad((i8)(a->yaw + (i8)((float)(i8)(b->yaw - a->yaw) * t)));
+
+	return (from + (to - from) * t + .5f) * (float)(1 << SNAPSHOT_POSITION_SHIFT) / 65536.f;
+}
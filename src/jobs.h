@@ -0,0 +1,195 @@
+#pragma once
+
+#include "platform.h"
+
+// work-stealing job system: every worker owns a Chase-Lev deque, pushing and popping its own jobs at the bottom while
+// idle workers steal from the top of the others'. The thread that calls jobsInit is worker 0 and joins in whenever it
+// waits on a counter. No thread-local storage, jobs are told which worker runs them and pass that on.
+#define JOB_MAX_WORKERS 8 // including worker 0
+#define JOB_DEQUE_SIZE 256 // power of two
+#define JOB_SPINS 1024 // empty rounds of stealing before an idle worker sleeps
+
+typedef void (*JobFunction)(void* data, u32 first, u32 count, u32 worker);
+
+// spawning adds to pending and every finished job takes one away; waiting on it is how one piece of work depends on another
+struct JobCounter {
+	u32 pending;
+};
+
+struct Job {
+	JobFunction function;
+	void* data;
+	u32 first;
+	u32 count;
+	struct JobCounter* counter;
+};
+
+struct JobDeque {
+	__attribute__((aligned(64))) i64 top;
+	__attribute__((aligned(64))) i64 bottom;
+	struct Job jobs[JOB_DEQUE_SIZE];
+};
+
+static struct {
+	struct JobDeque deques[JOB_MAX_WORKERS];
+	u32 workerCount; // including worker 0
+
+	PlatformSemaphore wake;
+	u32 sleeping;
+} jobs;
+
+static inline bool jobDequePush(struct JobDeque* deque, const struct Job* job) {
+	i64 bottom = __atomic_load_n(&deque->bottom, __ATOMIC_RELAXED);
+	i64 top = __atomic_load_n(&deque->top, __ATOMIC_ACQUIRE);
+
+	if (bottom - top >= JOB_DEQUE_SIZE)
+		return false;
+
+	deque->jobs[bottom & (JOB_DEQUE_SIZE - 1)] = *job;
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+	__atomic_store_n(&deque->bottom, bottom + 1, __ATOMIC_RELAXED);
+
+	return true;
+}
+
+// owner only, newest first
+static inline bool jobDequePop(struct JobDeque* deque, struct Job* job) {
+	i64 bottom = __atomic_load_n(&deque->bottom, __ATOMIC_RELAXED) - 1;
+	__atomic_store_n(&deque->bottom, bottom, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	i64 top = __atomic_load_n(&deque->top, __ATOMIC_RELAXED);
+
+	if (top > bottom) {
+		__atomic_store_n(&deque->bottom, bottom + 1, __ATOMIC_RELAXED);
+		return false;
+	}
+
+	*job = deque->jobs[bottom & (JOB_DEQUE_SIZE - 1)];
+	if (top < bottom)
+		return true;
+
+	// the last job, race any thief for it
+	bool won = __atomic_compare_exchange_n(&deque->top, &top, top + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+	__atomic_store_n(&deque->bottom, bottom + 1, __ATOMIC_RELAXED);
+
+	return won;
+}
+
+// any thread, oldest first; a copy torn by the owner wrapping around is thrown away when the exchange fails
+static inline bool jobDequeSteal(struct JobDeque* deque, struct Job* job) {
+	i64 top = __atomic_load_n(&deque->top, __ATOMIC_ACQUIRE);
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	i64 bottom = __atomic_load_n(&deque->bottom, __ATOMIC_ACQUIRE);
+
+	if (top >= bottom)
+		return false;
+
+	*job = deque->jobs[top & (JOB_DEQUE_SIZE - 1)];
+
+	return __atomic_compare_exchange_n(&deque->top, &top, top + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+}
+
+static inline bool jobsFind(u32 worker, struct Job* job) {
+	if (jobDequePop(&jobs.deques[worker], job))
+		return true;
+
+	for (u32 i = 1; i < jobs.workerCount; i++)
+		if (jobDequeSteal(&jobs.deques[(worker + i) % jobs.workerCount], job))
+			return true;
+
+	return false;
+}
+
+static inline void jobsExecute(const struct Job* job, u32 worker) {
+	job->function(job->data, job->first, job->count, worker);
+	__atomic_fetch_sub(&job->counter->pending, 1, __ATOMIC_RELEASE);
+}
+
+// queues a job on the worker's own deque, running it on the spot if that's full
+static inline void jobsSpawn(u32 worker, struct JobCounter* counter, JobFunction function, void* data, u32 first, u32 count) {
+	struct Job job = { function, data, first, count, counter };
+
+	__atomic_fetch_add(&counter->pending, 1, __ATOMIC_RELAXED);
+
+	if (!jobDequePush(&jobs.deques[worker], &job)) {
+		jobsExecute(&job, worker);
+		return;
+	}
+
+	// pairs with the sleeper's recheck so the push is either seen by it or wakes it
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	if (__atomic_load_n(&jobs.sleeping, __ATOMIC_RELAXED))
+		platformSemaphoreSignal(&jobs.wake, 1);
+}
+
+// runs queued work, own or stolen, until everything counted has finished
+static inline void jobsWait(u32 worker, struct JobCounter* counter) {
+	struct Job job;
+
+	while (__atomic_load_n(&counter->pending, __ATOMIC_ACQUIRE)) {
+		if (jobsFind(worker, &job))
+			jobsExecute(&job, worker);
+		else
+			__builtin_ia32_pause();
+	}
+}
+
+static inline PLATFORM_THREAD_FUNCTION(jobsWorker) {
+	u32 worker = (u32)(uintptr_t)arg;
+	struct Job job;
+
+	for (;;) {
+		u32 spins = 0;
+		while (spins < JOB_SPINS) {
+			if (jobsFind(worker, &job)) {
+				jobsExecute(&job, worker);
+				spins = 0;
+			} else {
+				spins++;
+				__builtin_ia32_pause();
+			}
+		}
+
+		__atomic_fetch_add(&jobs.sleeping, 1, __ATOMIC_RELAXED);
+		__atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+		bool found = jobsFind(worker, &job);
+		if (!found)
+			platformSemaphoreWait(&jobs.wake);
+
+		__atomic_fetch_sub(&jobs.sleeping, 1, __ATOMIC_RELAXED);
+
+		if (found)
+			jobsExecute(&job, worker);
+	}
+}
+
+static inline void jobsInit(void) {
+	platformSemaphoreInit(&jobs.wake);
+
+	jobs.workerCount = __builtin_elementwise_min(platformCpuCount(), (u32)JOB_MAX_WORKERS);
+
+	for (u32 i = 1; i < jobs.workerCount; i++)
+		platformThreadStart(jobsWorker, (void*)(uintptr_t)i);
+}
+
+// splits the range into batches for whoever is free and helps until all of them are done; a range that fits in one
+// batch runs inline
+static inline void jobsParallelFor(u32 worker, JobFunction function, void* data, u32 count, u32 batch) {
+	if (!count)
+		return;
+
+	if (count <= batch || jobs.workerCount <= 1) {
+		function(data, 0, count, worker);
+		return;
+	}
+
+	// keep the batches within what the deque holds
+	batch = __builtin_elementwise_max(batch, (count + JOB_DEQUE_SIZE / 2 - 1) / (JOB_DEQUE_SIZE / 2));
+
+	struct JobCounter counter = { };
+	for (u32 first = 0; first < count; first += batch)
+		jobsSpawn(worker, &counter, function, data, first, __builtin_elementwise_min(batch, count - first));
+
+	jobsWait(worker, &counter);
+}
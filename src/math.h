@@ -1,3 +1,5 @@
+#pragma once
+
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -30,11 +32,16 @@ typedef u8 u8vec3 __attribute__((ext_vector_type(3)));
 typedef u8 u8vec4 __attribute__((ext_vector_type(4)));
 typedef u16 u16vec2 __attribute__((ext_vector_type(2)));
 typedef u16 u16vec3 __attribute__((ext_vector_type(3)));
+typedef u16 u16vec4 __attribute__((ext_vector_type(4)));
 typedef i16 i16vec2 __attribute__((ext_vector_type(2)));
 typedef i16 i16vec3 __attribute__((ext_vector_type(3)));
 typedef u32 uvec3 __attribute__((ext_vector_type(3)));
 typedef u32 uvec4 __attribute__((ext_vector_type(4)));
 typedef float quat __attribute__((ext_vector_type(4)));
+typedef u16 u16vec8 __attribute__((ext_vector_type(8)));
+typedef i32 ivec8 __attribute__((ext_vector_type(8)));
+typedef u32 uvec8 __attribute__((ext_vector_type(8)));
+typedef float vec8 __attribute__((ext_vector_type(8)));
 
 static inline float step(float edge, float x) {
     return x < edge ? 0.f : 1.f;
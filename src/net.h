@@ -0,0 +1,130 @@
+#pragma once
+
+#include "platform.h"
+
+#define NET_MTU 1200
+#define NET_PACKET_MAX 1500 // largest datagram accepted from the wire
+#define NET_INBOX_CAPACITY 256
+#define NET_OUTBOX_CAPACITY 256
+
+// everything received in one drain, valid until the next netReceive
+static struct {
+	struct NetPacket packets[NET_INBOX_CAPACITY];
+	u8 arena[NET_INBOX_CAPACITY][NET_PACKET_MAX];
+	u32 count;
+} netInbox;
+
+// datagrams queued this tick; small messages to the same peer share a datagram
+static struct {
+	struct NetPacket packets[NET_OUTBOX_CAPACITY];
+	u8 arena[NET_OUTBOX_CAPACITY][NET_MTU];
+	u32 count;
+} netOutbox;
+
+static inline u32 netReceive(void) {
+	for (u32 i = 0; i < NET_INBOX_CAPACITY; i++)
+		netInbox.packets[i].data = netInbox.arena[i];
+
+	netInbox.count = platformSocketReceiveMany(netInbox.packets, NET_INBOX_CAPACITY, NET_PACKET_MAX);
+
+	return netInbox.count;
+}
+
+static inline void netFlush(void) {
+	platformSocketSendMany(netOutbox.packets, netOutbox.count);
+	netOutbox.count = 0;
+}
+
+// reserves size bytes for a message to the given peer; it is appended to the peer's open datagram when it fits
+static inline u8* netSend(const struct NetAddress* to, u32 size) {
+	struct NetPacket* packet;
+
+	if (netOutbox.count) {
+		packet = &netOutbox.packets[netOutbox.count - 1];
+
+		if (packet->size + size <= NET_MTU && netAddressEqual(&packet->address, to)) {
+			u8* data = packet->data + packet->size;
+			packet->size += size;
+			return data;
+		}
+	}
+
+	if (netOutbox.count == NET_OUTBOX_CAPACITY)
+		netFlush();
+
+	packet = &netOutbox.packets[netOutbox.count];
+	*packet = (struct NetPacket){
+		.address = *to,
+		.size = size,
+		.data = netOutbox.arena[netOutbox.count]
+	};
+	netOutbox.count++;
+
+	return packet->data;
+}
+
+// wrap-aware comparison of 16-bit sequence numbers
+static inline bool sequenceNewer(u16 a, u16 b) {
+	return (i16)(a - b) > 0;
+}
+
+// little-endian bit packing; the writer's buffer must start zeroed
+struct BitWriter {
+	u8* data;
+	u64 scratch;
+	u32 scratchBits;
+	u32 bytes;
+};
+
+struct BitReader {
+	const u8* data;
+	u32 size;
+	u32 bytes;
+	u64 scratch;
+	u32 scratchBits;
+	bool overflow;
+};
+
+static inline void bitsWrite(struct BitWriter* writer, u32 value, u32 count) {
+	writer->scratch |= (u64)(value & (u32)(((u64)1 << count) - 1)) << writer->scratchBits;
+	writer->scratchBits += count;
+
+	while (writer->scratchBits >= 8) {
+		writer->data[writer->bytes++] = (u8)writer->scratch;
+		writer->scratch >>= 8;
+		writer->scratchBits -= 8;
+	}
+}
+
+static inline u32 bitsWritten(const struct BitWriter* writer) {
+	return writer->bytes * 8 + writer->scratchBits;
+}
+
+// pads to a whole byte and returns the size in bytes
+static inline u32 bitsFinish(struct BitWriter* writer) {
+	if (writer->scratchBits) {
+		writer->data[writer->bytes++] = (u8)writer->scratch;
+		writer->scratch = 0;
+		writer->scratchBits = 0;
+	}
+
+	return writer->bytes;
+}
+
+static inline u32 bitsRead(struct BitReader* reader, u32 count) {
+	while (reader->scratchBits < count) {
+		if (reader->bytes < reader->size)
+			reader->scratch |= (u64)reader->data[reader->bytes] << reader->scratchBits;
+		else
+			reader->overflow = true;
+
+		reader->bytes++;
+		reader->scratchBits += 8;
+	}
+
+	u32 value = (u32)(reader->scratch & (((u64)1 << count) - 1));
+	reader->scratch >>= count;
+	reader->scratchBits -= count;
+
+	return value;
+}
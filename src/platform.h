@@ -0,0 +1,75 @@
+#pragma once
+
+#ifndef _WIN32
+#define _GNU_SOURCE
+#endif
+
+#include "math.h"
+
+enum NetFamily : u16 {
+	NET_FAMILY_NONE,
+	NET_FAMILY_V4,
+	NET_FAMILY_V6
+};
+
+struct NetAddress {
+	enum NetFamily family;
+	u16 port; // network byte order
+	union {
+		u8 v4[4];
+		u8 v6[16];
+	} ip;
+};
+
+struct NetPacket {
+	struct NetAddress address;
+	u32 size;
+	u8* data;
+};
+
+enum PlatformFileMode : u8 {
+	PLATFORM_FILE_READ,
+	PLATFORM_FILE_READ_WRITE // created if missing
+};
+
+#ifdef _WIN32
+#include "platform_win32.h"
+#else
+#include "platform_posix.h"
+#endif
+
+static inline struct NetAddress netAddressV4(u8 a, u8 b, u8 c, u8 d, u16 port) {
+	return (struct NetAddress){
+		.family = NET_FAMILY_V4,
+		.port = __builtin_bswap16(port),
+		.ip.v4 = { a, b, c, d }
+	};
+}
+
+static inline u32 netAddressHash(const struct NetAddress* address) {
+	u32 words[4] = { };
+	__builtin_memcpy(words, address->ip.v6, address->family == NET_FAMILY_V6 ? sizeof(address->ip.v6) : sizeof(address->ip.v4));
+
+	u32 h = (u32)address->family << 16 | address->port;
+	for (u32 i = 0; i < 4; i++) {
+		h ^= words[i];
+		h ^= h >> 16;
+		h *= 0x7feb352d;
+		h ^= h >> 15;
+		h *= 0x846ca68b;
+		h ^= h >> 16;
+	}
+
+	return h;
+}
+
+static inline bool netAddressEqual(const struct NetAddress* a, const struct NetAddress* b) {
+	if (a->family != b->family || a->port != b->port)
+		return false;
+
+	switch (a->family) {
+		case NET_FAMILY_V4: return __builtin_memcmp(a->ip.v4, b->ip.v4, sizeof(a->ip.v4)) == 0;
+		case NET_FAMILY_V6: return __builtin_memcmp(a->ip.v6, b->ip.v6, sizeof(a->ip.v6)) == 0;
+		default: return true;
+	}
+}
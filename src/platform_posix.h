@@ -0,0 +1,398 @@
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <signal.h>
+#include <errno.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define INCBIN(name, file) \
+	__asm__(".section .rodata\n" \
+			".global incbin_" #name "_start\n" \
+			".balign 16\n" \
+			"incbin_" #name "_start:\n" \
+			".incbin \"" file "\"\n" \
+			".global incbin_" #name "_end\n" \
+			".balign 1\n" \
+			"incbin_" #name "_end:\n" \
+			".previous\n" \
+	); \
+	extern __attribute__((aligned(16))) const char incbin_ ## name ## _start[]; \
+	extern const char incbin_ ## name ## _end[]
+
+typedef int PlatformFile;
+typedef sem_t PlatformSemaphore;
+
+#define PLATFORM_THREAD_FUNCTION(name) void* name(void* arg)
+typedef void* (*PlatformThreadFunction)(void*);
+
+static int sock = -1;
+
+static volatile sig_atomic_t quitRequested;
+
+// there is no audio device on a headless box; the null sink consumes frames in real time
+static struct {
+	u32 samplesPerSecond;
+	u32 bufferFrames;
+	u64 framesConsumed;
+	u64 start;
+	i16* data;
+} audioSink;
+
+__attribute__((noreturn)) static inline void posixFatal(const char* fn, int err) {
+	fprintf(stderr, "%s: %s\n", fn, strerror(err));
+	exit(EXIT_FAILURE);
+}
+
+__attribute__((noreturn)) static inline void platformExit(u32 code) {
+	exit((int)code);
+}
+
+static inline u64 platformClock(void) {
+	struct timespec ts;
+	if (clock_gettime(CLOCK_MONOTONIC, &ts))
+		posixFatal("clock_gettime", errno);
+
+	return (u64)ts.tv_sec * 1000000000ull + (u64)ts.tv_nsec;
+}
+
+static inline void onQuitSignal(int) {
+	quitRequested = 1;
+}
+
+static inline bool platformPollEvents(void) {
+	static bool installed;
+	if (!installed) {
+		installed = true;
+
+		if (signal(SIGINT, onQuitSignal) == SIG_ERR || signal(SIGTERM, onQuitSignal) == SIG_ERR)
+			posixFatal("signal", errno);
+	}
+
+	return !quitRequested;
+}
+
+static inline void platformSocketOpen(u16 port) {
+	if ((sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP)) == -1)
+		posixFatal("socket", errno);
+
+	if (fcntl(sock, F_SETFL, fcntl(sock, F_GETFL) | O_NONBLOCK) == -1)
+		posixFatal("fcntl", errno);
+
+	if (bind(sock, (struct sockaddr*)&(struct sockaddr_in){
+		.sin_family = AF_INET,
+		.sin_port = __builtin_bswap16(port)
+	}, sizeof(struct sockaddr_in)) == -1)
+		posixFatal("bind", errno);
+}
+
+static inline bool posixToNetAddress(const struct sockaddr_storage* address, struct NetAddress* to) {
+	if (address->ss_family == AF_INET) {
+		const struct sockaddr_in* v4 = (const struct sockaddr_in*)address;
+		to->family = NET_FAMILY_V4;
+		to->port = v4->sin_port;
+		__builtin_memcpy(to->ip.v4, &v4->sin_addr, sizeof(to->ip.v4));
+	} else if (address->ss_family == AF_INET6) {
+		const struct sockaddr_in6* v6 = (const struct sockaddr_in6*)address;
+		to->family = NET_FAMILY_V6;
+		to->port = v6->sin6_port;
+		__builtin_memcpy(to->ip.v6, &v6->sin6_addr, sizeof(to->ip.v6));
+	} else
+		return false;
+
+	return true;
+}
+
+static inline socklen_t posixFromNetAddress(const struct NetAddress* address, struct sockaddr_storage* to) {
+	*to = (struct sockaddr_storage){ };
+
+	if (address->family == NET_FAMILY_V4) {
+		struct sockaddr_in* v4 = (struct sockaddr_in*)to;
+		v4->sin_family = AF_INET;
+		v4->sin_port = address->port;
+		__builtin_memcpy(&v4->sin_addr, address->ip.v4, sizeof(address->ip.v4));
+		return sizeof(struct sockaddr_in);
+	} else {
+		struct sockaddr_in6* v6 = (struct sockaddr_in6*)to;
+		v6->sin6_family = AF_INET6;
+		v6->sin6_port = address->port;
+		__builtin_memcpy(&v6->sin6_addr, address->ip.v6, sizeof(address->ip.v6));
+		return sizeof(struct sockaddr_in6);
+	}
+}
+
+// returns -1 once the socket is drained
+static inline i32 platformSocketReceive(void* buff, u32 size, struct NetAddress* from) {
+	for (;;) {
+		struct sockaddr_storage address;
+
+		ssize_t bytesReceived;
+		if ((bytesReceived = recvfrom(sock, buff, size, 0, (struct sockaddr*)&address, &(socklen_t){ sizeof(struct sockaddr_storage) })) == -1) {
+			if (errno == EAGAIN || errno == EWOULDBLOCK)
+				return -1;
+
+			if (errno == EINTR || errno == ECONNREFUSED)
+				continue;
+
+			posixFatal("recvfrom", errno);
+		}
+
+		if (!posixToNetAddress(&address, from))
+			continue;
+
+		return (i32)bytesReceived;
+	}
+}
+
+static inline void platformSocketSend(const void* buff, u32 size, const struct NetAddress* to) {
+	struct sockaddr_storage address;
+	socklen_t addressLength = posixFromNetAddress(to, &address);
+
+	if (sendto(sock, buff, size, 0, (struct sockaddr*)&address, addressLength) == -1 && errno != EAGAIN && errno != EWOULDBLOCK && errno != ECONNREFUSED)
+		posixFatal("sendto", errno);
+}
+
+#ifdef __linux__
+#define PLATFORM_SOCKET_BATCH 64
+
+// fills packets[i].data (each capacity bytes) and returns how many arrived; stops once the socket is drained
+static inline u32 platformSocketReceiveMany(struct NetPacket* packets, u32 count, u32 capacity) {
+	u32 received = 0;
+
+	while (received < count) {
+		struct mmsghdr headers[PLATFORM_SOCKET_BATCH];
+		struct iovec iovecs[PLATFORM_SOCKET_BATCH];
+		struct sockaddr_storage addresses[PLATFORM_SOCKET_BATCH];
+
+		u32 batch = count - received < PLATFORM_SOCKET_BATCH ? count - received : PLATFORM_SOCKET_BATCH;
+		for (u32 i = 0; i < batch; i++) {
+			iovecs[i] = (struct iovec){ .iov_base = packets[received + i].data, .iov_len = capacity };
+			headers[i] = (struct mmsghdr){
+				.msg_hdr = {
+					.msg_name = &addresses[i],
+					.msg_namelen = sizeof(struct sockaddr_storage),
+					.msg_iov = &iovecs[i],
+					.msg_iovlen = 1
+				}
+			};
+		}
+
+		int messages;
+		if ((messages = recvmmsg(sock, headers, batch, MSG_DONTWAIT, NULL)) == -1) {
+			if (errno == EINTR || errno == ECONNREFUSED)
+				continue;
+
+			if (errno == EAGAIN || errno == EWOULDBLOCK)
+				break;
+
+			posixFatal("recvmmsg", errno);
+		}
+
+		// datagrams from unknown address families are dropped in place
+		u32 kept = 0;
+		for (u32 i = 0; i < (u32)messages; i++) {
+			struct NetPacket* packet = &packets[received + kept];
+
+			if (!posixToNetAddress(&addresses[i], &packet->address))
+				continue;
+
+			if (kept != i)
+				__builtin_memcpy(packet->data, packets[received + i].data, headers[i].msg_len);
+
+			packet->size = headers[i].msg_len;
+			kept++;
+		}
+
+		received += kept;
+
+		if ((u32)messages < batch)
+			break;
+	}
+
+	return received;
+}
+
+static inline void platformSocketSendMany(const struct NetPacket* packets, u32 count) {
+	for (u32 sent = 0; sent < count;) {
+		struct mmsghdr headers[PLATFORM_SOCKET_BATCH];
+		struct iovec iovecs[PLATFORM_SOCKET_BATCH];
+		struct sockaddr_storage addresses[PLATFORM_SOCKET_BATCH];
+
+		u32 batch = count - sent < PLATFORM_SOCKET_BATCH ? count - sent : PLATFORM_SOCKET_BATCH;
+		for (u32 i = 0; i < batch; i++) {
+			iovecs[i] = (struct iovec){ .iov_base = packets[sent + i].data, .iov_len = packets[sent + i].size };
+			headers[i] = (struct mmsghdr){
+				.msg_hdr = {
+					.msg_name = &addresses[i],
+					.msg_namelen = posixFromNetAddress(&packets[sent + i].address, &addresses[i]),
+					.msg_iov = &iovecs[i],
+					.msg_iovlen = 1
+				}
+			};
+		}
+
+		int messages;
+		if ((messages = sendmmsg(sock, headers, batch, 0)) == -1) {
+			if (errno == EINTR)
+				continue;
+
+			// -1 means the first datagram failed; a full socket buffer or an unreachable peer drops just that one, as sendto
+			// would, and the rest of the batch is tried again so one peer can't cost the others their packets
+			if (errno != EAGAIN && errno != EWOULDBLOCK && errno != ECONNREFUSED)
+				posixFatal("sendmmsg", errno);
+
+			messages = 1;
+		}
+
+		sent += (u32)messages;
+	}
+}
+#else
+static inline u32 platformSocketReceiveMany(struct NetPacket* packets, u32 count, u32 capacity) {
+	u32 received = 0;
+
+	i32 bytesReceived;
+	while (received < count && (bytesReceived = platformSocketReceive(packets[received].data, capacity, &packets[received].address)) != -1)
+		packets[received++].size = (u32)bytesReceived;
+
+	return received;
+}
+
+static inline void platformSocketSendMany(const struct NetPacket* packets, u32 count) {
+	for (u32 i = 0; i < count; i++)
+		platformSocketSend(packets[i].data, packets[i].size, &packets[i].address);
+}
+#endif
+
+// blocks until a datagram arrives or the timeout expires
+static inline void platformSocketWait(u32 ms) {
+	if (poll(&(struct pollfd){ .fd = sock, .events = POLLIN }, 1, (int)ms) == -1 && errno != EINTR)
+		posixFatal("poll", errno);
+}
+
+static inline PlatformFile platformFileOpen(const char* path, enum PlatformFileMode mode) {
+	PlatformFile file = open(path, mode == PLATFORM_FILE_READ ? O_RDONLY : O_RDWR | O_CREAT, 0644);
+
+	if (file == -1)
+		posixFatal("open", errno);
+
+	return file;
+}
+
+static inline u64 platformFileSize(PlatformFile file) {
+	struct stat st;
+	if (fstat(file, &st) == -1)
+		posixFatal("fstat", errno);
+
+	return (u64)st.st_size;
+}
+
+static inline u32 platformFileRead(PlatformFile file, void* buff, u32 size) {
+	ssize_t bytesRead;
+	if ((bytesRead = read(file, buff, size)) == -1)
+		posixFatal("read", errno);
+
+	return (u32)bytesRead;
+}
+
+static inline void platformFileWrite(PlatformFile file, const void* buff, u32 size) {
+	if (write(file, buff, size) == -1)
+		posixFatal("write", errno);
+}
+
+static inline void platformFileRewind(PlatformFile file) {
+	if (lseek(file, 0, SEEK_SET) == -1)
+		posixFatal("lseek", errno);
+}
+
+static inline void platformFileClose(PlatformFile file) {
+	if (close(file) == -1)
+		posixFatal("close", errno);
+}
+
+// 16-bit stereo PCM; returns the size of the device buffer in frames
+static inline u32 platformAudioOpen(u32 samplesPerSecond) {
+	audioSink.samplesPerSecond = samplesPerSecond;
+	audioSink.bufferFrames = samplesPerSecond;
+	audioSink.start = platformClock();
+
+	if (!(audioSink.data = malloc(audioSink.bufferFrames * 2 * sizeof(i16))))
+		posixFatal("malloc", errno);
+
+	return audioSink.bufferFrames;
+}
+
+static inline i16* platformAudioAcquire(u32* frames) {
+	u64 played = ((platformClock() - audioSink.start) * audioSink.samplesPerSecond) / 1000000000ull;
+	u64 padding = audioSink.framesConsumed > played ? audioSink.framesConsumed - played : 0;
+
+	*frames = padding >= audioSink.bufferFrames ? 0 : audioSink.bufferFrames - (u32)padding;
+
+	return audioSink.data;
+}
+
+static inline void platformAudioRelease(u32 frames) {
+	u64 played = ((platformClock() - audioSink.start) * audioSink.samplesPerSecond) / 1000000000ull;
+	if (audioSink.framesConsumed < played)
+		audioSink.framesConsumed = played;
+
+	audioSink.framesConsumed += frames;
+}
+
+static inline u32 platformCpuCount(void) {
+	long count = sysconf(_SC_NPROCESSORS_ONLN);
+	return count > 0 ? (u32)count : 1;
+}
+
+static inline void platformThreadStart(PlatformThreadFunction function, void* arg) {
+	pthread_t thread;
+	int err;
+	if ((err = pthread_create(&thread, NULL, function, arg)))
+		posixFatal("pthread_create", err);
+
+	pthread_detach(thread);
+}
+
+static inline void platformSemaphoreInit(PlatformSemaphore* semaphore) {
+	if (sem_init(semaphore, 0, 0))
+		posixFatal("sem_init", errno);
+}
+
+static inline void platformSemaphoreWait(PlatformSemaphore* semaphore) {
+	while (sem_wait(semaphore))
+		if (errno != EINTR)
+			posixFatal("sem_wait", errno);
+}
+
+static inline void platformSemaphoreSignal(PlatformSemaphore* semaphore, u32 count) {
+	while (count--)
+		if (sem_post(semaphore))
+			posixFatal("sem_post", errno);
+}
+
+// address space only, nothing is backed until committed
+static inline void* platformMemoryReserve(u64 size) {
+	void* address = mmap(NULL, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+	if (address == MAP_FAILED)
+		posixFatal("mmap", errno);
+
+	return address;
+}
+
+// zeroed on first commit
+static inline void platformMemoryCommit(void* address, u64 size) {
+	if (mprotect(address, size, PROT_READ | PROT_WRITE))
+		posixFatal("mprotect", errno);
+}
+
+__attribute__((noreturn)) static inline void platformOutOfMemory(const char* fn) {
+	posixFatal(fn, ENOMEM);
+}
@@ -0,0 +1,352 @@
+#pragma comment(lib, "kernel32.lib")
+#pragma comment(lib, "user32.lib")
+#pragma comment(lib, "ws2_32.lib")
+#pragma comment(lib, "ole32.lib")
+
+#define STRICT
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#define _WINSOCK_DEPRECATED_NO_WARNINGS
+#include <Windows.h>
+#include <WinSock2.h>
+#include <WS2tcpip.h>
+#include <mmdeviceapi.h>
+#include <Audioclient.h>
+
+#define INCBIN(name, file) \
+	__asm__(".section .rdata, \"dr\"\n" \
+			".global incbin_" #name "_start\n" \
+			".balign 16\n" \
+			"incbin_" #name "_start:\n" \
+			".incbin \"" file "\"\n" \
+			".global incbin_" #name "_end\n" \
+			".balign 1\n" \
+			"incbin_" #name "_end:\n" \
+	); \
+	extern __attribute__((aligned(16))) const char incbin_ ## name ## _start[]; \
+	extern const char incbin_ ## name ## _end[]
+
+typedef HANDLE PlatformFile;
+typedef HANDLE PlatformSemaphore;
+
+#define PLATFORM_THREAD_FUNCTION(name) DWORD WINAPI name(void* arg)
+typedef LPTHREAD_START_ROUTINE PlatformThreadFunction;
+
+static SOCKET sock;
+
+static LARGE_INTEGER clockFrequency;
+
+static IAudioClient* audioClient;
+static IAudioRenderClient* audioRenderClient;
+static UINT32 audioBufferSize;
+
+__attribute__((noreturn)) static inline void win32Fatal(const char* fn, DWORD err) {
+	char buff[1024];
+	if (FormatMessageA(FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS, NULL, err, MAKELANGID(LANG_NEUTRAL, SUBLANG_NEUTRAL), buff, sizeof(buff), NULL)) {
+		char buff2[1024];
+		__builtin_sprintf(buff2, "%s: %s", fn, buff);
+		MessageBoxA(NULL, buff2, NULL, MB_OK | MB_ICONEXCLAMATION);
+	}
+
+	ExitProcess(EXIT_FAILURE);
+}
+
+__attribute__((noreturn)) static inline void platformExit(u32 code) {
+	ExitProcess(code);
+}
+
+static inline u64 platformClock(void) {
+	if (!clockFrequency.QuadPart && !QueryPerformanceFrequency(&clockFrequency))
+		win32Fatal("QueryPerformanceFrequency", GetLastError());
+
+	LARGE_INTEGER counter;
+	if (!QueryPerformanceCounter(&counter))
+		win32Fatal("QueryPerformanceCounter", GetLastError());
+
+	u64 seconds = (u64)(counter.QuadPart / clockFrequency.QuadPart);
+	u64 remainder = (u64)(counter.QuadPart % clockFrequency.QuadPart);
+
+	return seconds * 1000000000ull + (remainder * 1000000000ull) / (u64)clockFrequency.QuadPart;
+}
+
+static inline bool platformPollEvents(void) {
+	MSG msg;
+	while (PeekMessageW(&msg, NULL, 0, 0, PM_REMOVE)) {
+		if (msg.message == WM_QUIT)
+			return false;
+
+		TranslateMessage(&msg);
+		DispatchMessageW(&msg);
+	}
+
+	return true;
+}
+
+static inline void platformSocketOpen(u16 port) {
+	WSADATA wsaData;
+	int wr = WSAStartup(MAKEWORD(2, 2), &wsaData);
+	if (wr != NO_ERROR)
+		win32Fatal("WSAStartup", (DWORD)wr);
+
+	if ((sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP)) == INVALID_SOCKET)
+		win32Fatal("socket", (DWORD)WSAGetLastError());
+
+	if (ioctlsocket(sock, FIONBIO, &(u_long){ 1 }) == SOCKET_ERROR)
+		win32Fatal("ioctlsocket", (DWORD)WSAGetLastError());
+
+	if (bind(sock, (struct sockaddr*)&(struct sockaddr_in){
+		.sin_family = AF_INET,
+		.sin_port = htons(port)
+	}, sizeof(struct sockaddr_in)) == SOCKET_ERROR)
+		win32Fatal("bind", (DWORD)WSAGetLastError());
+}
+
+// returns -1 once the socket is drained
+static inline i32 platformSocketReceive(void* buff, u32 size, struct NetAddress* from) {
+	for (;;) {
+		struct sockaddr_storage address;
+
+		int bytesReceived;
+		if ((bytesReceived = recvfrom(sock, buff, (int)size, 0, (struct sockaddr*)&address, &(int){ sizeof(struct sockaddr_storage) })) == SOCKET_ERROR) {
+			int wr = WSAGetLastError();
+			if (wr == WSAEWOULDBLOCK)
+				return -1;
+
+			// an ICMP port unreachable from an earlier sendto, not a failure of this socket
+			if (wr == WSAECONNRESET)
+				continue;
+
+			win32Fatal("recvfrom", (DWORD)wr);
+		}
+
+		if (address.ss_family == AF_INET) {
+			struct sockaddr_in* v4 = (struct sockaddr_in*)&address;
+			from->family = NET_FAMILY_V4;
+			from->port = v4->sin_port;
+			__builtin_memcpy(from->ip.v4, &v4->sin_addr, sizeof(from->ip.v4));
+		} else if (address.ss_family == AF_INET6) {
+			struct sockaddr_in6* v6 = (struct sockaddr_in6*)&address;
+			from->family = NET_FAMILY_V6;
+			from->port = v6->sin6_port;
+			__builtin_memcpy(from->ip.v6, &v6->sin6_addr, sizeof(from->ip.v6));
+		} else
+			continue;
+
+		return bytesReceived;
+	}
+}
+
+static inline void platformSocketSend(const void* buff, u32 size, const struct NetAddress* to) {
+	struct sockaddr_storage address = { 0 };
+	int addressLength;
+
+	if (to->family == NET_FAMILY_V4) {
+		struct sockaddr_in* v4 = (struct sockaddr_in*)&address;
+		v4->sin_family = AF_INET;
+		v4->sin_port = to->port;
+		__builtin_memcpy(&v4->sin_addr, to->ip.v4, sizeof(to->ip.v4));
+		addressLength = sizeof(struct sockaddr_in);
+	} else {
+		struct sockaddr_in6* v6 = (struct sockaddr_in6*)&address;
+		v6->sin6_family = AF_INET6;
+		v6->sin6_port = to->port;
+		__builtin_memcpy(&v6->sin6_addr, to->ip.v6, sizeof(to->ip.v6));
+		addressLength = sizeof(struct sockaddr_in6);
+	}
+
+	if (sendto(sock, buff, (int)size, 0, (struct sockaddr*)&address, addressLength) == SOCKET_ERROR) {
+		int wr = WSAGetLastError();
+		if (wr != WSAEWOULDBLOCK)
+			win32Fatal("sendto", (DWORD)wr);
+	}
+}
+
+// winsock has no portable batched datagram calls, so these loop over the single versions
+static inline u32 platformSocketReceiveMany(struct NetPacket* packets, u32 count, u32 capacity) {
+	u32 received = 0;
+
+	i32 bytesReceived;
+	while (received < count && (bytesReceived = platformSocketReceive(packets[received].data, capacity, &packets[received].address)) != -1)
+		packets[received++].size = (u32)bytesReceived;
+
+	return received;
+}
+
+static inline void platformSocketSendMany(const struct NetPacket* packets, u32 count) {
+	for (u32 i = 0; i < count; i++)
+		platformSocketSend(packets[i].data, packets[i].size, &packets[i].address);
+}
+
+// blocks until a datagram arrives or the timeout expires
+static inline void platformSocketWait(u32 ms) {
+	fd_set readSet;
+	FD_ZERO(&readSet);
+	FD_SET(sock, &readSet);
+
+	if (select(0, &readSet, NULL, NULL, &(struct timeval){ .tv_sec = (long)(ms / 1000), .tv_usec = (long)(ms % 1000) * 1000 }) == SOCKET_ERROR)
+		win32Fatal("select", (DWORD)WSAGetLastError());
+}
+
+static inline PlatformFile platformFileOpen(const char* path, enum PlatformFileMode mode) {
+	PlatformFile file = CreateFileA(path,
+		mode == PLATFORM_FILE_READ ? GENERIC_READ : GENERIC_READ | GENERIC_WRITE,
+		mode == PLATFORM_FILE_READ ? FILE_SHARE_READ : 0,
+		NULL,
+		mode == PLATFORM_FILE_READ ? OPEN_EXISTING : OPEN_ALWAYS,
+		FILE_ATTRIBUTE_NORMAL,
+		NULL);
+
+	if (file == INVALID_HANDLE_VALUE)
+		win32Fatal("CreateFileA", GetLastError());
+
+	return file;
+}
+
+static inline u64 platformFileSize(PlatformFile file) {
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file, &fileSize))
+		win32Fatal("GetFileSizeEx", GetLastError());
+
+	return (u64)fileSize.QuadPart;
+}
+
+static inline u32 platformFileRead(PlatformFile file, void* buff, u32 size) {
+	DWORD bytesRead;
+	if (!ReadFile(file, buff, size, &bytesRead, NULL))
+		win32Fatal("ReadFile", GetLastError());
+
+	return bytesRead;
+}
+
+static inline void platformFileWrite(PlatformFile file, const void* buff, u32 size) {
+	DWORD bytesWritten;
+	if (!WriteFile(file, buff, size, &bytesWritten, NULL))
+		win32Fatal("WriteFile", GetLastError());
+}
+
+static inline void platformFileRewind(PlatformFile file) {
+	if (SetFilePointer(file, 0, NULL, FILE_BEGIN) == INVALID_SET_FILE_POINTER)
+		win32Fatal("SetFilePointer", GetLastError());
+}
+
+static inline void platformFileClose(PlatformFile file) {
+	if (!CloseHandle(file))
+		win32Fatal("CloseHandle", GetLastError());
+}
+
+// 16-bit stereo PCM; returns the size of the device buffer in frames
+static inline u32 platformAudioOpen(u32 samplesPerSecond) {
+	static const GUID CLSID_MMDeviceEnumerator = { 0xbcde0395, 0xe52f, 0x467c, { 0x8e, 0x3d, 0xc4, 0x57, 0x92, 0x91, 0x69, 0x2e } };
+	static const GUID IID_IMMDeviceEnumerator = { 0xa95664d2, 0x9614, 0x4f35, { 0xa7, 0x46, 0xde, 0x8d, 0xb6, 0x36, 0x17, 0xe6 } };
+	static const GUID IID_IAudioClient = { 0x1cb9ad4c, 0xdbfa, 0x4c32, { 0xb1, 0x78, 0xc2, 0xf5, 0x68, 0xa7, 0x03, 0xb2 } };
+	static const GUID IID_IAudioRenderClient = { 0xf294acfc, 0x3146, 0x4483, { 0xa7, 0xbf, 0xad, 0xdc, 0xa7, 0xc2, 0x60, 0xe2 } };
+
+	HRESULT hr;
+	if (FAILED(hr = CoInitializeEx(NULL, COINIT_DISABLE_OLE1DDE | COINIT_SPEED_OVER_MEMORY)))
+		win32Fatal("CoInitializeEx", (DWORD)hr);
+
+	IMMDeviceEnumerator* audioDeviceEnumerator;
+	if (FAILED(hr = CoCreateInstance(&CLSID_MMDeviceEnumerator, NULL, CLSCTX_ALL, &IID_IMMDeviceEnumerator, (void**)&audioDeviceEnumerator)))
+		win32Fatal("CoCreateInstance", (DWORD)hr);
+
+	IMMDevice* audioDevice;
+	if (FAILED(hr = audioDeviceEnumerator->lpVtbl->GetDefaultAudioEndpoint(audioDeviceEnumerator, eRender, eConsole, &audioDevice)))
+		win32Fatal("GetDefaultAudioEndpoint", (DWORD)hr);
+
+	if (FAILED(hr = audioDevice->lpVtbl->Activate(audioDevice, &IID_IAudioClient, CLSCTX_ALL, NULL, (void**)&audioClient)))
+		win32Fatal("Activate", (DWORD)hr);
+
+	WAVEFORMATEX waveFormat = {
+		.wFormatTag = WAVE_FORMAT_PCM,
+		.nChannels = 2,
+		.nSamplesPerSec = samplesPerSecond,
+		.wBitsPerSample = sizeof(u16) * 8,
+	};
+	waveFormat.nBlockAlign = (waveFormat.nChannels * waveFormat.wBitsPerSample) / 8;
+	waveFormat.nAvgBytesPerSec = waveFormat.nSamplesPerSec * waveFormat.nBlockAlign;
+
+	if (FAILED(hr = audioClient->lpVtbl->Initialize(audioClient, AUDCLNT_SHAREMODE_SHARED, AUDCLNT_STREAMFLAGS_AUTOCONVERTPCM | AUDCLNT_STREAMFLAGS_SRC_DEFAULT_QUALITY, 10000000, 0, &waveFormat, NULL)))
+		win32Fatal("Initialize", (DWORD)hr);
+
+	if (FAILED(hr = audioClient->lpVtbl->GetService(audioClient, &IID_IAudioRenderClient, (void**)&audioRenderClient)))
+		win32Fatal("GetService", (DWORD)hr);
+
+	if (FAILED(hr = audioClient->lpVtbl->GetBufferSize(audioClient, &audioBufferSize)))
+		win32Fatal("GetBufferSize", (DWORD)hr);
+
+	if (FAILED(hr = audioClient->lpVtbl->Start(audioClient)))
+		win32Fatal("Start", (DWORD)hr);
+
+	return audioBufferSize;
+}
+
+static inline i16* platformAudioAcquire(u32* frames) {
+	HRESULT hr;
+
+	UINT32 padding;
+	if (FAILED(hr = audioClient->lpVtbl->GetCurrentPadding(audioClient, &padding)))
+		win32Fatal("GetCurrentPadding", (DWORD)hr);
+
+	*frames = audioBufferSize - padding;
+
+	INT16* audioBuffer;
+	if (FAILED(hr = audioRenderClient->lpVtbl->GetBuffer(audioRenderClient, *frames, (BYTE**)&audioBuffer)))
+		win32Fatal("GetBuffer", (DWORD)hr);
+
+	return audioBuffer;
+}
+
+static inline void platformAudioRelease(u32 frames) {
+	HRESULT hr;
+	if (FAILED(hr = audioRenderClient->lpVtbl->ReleaseBuffer(audioRenderClient, frames, 0)))
+		win32Fatal("ReleaseBuffer", (DWORD)hr);
+}
+
+static inline u32 platformCpuCount(void) {
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+
+	return info.dwNumberOfProcessors;
+}
+
+static inline void platformThreadStart(PlatformThreadFunction function, void* arg) {
+	HANDLE thread = CreateThread(NULL, 0, function, arg, 0, NULL);
+	if (!thread)
+		win32Fatal("CreateThread", GetLastError());
+
+	CloseHandle(thread);
+}
+
+static inline void platformSemaphoreInit(PlatformSemaphore* semaphore) {
+	if (!(*semaphore = CreateSemaphoreW(NULL, 0, LONG_MAX, NULL)))
+		win32Fatal("CreateSemaphoreW", GetLastError());
+}
+
+static inline void platformSemaphoreWait(PlatformSemaphore* semaphore) {
+	if (WaitForSingleObject(*semaphore, INFINITE) != WAIT_OBJECT_0)
+		win32Fatal("WaitForSingleObject", GetLastError());
+}
+
+static inline void platformSemaphoreSignal(PlatformSemaphore* semaphore, u32 count) {
+	if (!ReleaseSemaphore(*semaphore, (LONG)count, NULL))
+		win32Fatal("ReleaseSemaphore", GetLastError());
+}
+
+// address space only, nothing is backed until committed
+static inline void* platformMemoryReserve(u64 size) {
+	void* address = VirtualAlloc(NULL, size, MEM_RESERVE, PAGE_NOACCESS);
+	if (!address)
+		win32Fatal("VirtualAlloc", GetLastError());
+
+	return address;
+}
+
+// zeroed on first commit
+static inline void platformMemoryCommit(void* address, u64 size) {
+	if (!VirtualAlloc(address, size, MEM_COMMIT, PAGE_READWRITE))
+		win32Fatal("VirtualAlloc", GetLastError());
+}
+
+__attribute__((noreturn)) static inline void platformOutOfMemory(const char* fn) {
+	win32Fatal(fn, ERROR_NOT_ENOUGH_MEMORY);
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "math.h"
+
+// fixed-capacity slot pools: items stay put in data[slot] for as long as they live, while dense keeps a permutation of
+// every slot ever handed out with the live ones packed at the front, so inserting, removing and walking are all O(1) per
+// item and never touch a free slot. Slots are reused, so anything kept across frames holds a handle instead: the slot
+// plus the generation it had, which stops resolving once the slot is removed.
+#define POOL_NONE ((u16)-1)
+
+typedef u32 PoolHandle; // slot | generation << 16
+
+#define POOL_HANDLE_NONE ((PoolHandle)-1)
+
+struct PoolIndex {
+	u16* dense; // [0, count) live slots, [count, high) free ones
+	u16* sparse; // position of each slot in dense
+	u16* generations;
+	u16 count;
+	u16 high; // slots handed out at least once
+	u16 capacity;
+};
+
+#define POOL(T) struct { \
+	T* data; \
+	struct PoolIndex index; \
+}
+
+#define POOL_INIT(T, n) { \
+	.data = (T[n]){ }, \
+	.index = { \
+		.dense = (u16[n]){ }, \
+		.sparse = (u16[n]){ }, \
+		.generations = (u16[n]){ }, \
+		.capacity = n \
+	} \
+}
+
+static inline bool poolAlive(const struct PoolIndex* pool, u16 slot) {
+	return slot < pool->high && pool->sparse[slot] < pool->count;
+}
+
+static inline void poolSwap(struct PoolIndex* pool, u16 a, u16 b) {
+	u16 slotA = pool->dense[a];
+	u16 slotB = pool->dense[b];
+
+	pool->dense[a] = slotB;
+	pool->dense[b] = slotA;
+	pool->sparse[slotA] = b;
+	pool->sparse[slotB] = a;
+}
+
+// the most recently freed slot, or a fresh one; POOL_NONE when full
+static inline u16 poolInsert(struct PoolIndex* pool) {
+	if (pool->count == pool->high) {
+		if (pool->high == pool->capacity)
+			return POOL_NONE;
+
+		pool->dense[pool->high] = pool->high;
+		pool->sparse[pool->high] = pool->high;
+		pool->high++;
+	}
+
+	return pool->dense[pool->count++];
+}
+
+// claims a particular slot, for pools that mirror ids handed out elsewhere; does nothing if it's already live, and
+// returns false for a slot past the end of the pool
+static inline bool poolInsertAt(struct PoolIndex* pool, u16 slot) {
+	if (slot >= pool->capacity)
+		return false;
+
+	for (; pool->high <= slot; pool->high++) {
+		pool->dense[pool->high] = pool->high;
+		pool->sparse[pool->high] = pool->high;
+	}
+
+	if (pool->sparse[slot] >= pool->count)
+		poolSwap(pool, pool->sparse[slot], pool->count++);
+
+	return true;
+}
+
+// the last live slot takes the removed one's place in dense, so a walk removing as it goes should run back to front
+static inline void poolRemove(struct PoolIndex* pool, u16 slot) {
+	poolSwap(pool, pool->sparse[slot], --pool->count);
+	pool->generations[slot]++;
+}
+
+static inline PoolHandle poolHandle(const struct PoolIndex* pool, u16 slot) {
+	return (PoolHandle)pool->generations[slot] << 16 | slot;
+}
+
+// the slot a handle was made for, or POOL_NONE if that item has since been removed
+static inline u16 poolResolve(const struct PoolIndex* pool, PoolHandle handle) {
+	u16 slot = (u16)handle;
+
+	if (handle == POOL_HANDLE_NONE || !poolAlive(pool, slot) || pool->generations[slot] != (u16)(handle >> 16))
+		return POOL_NONE;
+
+	return slot;
+}
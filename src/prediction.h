@@ -0,0 +1,219 @@
+#pragma once
+
+#include "simulation.h"
+#include "net.h"
+
+// 0x00 [newest sequence u16][count u8][count inputs, oldest first, as yaw u16 buttons u8]
+// the last few inputs ride along with each new one, so a lost datagram costs nothing
+#define PLAYER_INPUT_REDUNDANCY 4
+#define PLAYER_INPUT_HEADER_SIZE 4
+#define PLAYER_INPUT_SIZE 3
+
+// 0x04 [input sequence u16][position u32 x3][velocity i32 x3], the server's state after applying that input
+#define PLAYER_CORRECTION_SIZE 27
+
+#define PREDICTION_HISTORY 64 // power of two, inputs the client can have in flight
+
+struct PredictedState {
+	u32 position[3];
+	i32 velocity[3];
+};
+
+// client: every input sent since the last correction and the state it was predicted to produce, indexed by sequence
+static struct {
+	struct PlayerInput inputs[PREDICTION_HISTORY];
+	struct PredictedState states[PREDICTION_HISTORY];
+	u16 sequence; // next input
+	u16 corrected; // newest input the server has reported on
+	u32 sent;
+	u16 entity;
+	bool active;
+	bool correctedAny;
+
+	u32 corrections; // corrections that disagreed with the prediction
+	u32 replayed; // inputs re-simulated because of them
+} prediction;
+
+static inline struct PredictedState bodyState(u16 body) {
+	return (struct PredictedState){
+		{ bodies.positionX[body], bodies.positionY[body], bodies.positionZ[body] },
+		{ bodies.velocityX[body], bodies.velocityY[body], bodies.velocityZ[body] }
+	};
+}
+
+static inline void bodySetState(u16 body, const struct PredictedState* state) {
+	bodies.positionX[body] = state->position[0];
+	bodies.positionY[body] = state->position[1];
+	bodies.positionZ[body] = state->position[2];
+	bodies.velocityX[body] = state->velocity[0];
+	bodies.velocityY[body] = state->velocity[1];
+	bodies.velocityZ[body] = state->velocity[2];
+}
+
+// server: queues whatever inputs in the message are new, returns the bytes it occupied or 0 if malformed
+static inline u32 playerInputReceive(struct Client* client, const u8* buff, u32 size) {
+	if (size < PLAYER_INPUT_HEADER_SIZE)
+		return 0;
+
+	u16 newest;
+	__builtin_memcpy(&newest, &buff[1], sizeof(u16));
+	u8 count = buff[3];
+
+	u32 messageSize = PLAYER_INPUT_HEADER_SIZE + count * PLAYER_INPUT_SIZE;
+	if (!count || count > PLAYER_INPUT_BUFFER || messageSize > size)
+		return 0;
+
+	if (!client->inputStarted) {
+		client->inputProcessed = newest - count;
+		client->inputNewest = newest - count;
+		client->inputStarted = true;
+	}
+
+	for (u8 i = 0; i < count; i++) {
+		u16 sequence = newest - (count - 1 - i);
+
+		// already applied, or so far ahead it would overwrite inputs still waiting
+		if (!sequenceNewer(sequence, client->inputProcessed) || (u16)(sequence - client->inputProcessed) > PLAYER_INPUT_BUFFER)
+			continue;
+
+		const u8* input = &buff[PLAYER_INPUT_HEADER_SIZE + i * PLAYER_INPUT_SIZE];
+		struct PlayerInput* slot = &client->inputs[sequence & (PLAYER_INPUT_BUFFER - 1)];
+		__builtin_memcpy(&slot->yaw, input, sizeof(u16));
+		slot->buttons = input[2];
+
+		if (sequenceNewer(sequence, client->inputNewest))
+			client->inputNewest = sequence;
+	}
+
+	return messageSize;
+}
+
+// server: applies the client's next input to its entity ahead of bodiesIntegrate; with nothing queued the body coasts
+static inline void playerInputApply(struct Client* client) {
+	if (!client->inputStarted || client->entity == (u16)-1)
+		return;
+
+	if ((u16)(client->inputNewest - client->inputProcessed) > PLAYER_INPUT_MAX_BACKLOG)
+		client->inputProcessed = client->inputNewest - PLAYER_INPUT_MAX_BACKLOG;
+
+	if (!sequenceNewer(client->inputNewest, client->inputProcessed))
+		return;
+
+	struct Entity* entity = &entities.data[client->entity];
+	struct PlayerInput input = client->inputs[++client->inputProcessed & (PLAYER_INPUT_BUFFER - 1)];
+
+	entity->yaw = binaryAngleToRad(input.yaw);
+	bodyAccelerate(entity->body, playerInputAcceleration(input, entity->speed));
+}
+
+// server: tells the client where its entity ended up after the last input applied, once bodies have integrated
+static inline void playerCorrectionSend(const struct Client* client) {
+	if (!client->inputStarted || client->entity == (u16)-1)
+		return;
+
+	struct PredictedState state = bodyState(entities.data[client->entity].body);
+
+	u8* buff = netSend(&client->address, PLAYER_CORRECTION_SIZE);
+	buff[0] = 0x04;
+	__builtin_memcpy(&buff[1], &client->inputProcessed, sizeof(u16));
+	__builtin_memcpy(&buff[3], &state, sizeof(state));
+}
+
+// client: the server assigned us an entity; from here on it moves by prediction
+static inline void predictionBegin(u16 entity) {
+	struct Entity* e = &entities.data[entity];
+
+	if (!entityHasBody(entity)) {
+		if (!poolInsertAt(&entities.index, entity))
+			return;
+
+		e->body = bodyCreate(entity, (uvec3){ }, 1);
+	}
+
+	e->type = ENTITY_TYPE_PLAYER;
+	e->flags |= ENTITY_IS_PLAYER_CONTROLLED;
+	e->speed = 1 << 15;
+
+	prediction.entity = entity;
+	prediction.active = true;
+}
+
+// client: records this tick's input and applies it, ahead of bodiesIntegrate
+static inline void predictionInput(struct PlayerInput input) {
+	if (!prediction.active)
+		return;
+
+	struct Entity* entity = &entities.data[prediction.entity];
+
+	prediction.inputs[prediction.sequence & (PREDICTION_HISTORY - 1)] = input;
+	entity->yaw = binaryAngleToRad(input.yaw);
+	bodyAccelerate(entity->body, playerInputAcceleration(input, entity->speed));
+}
+
+// client: remembers what the input led to and sends it along with the few before it
+static inline void predictionCommit(const struct NetAddress* to) {
+	if (!prediction.active)
+		return;
+
+	u16 sequence = prediction.sequence++;
+	prediction.states[sequence & (PREDICTION_HISTORY - 1)] = bodyState(entities.data[prediction.entity].body);
+
+	u8 count = (u8)__builtin_elementwise_min(++prediction.sent, (u32)PLAYER_INPUT_REDUNDANCY);
+
+	u8* buff = netSend(to, PLAYER_INPUT_HEADER_SIZE + count * PLAYER_INPUT_SIZE);
+	buff[0] = 0x00;
+	__builtin_memcpy(&buff[1], &sequence, sizeof(u16));
+	buff[3] = count;
+
+	for (u8 i = 0; i < count; i++) {
+		const struct PlayerInput* input = &prediction.inputs[(u16)(sequence - (count - 1 - i)) & (PREDICTION_HISTORY - 1)];
+		u8* out = &buff[PLAYER_INPUT_HEADER_SIZE + i * PLAYER_INPUT_SIZE];
+
+		__builtin_memcpy(out, &input->yaw, sizeof(u16));
+		out[2] = input->buttons;
+	}
+}
+
+// client: rewinds to the server's state for an input and replays everything sent since, if the prediction was off
+static inline u32 predictionCorrect(const u8* buff, u32 size) {
+	if (size < PLAYER_CORRECTION_SIZE)
+		return 0;
+
+	if (!prediction.active)
+		return PLAYER_CORRECTION_SIZE;
+
+	u16 sequence;
+	struct PredictedState state;
+	__builtin_memcpy(&sequence, &buff[1], sizeof(u16));
+	__builtin_memcpy(&state, &buff[3], sizeof(state));
+
+	// stale, reordered, or about inputs that have already left the history
+	u16 pending = prediction.sequence - sequence;
+	if ((prediction.correctedAny && !sequenceNewer(sequence, prediction.corrected)) || !pending || pending > PREDICTION_HISTORY)
+		return PLAYER_CORRECTION_SIZE;
+
+	prediction.corrected = sequence;
+	prediction.correctedAny = true;
+
+	struct PredictedState* predicted = &prediction.states[sequence & (PREDICTION_HISTORY - 1)];
+	if (!__builtin_memcmp(predicted, &state, sizeof(state)))
+		return PLAYER_CORRECTION_SIZE;
+
+	prediction.corrections++;
+
+	struct Entity* entity = &entities.data[prediction.entity];
+	u16 body = entity->body;
+
+	*predicted = state;
+	bodySetState(body, &state);
+
+	for (u16 replay = sequence + 1; replay != prediction.sequence; replay++) {
+		bodyAccelerate(body, playerInputAcceleration(prediction.inputs[replay & (PREDICTION_HISTORY - 1)], entity->speed));
+		bodyIntegrate(body);
+
+		prediction.states[replay & (PREDICTION_HISTORY - 1)] = bodyState(body);
+		prediction.replayed++;
+	}
+
+	return PLAYER_CORRECTION_SIZE;
+}
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "assets.h"
+
+// data the CPU writes once a frame for the GPU to read once, handed out in chunks from the front of a ring over part of
+// BUFFER_FRAME; a frame's chunks come back once its fence has been waited on, so one frame may take whatever the frames
+// still in flight leave free rather than a fixed slice. When even that runs out the frame spills into blocks of its
+// own, released the same way.
+#define RING_CHUNK (64 * 1024) // least taken at once, so streams move chunks rarely
+#define RING_ALIGNMENT 16
+#define RING_SPILL_SIZE (1024 * 1024)
+#define RING_MAX_SPILLS 16 // per frame in flight
+
+struct RingChunk {
+	VkBuffer buffer;
+	VkDeviceSize offset; // into buffer
+	u8* data;
+	u32 size;
+};
+
+struct RingSpill {
+	VkBuffer buffer;
+	struct GpuAllocation allocation;
+	u32 size;
+	u32 used;
+};
+
+struct Ring {
+	VkDeviceSize base; // in BUFFER_FRAME
+	VkDeviceSize size;
+
+	// running byte counts that only ever grow, positions in the ring are taken modulo size
+	VkDeviceSize head;
+	VkDeviceSize tail; // nothing before this is still read by the GPU
+	VkDeviceSize frameHeads[FRAMES_IN_FLIGHT]; // head when each frame was submitted
+
+	struct RingSpill spills[FRAMES_IN_FLIGHT][RING_MAX_SPILLS];
+	u8 spillCounts[FRAMES_IN_FLIGHT];
+
+	// bytes taken this frame, the most any frame has taken, and how many times a frame didn't fit
+	VkDeviceSize used;
+	VkDeviceSize peak;
+	u32 overflows;
+};
+
+static struct Ring frameRing = {
+	.base = BUFFER_OFFSET_STREAMS,
+	.size = BUFFER_RANGE_STREAMS
+};
+
+// after the frame's fence has been waited on
+static inline void ringBeginFrame(struct Ring* ring) {
+	ring->tail = ring->frameHeads[frame];
+	ring->used = 0;
+
+	for (u32 i = 0; i < ring->spillCounts[frame]; i++) {
+		vkDestroyBuffer(device, ring->spills[frame][i].buffer, NULL);
+		gpuFree(&ring->spills[frame][i].allocation);
+	}
+
+	ring->spillCounts[frame] = 0;
+}
+
+static inline void ringEndFrame(struct Ring* ring) {
+	ring->frameHeads[frame] = ring->head;
+	ring->peak = __builtin_elementwise_max(ring->peak, ring->used);
+}
+
+static inline struct RingChunk ringSpill(struct Ring* ring, u32 size) {
+	u8* count = &ring->spillCounts[frame];
+	struct RingSpill* spill = *count ? &ring->spills[frame][*count - 1] : NULL;
+
+	if (!spill || spill->used + size > spill->size) {
+		if (*count == RING_MAX_SPILLS)
+			vkFatal("ringSpill", VK_ERROR_OUT_OF_DEVICE_MEMORY);
+
+		spill = &ring->spills[frame][(*count)++];
+		*spill = (struct RingSpill){ .size = __builtin_elementwise_max(size, (u32)RING_SPILL_SIZE) };
+
+		VkResult r;
+		if ((r = vkCreateBuffer(device, &(VkBufferCreateInfo){
+			.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+			.size = spill->size,
+			.usage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT
+		}, NULL, &spill->buffer)) != VK_SUCCESS)
+			vkFatal("vkCreateBuffer", r);
+
+		vkGetBufferMemoryRequirements(device, spill->buffer, &memoryRequirements);
+		spill->allocation = gpuAllocate(device, GPU_RESOURCE_LINEAR, buffers[BUFFER_FRAME].requiredMemoryPropertyFlagBits, buffers[BUFFER_FRAME].optionalMemoryPropertyFlagBits);
+
+		if ((r = vkBindBufferMemory(device, spill->buffer, spill->allocation.memory, spill->allocation.offset)) != VK_SUCCESS)
+			vkFatal("vkBindBufferMemory", r);
+
+		ring->overflows++;
+	}
+
+	struct RingChunk chunk = {
+		.buffer = spill->buffer,
+		.offset = spill->used,
+		.data = (u8*)spill->allocation.data + spill->used,
+		.size = size
+	};
+
+	spill->used += size;
+
+	return chunk;
+}
+
+// size contiguous bytes good until this frame's fence comes round again; a chunk never wraps, so the end of the ring is
+// skipped when it's too short
+static inline struct RingChunk ringTake(struct Ring* ring, u32 size) {
+	size = ALIGN_FORWARD(__builtin_elementwise_max(size, (u32)RING_CHUNK), (u32)RING_ALIGNMENT);
+	ring->used += size;
+
+	VkDeviceSize position = ring->head % ring->size;
+	VkDeviceSize skip = position + size > ring->size ? ring->size - position : 0;
+
+	if (ring->head + skip + size - ring->tail > ring->size)
+		return ringSpill(ring, size);
+
+	ring->head += skip + size;
+	position = skip ? 0 : position;
+
+	return (struct RingChunk){
+		.buffer = buffers[BUFFER_FRAME].handle,
+		.offset = ring->base + position,
+		.data = (u8*)buffers[BUFFER_FRAME].data + ring->base + position,
+		.size = size
+	};
+}
@@ -0,0 +1,150 @@
+#include "grid.h"
+#include "snapshot.h"
+#include "prediction.h"
+
+#define SERVER_DEFAULT_PORT 9001
+
+static u64 nsElapsed;
+static u32 ticksElapsed;
+
+static inline void welcomeSend(const struct Client* client) {
+	u8* welcome = netSend(&client->address, 3);
+	welcome[0] = 0x01;
+	__builtin_memcpy(&welcome[1], &client->entity, sizeof(u16));
+}
+
+// a client and its player entity, or POOL_NONE and nothing at all when either pool is full
+static inline u16 clientJoin(const struct NetAddress* address) {
+	u16 idx = clientCreate(address);
+	if (idx == POOL_NONE)
+		return POOL_NONE;
+
+	struct Client* client = &clients.data[idx];
+
+	client->entity = entityCreate((struct Entity){
+		.type = ENTITY_TYPE_PLAYER,
+		.speed = 1 << 15,
+		.mass = 1
+	}, (uvec3){ }, 1);
+
+	if (client->entity == POOL_NONE) {
+		clientDestroy(idx);
+		return POOL_NONE;
+	}
+
+	// without a history slot the client still plays, it just gets full snapshots
+	client->snapshotSlot = snapshotHistoryAcquire(idx);
+
+	return idx;
+}
+
+static inline void receivePackets(void) {
+	while (netReceive()) {
+		for (u32 p = 0; p < netInbox.count; p++) {
+			struct NetPacket* packet = &netInbox.packets[p];
+			char* buff = (char*)packet->data;
+
+			if (packet->size < 1)
+				continue;
+
+			u16 idx = clientFind(&packet->address);
+			if (idx == (u16)-1) {
+				// nothing is allocated for an unknown address until it says hello, so stray datagrams cost nothing
+				if (packet->size < CLIENT_HELLO_SIZE || buff[0] != 0x01 || buff[1] != CLIENT_PROTOCOL_VERSION)
+					continue;
+
+				idx = clientJoin(&packet->address);
+				if (idx == POOL_NONE)
+					continue;
+			}
+
+			struct Client* client = &clients.data[idx];
+			client->lastSeen = ticksElapsed;
+
+			// a datagram may carry several messages back to back; stop at the first one we can't size
+			for (u32 j = 0; j < packet->size;) {
+				switch (buff[j]) {
+					case 0x00: { // player input
+						u32 size = playerInputReceive(client, (u8*)&buff[j], packet->size - j);
+						if (!size)
+							goto next;
+
+						j += size;
+						break;
+					}
+					case 0x01: // hello, repeated until our welcome gets through
+						if (packet->size - j < CLIENT_HELLO_SIZE)
+							goto next;
+
+						welcomeSend(client);
+
+						j += CLIENT_HELLO_SIZE;
+						break;
+					case 0x03: // snapshot ack
+						if (packet->size - j < SNAPSHOT_ACK_SIZE)
+							goto next;
+
+						snapshotAcknowledge(client, (u8*)&buff[j]);
+
+						j += SNAPSHOT_ACK_SIZE;
+						break;
+					default:
+						goto next;
+				}
+			}
+
+		next:;
+		}
+	}
+}
+
+static inline void tick(void) {
+	static struct SnapshotFrame frame;
+
+	arenaReset(&tickArena);
+
+	clientsExpire(ticksElapsed);
+
+	for (u16 i = 0; i < clients.index.count; i++)
+		playerInputApply(&clients.data[clients.index.dense[i]]);
+
+	bodiesIntegrate();
+	gridRebuild();
+
+	for (u16 i = 0; i < clients.index.count; i++) {
+		struct Client* client = &clients.data[clients.index.dense[i]];
+
+		snapshotBuild(client, (u16)ticksElapsed, &frame);
+		snapshotSend(client, &frame);
+		playerCorrectionSend(client);
+	}
+}
+
+int main(int argc, char** argv) {
+	u16 port = argc > 1 ? (u16)atoi(argv[1]) : SERVER_DEFAULT_PORT;
+
+	platformSocketOpen(port);
+	arenaInit(&tickArena, 64ull << 20);
+
+	fprintf(stderr, "listening on port %u at %u ticks per second\n", port, TICKS_PER_SECOND);
+
+	u64 start = platformClock();
+
+	while (platformPollEvents()) {
+		receivePackets();
+
+		nsElapsed = platformClock() - start;
+
+		u64 targetTicks = nsElapsed / NANOSECONDS_PER_TICK;
+		while (ticksElapsed < targetTicks) {
+			tick();
+			netFlush();
+			ticksElapsed++;
+		}
+
+		u64 untilNextTick = ((ticksElapsed + 1) * NANOSECONDS_PER_TICK - nsElapsed) / 1000000;
+		platformSocketWait((u32)untilNextTick + 1);
+	}
+
+	return EXIT_SUCCESS;
+}
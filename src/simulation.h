@@ -0,0 +1,362 @@
+#pragma once
+
+#include "platform.h"
+#include "pool.h"
+
+#define TICKS_PER_SECOND 50
+#define NANOSECONDS_PER_TICK (1000000000ull / TICKS_PER_SECOND)
+
+#define CLIENT_TIMEOUT_TICKS (10 * TICKS_PER_SECOND)
+#define CLIENT_LOOKUP_SIZE 131072 // power of two, at least twice the client pool so probes stay short
+
+// 0x01 [protocol version u8], the only message a server answers from an address it doesn't know; the client repeats
+// it every CLIENT_HELLO_INTERVAL_TICKS until the welcome arrives
+#define CLIENT_PROTOCOL_VERSION 1
+#define CLIENT_HELLO_SIZE 2
+#define CLIENT_HELLO_INTERVAL_TICKS TICKS_PER_SECOND
+
+enum EntityType : u8 {
+	ENTITY_TYPE_PLAYER
+};
+
+enum EntityFlags : u16 {
+	ENTITY_IS_PLAYER_CONTROLLED = 1 << 0
+};
+
+#define PLAYER_INPUT_BUFFER 8 // power of two, inputs a server holds per client
+#define PLAYER_INPUT_MAX_BACKLOG 4 // older queued inputs are skipped so the queue can't add latency
+
+// held movement keys for one tick
+enum PlayerButtons : u8 {
+	PLAYER_FORWARD = 1 << 0,
+	PLAYER_LEFT = 1 << 1,
+	PLAYER_BACK = 1 << 2,
+	PLAYER_RIGHT = 1 << 3
+};
+
+// yaw is a binary angle, 65536 per turn, so client and server derive the same acceleration bit for bit
+struct PlayerInput {
+	u16 yaw;
+	u8 buttons;
+};
+
+#define BODY_CAPACITY 65536 // UINT16_MAX rounded up to a whole number of 8-wide lanes
+#define BODY_DRAG_SHIFT 4 // velocity -= velocity >> 4 each tick, 0.9375
+
+struct Entity {
+	float pitch;
+	float yaw;
+
+	u16 speed;
+	u16 mass;
+
+	u16 flags;
+	u16 body;
+
+	enum EntityType type;
+};
+
+// hot per-tick state kept separately from struct Entity, packed so live bodies occupy [0, count)
+static struct {
+	__attribute__((aligned(32))) u32 positionX[BODY_CAPACITY]; // 16.16 fixed point
+	__attribute__((aligned(32))) u32 positionY[BODY_CAPACITY];
+	__attribute__((aligned(32))) u32 positionZ[BODY_CAPACITY];
+	__attribute__((aligned(32))) i32 velocityX[BODY_CAPACITY];
+	__attribute__((aligned(32))) i32 velocityY[BODY_CAPACITY];
+	__attribute__((aligned(32))) i32 velocityZ[BODY_CAPACITY];
+	__attribute__((aligned(32))) u16 radius[BODY_CAPACITY];
+	u16 entity[BODY_CAPACITY];
+	u16 count;
+} bodies;
+
+static POOL(struct Entity) entities = POOL_INIT(struct Entity, UINT16_MAX);
+
+struct Client {
+	struct NetAddress address;
+
+	char name[32];
+
+	u32 lastSeen; // tick of the most recent datagram
+
+	struct PlayerInput inputs[PLAYER_INPUT_BUFFER]; // indexed by sequence
+	u16 inputNewest;
+	u16 inputProcessed; // last input applied to the client's entity
+	bool inputStarted;
+
+	u16 snapshotSlot; // delta history, (u16)-1 when the client only gets full snapshots
+	u16 snapshotAck; // newest snapshot the client has fully received
+	bool snapshotAcked;
+
+	u16 entity;
+};
+
+// open addressing with linear probing; tag is the top of the hash so most probes never touch clients.data
+struct ClientSlot {
+	u16 client; // index + 1, zero when empty
+	u16 tag;
+};
+
+static POOL(struct Client) clients = POOL_INIT(struct Client, UINT16_MAX);
+
+static struct {
+	struct ClientSlot slots[CLIENT_LOOKUP_SIZE];
+} clientLookup;
+
+static inline u16 bodyCreate(u16 entity, uvec3 position, u16 radius) {
+	u16 body = bodies.count++;
+
+	bodies.positionX[body] = position.x;
+	bodies.positionY[body] = position.y;
+	bodies.positionZ[body] = position.z;
+	bodies.velocityX[body] = 0;
+	bodies.velocityY[body] = 0;
+	bodies.velocityZ[body] = 0;
+	bodies.radius[body] = radius;
+	bodies.entity[body] = entity;
+
+	return body;
+}
+
+// swaps the last body into the hole so the live range stays packed
+static inline void bodyDestroy(u16 body) {
+	u16 last = --bodies.count;
+
+	bodies.positionX[body] = bodies.positionX[last];
+	bodies.positionY[body] = bodies.positionY[last];
+	bodies.positionZ[body] = bodies.positionZ[last];
+	bodies.velocityX[body] = bodies.velocityX[last];
+	bodies.velocityY[body] = bodies.velocityY[last];
+	bodies.velocityZ[body] = bodies.velocityZ[last];
+	bodies.radius[body] = bodies.radius[last];
+	bodies.entity[body] = bodies.entity[last];
+
+	entities.data[bodies.entity[body]].body = body;
+}
+
+static inline bool entityHasBody(u16 idx) {
+	u16 body = entities.data[idx].body;
+	return body < bodies.count && bodies.entity[body] == idx;
+}
+
+static inline uvec3 bodyPosition(u16 body) {
+	return (uvec3){ bodies.positionX[body], bodies.positionY[body], bodies.positionZ[body] };
+}
+
+static inline void bodySetPosition(u16 body, uvec3 position) {
+	bodies.positionX[body] = position.x;
+	bodies.positionY[body] = position.y;
+	bodies.positionZ[body] = position.z;
+}
+
+static inline void bodyAccelerate(u16 body, ivec3 acceleration) {
+	bodies.velocityX[body] += acceleration.x;
+	bodies.velocityY[body] += acceleration.y;
+	bodies.velocityZ[body] += acceleration.z;
+}
+
+// quarter wave of sin in Q15, 256 steps per turn
+static const u16 sineTable[65] = {
+	0, 804, 1608, 2411, 3212, 4011, 4808, 5602, 6393, 7180, 7962, 8740, 9512,
+	10279, 11039, 11793, 12540, 13279, 14010, 14733, 15447, 16151, 16846, 17531, 18205, 18868,
+	19520, 20160, 20788, 21403, 22006, 22595, 23170, 23732, 24279, 24812, 25330, 25833, 26320,
+	26791, 27246, 27684, 28106, 28511, 28899, 29269, 29622, 29957, 30274, 30572, 30853, 31114,
+	31357, 31581, 31786, 31972, 32138, 32286, 32413, 32522, 32610, 32679, 32729, 32758, 32767
+};
+
+static inline i32 binarySin(u16 angle) {
+	u8 step = (u8)(angle >> 8);
+	u8 i = step & 63;
+
+	i32 value = sineTable[step & 64 ? 64 - i : i];
+	return step & 128 ? -value : value;
+}
+
+static inline i32 binaryCos(u16 angle) {
+	return binarySin(angle + 16384);
+}
+
+static inline u16 radToBinaryAngle(float rad) {
+	return (u16)(i32)(rad * (32768.f / M_PI));
+}
+
+static inline float binaryAngleToRad(u16 angle) {
+	return (float)(i16)angle * (M_PI / 32768.f);
+}
+
+// same directions the client used to take from its camera, flattened onto the ground
+static inline ivec3 playerInputAcceleration(struct PlayerInput input, u16 speed) {
+	i32 s = binarySin(input.yaw);
+	i32 c = binaryCos(input.yaw);
+	i32 x = 0, z = 0;
+
+	if ((input.buttons & (PLAYER_FORWARD | PLAYER_BACK)) == PLAYER_FORWARD)
+		x -= s, z -= c;
+	else if ((input.buttons & (PLAYER_FORWARD | PLAYER_BACK)) == PLAYER_BACK)
+		x += s, z += c;
+
+	if ((input.buttons & (PLAYER_LEFT | PLAYER_RIGHT)) == PLAYER_LEFT)
+		x -= c, z += s;
+	else if ((input.buttons & (PLAYER_LEFT | PLAYER_RIGHT)) == PLAYER_RIGHT)
+		x += c, z -= s;
+
+	return (ivec3){ (i32)(((i64)x * speed) >> 15), 0, (i32)(((i64)z * speed) >> 15) };
+}
+
+// one axis of 8 bodies: drag, integrate, then clamp to [radius, UINT16_MAX - radius] and stop on contact
+static inline void bodiesIntegrateAxis(u32* positions, i32* velocities, uvec8 min, uvec8 max) {
+	uvec8 position = *(uvec8*)positions;
+	ivec8 velocity = *(ivec8*)velocities;
+
+	velocity -= velocity >> BODY_DRAG_SHIFT;
+
+	uvec8 moved = position + (uvec8)velocity;
+
+	// unsigned wrap around means we went past either end of the world
+	ivec8 underflow = (velocity < 0) & (moved > position);
+	ivec8 overflow = (velocity > 0) & (moved < position);
+
+	ivec8 hitMin = underflow | ((moved < min) & ~overflow);
+	ivec8 hitMax = overflow | ((moved > max) & ~underflow);
+
+	moved = (moved & ~(uvec8)(hitMin | hitMax)) | (min & (uvec8)hitMin) | (max & (uvec8)hitMax);
+	velocity &= ~(hitMin | hitMax);
+
+	*(uvec8*)positions = moved;
+	*(ivec8*)velocities = velocity;
+}
+
+// lanes past count are padding and are integrated along with the rest, which is harmless
+static inline void bodiesIntegrate(void) {
+	for (u32 i = 0; i < bodies.count; i += 8) {
+		uvec8 radius = __builtin_convertvector(*(u16vec8*)&bodies.radius[i], uvec8);
+		uvec8 min = radius << 16;
+		uvec8 max = (UINT16_MAX - radius) << 16;
+
+		bodiesIntegrateAxis(&bodies.positionX[i], &bodies.velocityX[i], min, max);
+		bodiesIntegrateAxis(&bodies.positionY[i], &bodies.velocityY[i], min, max);
+		bodiesIntegrateAxis(&bodies.positionZ[i], &bodies.velocityZ[i], min, max);
+	}
+}
+
+// scalar twin of bodiesIntegrateAxis for stepping one body on its own, e.g. when replaying inputs
+static inline void bodyIntegrateAxis(u32* position, i32* velocity, u32 min, u32 max) {
+	i32 v = *velocity - (*velocity >> BODY_DRAG_SHIFT);
+	u32 moved = *position + (u32)v;
+
+	bool underflow = v < 0 && moved > *position;
+	bool overflow = v > 0 && moved < *position;
+
+	if (underflow || (moved < min && !overflow))
+		moved = min, v = 0;
+	else if (overflow || moved > max)
+		moved = max, v = 0;
+
+	*position = moved;
+	*velocity = v;
+}
+
+static inline void bodyIntegrate(u16 body) {
+	u32 min = (u32)bodies.radius[body] << 16;
+	u32 max = (u32)(UINT16_MAX - bodies.radius[body]) << 16;
+
+	bodyIntegrateAxis(&bodies.positionX[body], &bodies.velocityX[body], min, max);
+	bodyIntegrateAxis(&bodies.positionY[body], &bodies.velocityY[body], min, max);
+	bodyIntegrateAxis(&bodies.positionZ[body], &bodies.velocityZ[body], min, max);
+}
+
+// POOL_NONE when every entity slot is taken
+static inline u16 entityCreate(struct Entity entity, uvec3 position, u16 radius) {
+	u16 idx = poolInsert(&entities.index);
+	if (idx == POOL_NONE)
+		return POOL_NONE;
+
+	entity.body = bodyCreate(idx, position, radius);
+	entities.data[idx] = entity;
+
+	return idx;
+}
+
+static inline void entityDestroy(u16 idx) {
+	bodyDestroy(entities.data[idx].body);
+	poolRemove(&entities.index, idx);
+}
+
+static inline u16 clientFind(const struct NetAddress* address) {
+	u32 hash = netAddressHash(address);
+	u16 tag = (u16)(hash >> 16);
+
+	for (u32 slot = hash & (CLIENT_LOOKUP_SIZE - 1);; slot = (slot + 1) & (CLIENT_LOOKUP_SIZE - 1)) {
+		struct ClientSlot* s = &clientLookup.slots[slot];
+
+		if (!s->client)
+			return (u16)-1;
+
+		if (s->tag == tag && netAddressEqual(&clients.data[s->client - 1].address, address))
+			return s->client - 1;
+	}
+}
+
+// POOL_NONE when the server is full
+static inline u16 clientCreate(const struct NetAddress* address) {
+	u16 idx = poolInsert(&clients.index);
+	if (idx == POOL_NONE)
+		return POOL_NONE;
+
+	clients.data[idx] = (struct Client){
+		.address = *address,
+		.snapshotSlot = (u16)-1,
+		.entity = (u16)-1
+	};
+
+	u32 hash = netAddressHash(address);
+
+	u32 slot = hash & (CLIENT_LOOKUP_SIZE - 1);
+	while (clientLookup.slots[slot].client)
+		slot = (slot + 1) & (CLIENT_LOOKUP_SIZE - 1);
+
+	clientLookup.slots[slot] = (struct ClientSlot){
+		.client = idx + 1,
+		.tag = (u16)(hash >> 16)
+	};
+
+	return idx;
+}
+
+static inline void clientDestroy(u16 idx) {
+	struct Client* client = &clients.data[idx];
+
+	u32 slot = netAddressHash(&client->address) & (CLIENT_LOOKUP_SIZE - 1);
+	while (clientLookup.slots[slot].client != idx + 1)
+		slot = (slot + 1) & (CLIENT_LOOKUP_SIZE - 1);
+
+	// backward shift deletion, so lookups never need tombstones
+	for (u32 next = (slot + 1) & (CLIENT_LOOKUP_SIZE - 1);; next = (next + 1) & (CLIENT_LOOKUP_SIZE - 1)) {
+		struct ClientSlot* s = &clientLookup.slots[next];
+		if (!s->client)
+			break;
+
+		u32 home = netAddressHash(&clients.data[s->client - 1].address) & (CLIENT_LOOKUP_SIZE - 1);
+		if (((next - home) & (CLIENT_LOOKUP_SIZE - 1)) >= ((next - slot) & (CLIENT_LOOKUP_SIZE - 1))) {
+			clientLookup.slots[slot] = *s;
+			slot = next;
+		}
+	}
+	clientLookup.slots[slot].client = 0;
+
+	if (client->entity != (u16)-1)
+		entityDestroy(client->entity);
+
+	client->snapshotSlot = (u16)-1;
+	poolRemove(&clients.index, idx);
+}
+
+// drops every client that has been silent for CLIENT_TIMEOUT_TICKS
+static inline void clientsExpire(u32 tick) {
+	// backwards, so a removal only moves clients that have already been checked
+	for (u16 i = clients.index.count; i-- > 0;) {
+		u16 idx = clients.index.dense[i];
+
+		if (tick - clients.data[idx].lastSeen > CLIENT_TIMEOUT_TICKS)
+			clientDestroy(idx);
+	}
+}
@@ -0,0 +1,573 @@
+#pragma once
+
+#include "simulation.h"
+#include "net.h"
+#include "arena.h"
+
+// 0x02 [version u8][sequence u16][baseline age u8][part u8][part count u8][entry count u16][payload bytes u16][payload]
+// each entry is [id 16][removed 1], then unless removed [field mask 4] and for each set field either
+// [1][delta SNAPSHOT_DELTA_BITS] or [0][absolute value]; entities unchanged since the baseline are left out
+#define SNAPSHOT_VERSION 1
+#define SNAPSHOT_HEADER_SIZE 12
+#define SNAPSHOT_HISTORY 16 // power of two
+#define SNAPSHOT_MAX_ENTITIES 512
+#define SNAPSHOT_MAX_CLIENTS 128
+#define SNAPSHOT_MAX_PARTS 32
+
+#define SNAPSHOT_POSITION_SHIFT 12 // 16.16 fixed point to sixteenths of a world unit
+#define SNAPSHOT_POSITION_BITS 20
+#define SNAPSHOT_DELTA_BITS 8
+#define SNAPSHOT_ENTRY_MAX_BITS (16 + 1 + 4 + 3 * (1 + SNAPSHOT_POSITION_BITS) + 8)
+
+// each client only hears about entities within the interest radius of its own, and only refreshes as many of them
+// per tick as the byte budget allows; the rest are repeated as last sent, which costs nothing once acknowledged
+#define SNAPSHOT_INTEREST_RADIUS 1024 // world units
+#define SNAPSHOT_BUDGET_BYTES 1024 // per client per tick
+#define SNAPSHOT_PRIORITY_NEAR 16 // weight at the client's own position, falling to 1 at the interest radius
+
+// 0x03 [sequence u16]
+#define SNAPSHOT_ACK_SIZE 3
+
+enum SnapshotField : u8 {
+	SNAPSHOT_FIELD_X = 1 << 0,
+	SNAPSHOT_FIELD_Y = 1 << 1,
+	SNAPSHOT_FIELD_Z = 1 << 2,
+	SNAPSHOT_FIELD_YAW = 1 << 3,
+	SNAPSHOT_FIELDS_ALL = 0xF
+};
+
+// quantized, so comparing against a baseline is exact
+struct SnapshotEntity {
+	u32 x, y, z;
+	u16 id;
+	u16 refreshed; // server only: sequence the values were captured at
+	i8 yaw;
+};
+
+// entities sorted by id
+struct SnapshotFrame {
+	struct SnapshotEntity entities[SNAPSHOT_MAX_ENTITIES];
+	u64 receivedAt; // client: local clock when the last part arrived
+	u32 receivedParts;
+	u16 count;
+	u16 sequence;
+	u8 partCount;
+	bool valid;
+	bool complete;
+};
+
+// server: what each delta-capable client was sent, indexed by sequence
+static struct {
+	struct SnapshotFrame frames[SNAPSHOT_HISTORY];
+	PoolHandle owner; // a client slot can be reused before the history is
+} snapshotHistories[SNAPSHOT_MAX_CLIENTS] = {
+	[0 ... SNAPSHOT_MAX_CLIENTS - 1] = { .owner = POOL_HANDLE_NONE }
+};
+
+// client: what has been decoded so far, indexed by sequence
+static struct SnapshotFrame snapshotFrames[SNAPSHOT_HISTORY];
+static u16 snapshotLatest;
+static bool snapshotApplied;
+
+static inline u32 snapshotQuantize(u32 position) {
+	return position >> SNAPSHOT_POSITION_SHIFT;
+}
+
+// lands in the middle of the quantization step
+static inline u32 snapshotDequantize(u32 position) {
+	return position << SNAPSHOT_POSITION_SHIFT | (1u << (SNAPSHOT_POSITION_SHIFT - 1));
+}
+
+static inline i32 snapshotFind(const struct SnapshotFrame* frame, u16 id) {
+	i32 first = 0;
+	i32 last = (i32)frame->count - 1;
+
+	while (first <= last) {
+		i32 middle = (first + last) / 2;
+		u16 middleID = frame->entities[middle].id;
+
+		if (middleID == id)
+			return middle;
+		else if (middleID < id)
+			first = middle + 1;
+		else
+			last = middle - 1;
+	}
+
+	return -(first + 1);
+}
+
+static inline u16 snapshotHistoryAcquire(u16 client) {
+	for (u16 slot = 0; slot < SNAPSHOT_MAX_CLIENTS; slot++) {
+		u16 owner = poolResolve(&clients.index, snapshotHistories[slot].owner);
+
+		if (owner == POOL_NONE || clients.data[owner].snapshotSlot != slot) {
+			snapshotHistories[slot].owner = poolHandle(&clients.index, client);
+			for (u32 i = 0; i < SNAPSHOT_HISTORY; i++)
+				snapshotHistories[slot].frames[i].valid = false;
+
+			return slot;
+		}
+	}
+
+	return (u16)-1;
+}
+
+static inline void snapshotWriteAxis(struct BitWriter* writer, u32 value, u32 baseline) {
+	i32 delta = (i32)value - (i32)baseline;
+
+	if (delta >= -(1 << (SNAPSHOT_DELTA_BITS - 1)) && delta < (1 << (SNAPSHOT_DELTA_BITS - 1))) {
+		bitsWrite(writer, 1, 1);
+		bitsWrite(writer, (u32)delta, SNAPSHOT_DELTA_BITS);
+	} else {
+		bitsWrite(writer, 0, 1);
+		bitsWrite(writer, value, SNAPSHOT_POSITION_BITS);
+	}
+}
+
+static inline u32 snapshotReadAxis(struct BitReader* reader, u32 baseline) {
+	if (bitsRead(reader, 1)) {
+		u32 bits = bitsRead(reader, SNAPSHOT_DELTA_BITS);
+		i32 delta = (i32)(bits << (32 - SNAPSHOT_DELTA_BITS)) >> (32 - SNAPSHOT_DELTA_BITS);
+		return (baseline + (u32)delta) & ((1u << SNAPSHOT_POSITION_BITS) - 1);
+	}
+
+	return bitsRead(reader, SNAPSHOT_POSITION_BITS);
+}
+
+struct SnapshotPart {
+	u8 data[NET_MTU];
+	struct BitWriter writer;
+	u16 entryCount;
+};
+
+static inline struct BitWriter* snapshotEntryBegin(struct SnapshotPart* parts, u8* partCount) {
+	struct SnapshotPart* part = &parts[*partCount - 1];
+
+	if (bitsWritten(&part->writer) + SNAPSHOT_ENTRY_MAX_BITS > (NET_MTU - SNAPSHOT_HEADER_SIZE) * 8) {
+		if (*partCount == SNAPSHOT_MAX_PARTS)
+			return NULL;
+
+		part = &parts[(*partCount)++];
+		*part = (struct SnapshotPart){ };
+		part->writer.data = &part->data[SNAPSHOT_HEADER_SIZE];
+	}
+
+	part->entryCount++;
+	return &part->writer;
+}
+
+static inline u32 snapshotAxisBits(u32 value, u32 baseline) {
+	i32 delta = (i32)value - (i32)baseline;
+
+	return delta >= -(1 << (SNAPSHOT_DELTA_BITS - 1)) && delta < (1 << (SNAPSHOT_DELTA_BITS - 1)) ? 1 + SNAPSHOT_DELTA_BITS : 1 + SNAPSHOT_POSITION_BITS;
+}
+
+// what snapshotSend will spend on an entity, 0 when it can be left out
+static inline u32 snapshotEntryBits(const struct SnapshotEntity* current, const struct SnapshotEntity* previous) {
+	u32 bits = 0;
+
+	if (current->x != previous->x)
+		bits += snapshotAxisBits(current->x, previous->x);
+	if (current->y != previous->y)
+		bits += snapshotAxisBits(current->y, previous->y);
+	if (current->z != previous->z)
+		bits += snapshotAxisBits(current->z, previous->z);
+	if (current->yaw != previous->yaw)
+		bits += 8;
+
+	return bits ? 16 + 1 + 4 + bits : 0;
+}
+
+// the acknowledged frame the client can decode against, or NULL for a full snapshot
+static inline const struct SnapshotFrame* snapshotBaseline(const struct Client* client, u16 sequence, u8* age) {
+	if (client->snapshotSlot == (u16)-1 || !client->snapshotAcked)
+		return NULL;
+
+	u16 baselineAge = sequence - client->snapshotAck;
+	const struct SnapshotFrame* acked = &snapshotHistories[client->snapshotSlot].frames[client->snapshotAck & (SNAPSHOT_HISTORY - 1)];
+
+	if (baselineAge == 0 || baselineAge >= SNAPSHOT_HISTORY || !acked->valid || acked->sequence != client->snapshotAck)
+		return NULL;
+
+	*age = (u8)baselineAge;
+	return acked;
+}
+
+// in-place heapsort, callers pack the sort key into the high bits
+static inline void snapshotSortKeys(u32* keys, u32 count) {
+	for (u32 end = count, start = count / 2; end > 1;) {
+		if (start > 0)
+			start--;
+		else {
+			end--;
+			u32 top = keys[0];
+			keys[0] = keys[end];
+			keys[end] = top;
+		}
+
+		for (u32 root = start, child; (child = root * 2 + 1) < end; root = child) {
+			if (child + 1 < end && keys[child + 1] > keys[child])
+				child++;
+
+			if (keys[root] >= keys[child])
+				break;
+
+			u32 swap = keys[root];
+			keys[root] = keys[child];
+			keys[child] = swap;
+		}
+	}
+}
+
+// server: picks what this client hears about this tick; relevant entities are refreshed in order of accumulated
+// priority (distance weight times ticks since last refresh) until the budget runs out, the rest keep their last sent values;
+// past SNAPSHOT_MAX_ENTITIES the lowest priority ones are left out entirely
+static inline void snapshotBuild(const struct Client* client, u16 sequence, struct SnapshotFrame* frame) {
+	static const struct SnapshotEntity origin;
+
+	// every entity in range is a candidate, capping the query itself would cut off in grid order rather than by priority
+	u64 mark = tickArena.used;
+	u16* candidates = ARENA_ARRAY(&tickArena, u16, grid.elementCount);
+
+	const struct Entity* self = &entities.data[client->entity];
+	uvec3 center = bodyPosition(self->body);
+	u32 count = gridQuery(center, SNAPSHOT_INTEREST_RADIUS, candidates, grid.elementCount);
+
+	struct SnapshotEntity* fresh = ARENA_ARRAY(&tickArena, struct SnapshotEntity, count);
+	u32* keys = ARENA_ARRAY(&tickArena, u32, count);
+
+	u8 baselineAge;
+	const struct SnapshotFrame* baseline = snapshotBaseline(client, sequence, &baselineAge);
+	const struct SnapshotFrame* last = NULL;
+
+	if (client->snapshotSlot != (u16)-1) {
+		last = &snapshotHistories[client->snapshotSlot].frames[(u16)(sequence - 1) & (SNAPSHOT_HISTORY - 1)];
+		if (!last->valid || last->sequence != (u16)(sequence - 1))
+			last = NULL;
+	}
+
+	// a client without history gets no budget; anything left out of a full snapshot would be deleted on its end
+	i32 budget = client->snapshotSlot != (u16)-1 ? SNAPSHOT_BUDGET_BYTES * 8 : INT32_MAX;
+
+	const u64 radiusSquared = (u64)SNAPSHOT_INTEREST_RADIUS * SNAPSHOT_INTEREST_RADIUS;
+
+	for (u32 i = 0; i < count; i++) {
+		u16 id = candidates[i];
+		u16 body = entities.data[id].body;
+
+		fresh[i] = (struct SnapshotEntity){
+			.x = snapshotQuantize(bodies.positionX[body]),
+			.y = snapshotQuantize(bodies.positionY[body]),
+			.z = snapshotQuantize(bodies.positionZ[body]),
+			.id = id,
+			.refreshed = sequence,
+			.yaw = radToI8(entities.data[id].yaw)
+		};
+
+		i64 dx = ((i64)bodies.positionX[body] - (i64)center.x) >> 16;
+		i64 dz = ((i64)bodies.positionZ[body] - (i64)center.z) >> 16;
+		u64 distanceSquared = __builtin_elementwise_min((u64)(dx * dx + dz * dz), radiusSquared);
+		u32 weight = 1 + (u32)((SNAPSHOT_PRIORITY_NEAR - 1) * (radiusSquared - distanceSquared) / radiusSquared);
+
+		// entities the client hasn't been told about yet count as overdue by the whole history
+		u32 age = SNAPSHOT_HISTORY;
+
+		i32 index = last ? snapshotFind(last, id) : -1;
+		if (index >= 0) {
+			const struct SnapshotEntity* stale = &last->entities[index];
+			i32 baseIndex = baseline ? snapshotFind(baseline, id) : -1;
+
+			budget -= (i32)snapshotEntryBits(stale, baseIndex >= 0 ? &baseline->entities[baseIndex] : &origin);
+			age = __builtin_elementwise_min((u32)(u16)(sequence - stale->refreshed), (u32)SNAPSHOT_HISTORY);
+		}
+
+		u32 priority = id == client->entity ? UINT16_MAX : weight * age;
+		keys[i] = priority << 16 | i;
+	}
+
+	snapshotSortKeys(keys, count);
+
+	// keys come out ascending, so the most overdue entities are at the end
+	u16 frameCount = 0;
+	for (u32 k = count; k-- > 0 && frameCount < SNAPSHOT_MAX_ENTITIES;) {
+		u32 i = keys[k] & 0xFFFF;
+		u16 id = fresh[i].id;
+
+		i32 index = last ? snapshotFind(last, id) : -1;
+		const struct SnapshotEntity* stale = index >= 0 ? &last->entities[index] : NULL;
+
+		i32 baseIndex = baseline ? snapshotFind(baseline, id) : -1;
+		const struct SnapshotEntity* previous = baseIndex >= 0 ? &baseline->entities[baseIndex] : &origin;
+
+		i32 cost = (i32)snapshotEntryBits(&fresh[i], previous) - (stale ? (i32)snapshotEntryBits(stale, previous) : 0);
+
+		if (cost <= budget) {
+			budget -= cost;
+			frame->entities[frameCount++] = fresh[i];
+		} else if (stale)
+			frame->entities[frameCount++] = *stale;
+	}
+
+	for (u16 i = 0; i < frameCount; i++)
+		keys[i] = (u32)frame->entities[i].id << 16 | i;
+
+	snapshotSortKeys(keys, frameCount);
+
+	for (u16 i = 0; i < frameCount; i++)
+		fresh[i] = frame->entities[keys[i] & 0xFFFF];
+
+	__builtin_memcpy(frame->entities, fresh, frameCount * sizeof(struct SnapshotEntity));
+	frame->count = frameCount;
+	frame->sequence = sequence;
+	frame->valid = true;
+	frame->complete = true;
+
+	arenaRewind(&tickArena, mark);
+}
+
+// server: sends frame to one client as a delta against the newest snapshot it acknowledged, split to fit the MTU
+static inline void snapshotSend(struct Client* client, const struct SnapshotFrame* frame) {
+	static const struct SnapshotFrame empty;
+	static struct SnapshotPart parts[SNAPSHOT_MAX_PARTS];
+
+	u8 baselineAge = 0;
+	const struct SnapshotFrame* baseline = snapshotBaseline(client, frame->sequence, &baselineAge);
+	if (!baseline)
+		baseline = &empty;
+
+	u8 partCount = 1;
+	parts[0] = (struct SnapshotPart){ };
+	parts[0].writer.data = &parts[0].data[SNAPSHOT_HEADER_SIZE];
+
+	static const struct SnapshotEntity origin;
+	bool truncated = false;
+
+	// removals go first so a receiver holding a full frame has room for the additions that follow
+	for (u16 j = 0; j < baseline->count && !truncated; j++) {
+		if (snapshotFind(frame, baseline->entities[j].id) >= 0)
+			continue;
+
+		struct BitWriter* writer = snapshotEntryBegin(parts, &partCount);
+		if (!(truncated = !writer)) {
+			bitsWrite(writer, baseline->entities[j].id, 16);
+			bitsWrite(writer, 1, 1);
+		}
+	}
+
+	for (u16 i = 0; i < frame->count && !truncated; i++) {
+		const struct SnapshotEntity* current = &frame->entities[i];
+
+		i32 index = snapshotFind(baseline, current->id);
+		const struct SnapshotEntity* previous = index >= 0 ? &baseline->entities[index] : &origin;
+
+		u8 mask = previous == &origin ? SNAPSHOT_FIELDS_ALL :
+			(current->x != previous->x ? SNAPSHOT_FIELD_X : 0) |
+			(current->y != previous->y ? SNAPSHOT_FIELD_Y : 0) |
+			(current->z != previous->z ? SNAPSHOT_FIELD_Z : 0) |
+			(current->yaw != previous->yaw ? SNAPSHOT_FIELD_YAW : 0);
+
+		if (!mask)
+			continue;
+
+		struct BitWriter* writer = snapshotEntryBegin(parts, &partCount);
+		if ((truncated = !writer))
+			break;
+
+		bitsWrite(writer, current->id, 16);
+		bitsWrite(writer, 0, 1);
+		bitsWrite(writer, mask, 4);
+
+		if (mask & SNAPSHOT_FIELD_X)
+			snapshotWriteAxis(writer, current->x, previous->x);
+		if (mask & SNAPSHOT_FIELD_Y)
+			snapshotWriteAxis(writer, current->y, previous->y);
+		if (mask & SNAPSHOT_FIELD_Z)
+			snapshotWriteAxis(writer, current->z, previous->z);
+		if (mask & SNAPSHOT_FIELD_YAW)
+			bitsWrite(writer, (u8)current->yaw, 8);
+	}
+
+	for (u8 p = 0; p < partCount; p++) {
+		struct SnapshotPart* part = &parts[p];
+		u16 payloadBytes = (u16)bitsFinish(&part->writer);
+
+		part->data[0] = 0x02;
+		part->data[1] = SNAPSHOT_VERSION;
+		__builtin_memcpy(&part->data[2], &frame->sequence, sizeof(u16));
+		part->data[4] = baselineAge;
+		part->data[5] = p;
+		part->data[6] = partCount;
+		__builtin_memcpy(&part->data[7], &part->entryCount, sizeof(u16));
+		__builtin_memcpy(&part->data[9], &payloadBytes, sizeof(u16));
+		part->data[11] = 0;
+
+		u32 size = SNAPSHOT_HEADER_SIZE + payloadBytes;
+		__builtin_memcpy(netSend(&client->address, size), part->data, size);
+	}
+
+	if (client->snapshotSlot != (u16)-1) {
+		struct SnapshotFrame* sent = &snapshotHistories[client->snapshotSlot].frames[frame->sequence & (SNAPSHOT_HISTORY - 1)];
+		__builtin_memcpy(sent->entities, frame->entities, frame->count * sizeof(struct SnapshotEntity));
+		sent->count = frame->count;
+		sent->sequence = frame->sequence;
+		// the client only got part of it, so it must not become a baseline
+		sent->valid = !truncated;
+	}
+}
+
+static inline void snapshotAcknowledge(struct Client* client, const u8* buff) {
+	u16 sequence;
+	__builtin_memcpy(&sequence, &buff[1], sizeof(u16));
+
+	if (!client->snapshotAcked || sequenceNewer(sequence, client->snapshotAck)) {
+		client->snapshotAck = sequence;
+		client->snapshotAcked = true;
+	}
+}
+
+// client: makes the world match a complete frame, dropping remote entities it no longer lists
+static inline void snapshotApply(const struct SnapshotFrame* frame) {
+	for (u16 i = 0; i < frame->count; i++) {
+		const struct SnapshotEntity* entity = &frame->entities[i];
+
+		if (!entityHasBody(entity->id)) {
+			if (!poolInsertAt(&entities.index, entity->id))
+				continue;
+
+			entities.data[entity->id].body = bodyCreate(entity->id, (uvec3){ }, 1);
+		}
+
+		if (entities.data[entity->id].flags & ENTITY_IS_PLAYER_CONTROLLED)
+			continue;
+
+		bodySetPosition(entities.data[entity->id].body, (uvec3){ snapshotDequantize(entity->x), snapshotDequantize(entity->y), snapshotDequantize(entity->z) });
+		entities.data[entity->id].yaw = i8ToRad(entity->yaw);
+	}
+
+	for (u16 body = bodies.count; body-- > 0;) {
+		u16 id = bodies.entity[body];
+
+		if (!(entities.data[id].flags & ENTITY_IS_PLAYER_CONTROLLED) && snapshotFind(frame, id) < 0) {
+			bodyDestroy(body);
+			poolRemove(&entities.index, id);
+		}
+	}
+}
+
+// client: decodes one part, returns the bytes it occupied or 0 if the message is malformed
+static inline u32 snapshotReceive(const u8* buff, u32 size, const struct NetAddress* from) {
+	if (size < SNAPSHOT_HEADER_SIZE)
+		return 0;
+
+	u16 sequence, entryCount, payloadBytes;
+	__builtin_memcpy(&sequence, &buff[2], sizeof(u16));
+	u8 baselineAge = buff[4];
+	u8 part = buff[5];
+	u8 partCount = buff[6];
+	__builtin_memcpy(&entryCount, &buff[7], sizeof(u16));
+	__builtin_memcpy(&payloadBytes, &buff[9], sizeof(u16));
+
+	u32 messageSize = SNAPSHOT_HEADER_SIZE + payloadBytes;
+	if (messageSize > size)
+		return 0;
+
+	if (buff[1] != SNAPSHOT_VERSION || part >= partCount || partCount > SNAPSHOT_MAX_PARTS)
+		return messageSize;
+
+	struct SnapshotFrame* frame = &snapshotFrames[sequence & (SNAPSHOT_HISTORY - 1)];
+
+	if (!frame->valid || frame->sequence != sequence) {
+		const struct SnapshotFrame* baseline = NULL;
+
+		if (baselineAge) {
+			u16 baselineSequence = sequence - baselineAge;
+			baseline = &snapshotFrames[baselineSequence & (SNAPSHOT_HISTORY - 1)];
+
+			// the baseline was never completed here, so this snapshot can't be decoded
+			if (baselineAge >= SNAPSHOT_HISTORY || !baseline->valid || !baseline->complete || baseline->sequence != baselineSequence)
+				return messageSize;
+		}
+
+		if (baseline)
+			__builtin_memcpy(frame->entities, baseline->entities, baseline->count * sizeof(struct SnapshotEntity));
+
+		frame->count = baseline ? baseline->count : 0;
+		frame->sequence = sequence;
+		frame->receivedParts = 0;
+		frame->partCount = partCount;
+		frame->valid = true;
+		frame->complete = false;
+	}
+
+	if (frame->complete || frame->receivedParts & (1u << part))
+		return messageSize;
+
+	struct BitReader reader = { .data = &buff[SNAPSHOT_HEADER_SIZE], .size = payloadBytes };
+
+	// each entity appears once per snapshot, so whatever is in the frame when we reach it is still the baseline value
+	for (u16 e = 0; e < entryCount && !reader.overflow; e++) {
+		u16 id = (u16)bitsRead(&reader, 16);
+		bool removed = bitsRead(&reader, 1);
+
+		// not an entity we could hold; this part is garbage and it may already have changed the frame, so drop both
+		if (id >= entities.index.capacity) {
+			frame->valid = false;
+			return messageSize;
+		}
+
+		i32 index = snapshotFind(frame, id);
+
+		if (removed) {
+			if (index >= 0) {
+				__builtin_memmove(&frame->entities[index], &frame->entities[index + 1], (frame->count - index - 1) * sizeof(struct SnapshotEntity));
+				frame->count--;
+			}
+			continue;
+		}
+
+		if (index < 0) {
+			// parts arrived out of order and the removals haven't come yet; the frame is dropped and never acked
+			if (frame->count == SNAPSHOT_MAX_ENTITIES) {
+				frame->valid = false;
+				return messageSize;
+			}
+
+			index = -index - 1;
+			__builtin_memmove(&frame->entities[index + 1], &frame->entities[index], (frame->count - index) * sizeof(struct SnapshotEntity));
+			frame->entities[index] = (struct SnapshotEntity){ .id = id };
+			frame->count++;
+		}
+
+		struct SnapshotEntity* entity = &frame->entities[index];
+		u8 mask = (u8)bitsRead(&reader, 4);
+
+		if (mask & SNAPSHOT_FIELD_X)
+			entity->x = snapshotReadAxis(&reader, entity->x);
+		if (mask & SNAPSHOT_FIELD_Y)
+			entity->y = snapshotReadAxis(&reader, entity->y);
+		if (mask & SNAPSHOT_FIELD_Z)
+			entity->z = snapshotReadAxis(&reader, entity->z);
+		if (mask & SNAPSHOT_FIELD_YAW)
+			entity->yaw = (i8)bitsRead(&reader, 8);
+	}
+
+	frame->receivedParts |= 1u << part;
+
+	if (__builtin_popcount(frame->receivedParts) == frame->partCount) {
+		frame->complete = true;
+		frame->receivedAt = platformClock();
+
+		u8* ack = netSend(from, SNAPSHOT_ACK_SIZE);
+		ack[0] = 0x03;
+		__builtin_memcpy(&ack[1], &sequence, sizeof(u16));
+
+		if (!snapshotApplied || sequenceNewer(sequence, snapshotLatest)) {
+			snapshotApply(frame);
+			snapshotLatest = sequence;
+			snapshotApplied = true;
+		}
+	}
+
+	return messageSize;
+}
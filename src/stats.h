@@ -0,0 +1,99 @@
+#pragma once
+
+#include "font.h"
+#include "draw.h"
+#include "interpolation.h"
+
+// F3 shows what the renderer did per frame in the top left corner, averaged over STATS_INTERVAL so it can be read and
+// so its own text is only laid out again when the numbers change
+#define STATS_INTERVAL 500 // milliseconds
+#define STATS_TEXT_SIZE 1024
+#define STATS_TEXT_HEIGHT 16.f
+
+// running totals since the text was last written
+struct FrameStatsSums {
+	u32 frames;
+	u64 ringUsed;
+	u64 arenaUsed;
+	u64 recorded2D;
+	u64 draws2D;
+	u64 flushTime2D;
+	u64 flattened;
+	u64 flattenTime;
+	u64 draws3D;
+	u64 visible;
+	u64 culled;
+};
+
+static struct {
+	struct FrameStatsSums sums;
+	u32 since; // msElapsed when the sums started
+	u32 textHits, textMisses; // the caches' own totals at that point
+	u32 pathHits, pathMisses;
+	u32 interpolationFrames, underruns, extrapolations; // the simulation thread's
+	char text[STATS_TEXT_SIZE];
+	bool visible;
+} frameStats;
+
+// once everything the frame draws is recorded, after ringEndFrame
+static inline void frameStatsCollect(void) {
+	struct FrameStatsSums* sums = &frameStats.sums;
+
+	sums->frames++;
+	sums->ringUsed += frameRing.used;
+	sums->arenaUsed += frameArena.used;
+	sums->recorded2D += batch2D.recorded;
+	sums->draws2D += batch2D.draws;
+	sums->flushTime2D += batch2D.flushTime;
+	sums->flattened += batch2D.flattened;
+	sums->flattenTime += batch2D.flattenTime;
+	sums->draws3D += drawQueue.draws;
+	sums->visible += drawQueue.visible;
+	sums->culled += drawQueue.culled;
+
+	if (msElapsed - frameStats.since < STATS_INTERVAL)
+		return;
+
+	u32 frames = sums->frames;
+	char* text = frameStats.text;
+
+	text += __builtin_sprintf(text, "frame ring: %llu KB a frame, %llu KB peak of %llu KB, %u overflows",
+		sums->ringUsed / frames / 1024, frameRing.peak / 1024, frameRing.size / 1024, frameRing.overflows);
+	text += __builtin_sprintf(text, "\nframe arena: %llu KB a frame, %llu KB peak, %llu KB committed",
+		sums->arenaUsed / frames / 1024, frameArena.highWater / 1024, frameArena.committed / 1024);
+	text += __builtin_sprintf(text, "\nscene: %llu elements in %llu draws a frame, %llu culled",
+		sums->visible / frames, sums->draws3D / frames, sums->culled / frames);
+	text += __builtin_sprintf(text, "\n2D: %llu commands in %llu draws a frame, %llu us flushing",
+		sums->recorded2D / frames, sums->draws2D / frames, sums->flushTime2D / frames / 1000);
+	text += __builtin_sprintf(text, "\ncurves: %llu points a frame, %llu us flattening",
+		sums->flattened / frames, sums->flattenTime / frames / 1000);
+	text += __builtin_sprintf(text, "\npath cache: %.1f hits, %.1f misses a frame",
+		(double)(pathCache.hits - frameStats.pathHits) / frames, (double)(pathCache.misses - frameStats.pathMisses) / frames);
+	text += __builtin_sprintf(text, "\ntext cache: %.1f hits, %.1f misses a frame",
+		(double)(textCache.hits - frameStats.textHits) / frames, (double)(textCache.misses - frameStats.textMisses) / frames);
+
+	u32 interpolationFrames = __atomic_load_n(&interpolation.frames, __ATOMIC_RELAXED);
+	u32 underruns = __atomic_load_n(&interpolation.underruns, __ATOMIC_RELAXED);
+	u32 extrapolations = __atomic_load_n(&interpolation.extrapolations, __ATOMIC_RELAXED);
+
+	text += __builtin_sprintf(text, "\ninterpolation: %u of %u ticks ran dry, %u entities extrapolated",
+		underruns - frameStats.underruns, interpolationFrames - frameStats.interpolationFrames, extrapolations - frameStats.extrapolations);
+
+	*sums = (struct FrameStatsSums){ };
+	frameStats.since = msElapsed;
+	frameStats.textHits = textCache.hits;
+	frameStats.textMisses = textCache.misses;
+	frameStats.pathHits = pathCache.hits;
+	frameStats.pathMisses = pathCache.misses;
+	frameStats.interpolationFrames = interpolationFrames;
+	frameStats.underruns = underruns;
+	frameStats.extrapolations = extrapolations;
+}
+
+static inline void frameStatsDraw(void) {
+	if (!frameStats.visible || !frameStats.text[0])
+		return;
+
+	setTransform(mat4From2DAffine(1.f, 0.f, 0.f, 1.f, 0.f, 0.f));
+	drawText(frameStats.text, STATS_TEXT_HEIGHT, STATS_TEXT_HEIGHT, STATS_TEXT_HEIGHT, 0.f, colors.white);
+}
@@ -0,0 +1,233 @@
+#pragma once
+
+#include "pool.h"
+
+// two-level segregated fit over address ranges the CPU can't write headers into (device memory), so regions are
+// described in a side table. Free regions are binned by size class, the first level being the power of two and the
+// second splitting that into TLSF_SL_COUNT steps; a bitmap per level finds the smallest class that is certain to fit,
+// which makes allocating and freeing constant time and keeps fragmentation bounded by the class width.
+#define TLSF_SL_BITS 4
+#define TLSF_SL_COUNT (1 << TLSF_SL_BITS)
+#define TLSF_FL_COUNT 40 // sizes below 1 TB
+#define TLSF_GRANULARITY 256 // every offset and size is a multiple of this
+#define TLSF_MAX_REGIONS 4096 // free and allocated, across every heap
+#define TLSF_NONE POOL_NONE
+
+struct TlsfRegion {
+	u64 offset;
+	u64 size;
+	u16 previous; // physical neighbours in the same block
+	u16 next;
+	u16 previousFree; // in the same size class
+	u16 nextFree;
+	u16 block;
+	bool free;
+};
+
+static POOL(struct TlsfRegion) tlsfRegions = POOL_INIT(struct TlsfRegion, TLSF_MAX_REGIONS);
+
+// a heap; heads are only meaningful where the bitmaps have a bit set, so zero is a valid empty heap
+struct Tlsf {
+	u64 firstLevel;
+	u16 secondLevels[TLSF_FL_COUNT];
+	u16 heads[TLSF_FL_COUNT][TLSF_SL_COUNT];
+	u64 size; // of every block added
+	u64 used;
+};
+
+static inline void tlsfMapping(u64 size, u32* fl, u32* sl) {
+	u32 f = 63 - (u32)__builtin_clzll(size);
+
+	*fl = f;
+	*sl = (u32)(size >> (f - TLSF_SL_BITS)) & (TLSF_SL_COUNT - 1);
+}
+
+static inline void tlsfInsert(struct Tlsf* tlsf, u16 idx) {
+	struct TlsfRegion* region = &tlsfRegions.data[idx];
+
+	u32 fl, sl;
+	tlsfMapping(region->size, &fl, &sl);
+
+	region->free = true;
+	region->previousFree = TLSF_NONE;
+	region->nextFree = tlsf->secondLevels[fl] & (1 << sl) ? tlsf->heads[fl][sl] : TLSF_NONE;
+
+	if (region->nextFree != TLSF_NONE)
+		tlsfRegions.data[region->nextFree].previousFree = idx;
+
+	tlsf->heads[fl][sl] = idx;
+	tlsf->secondLevels[fl] |= (u16)(1 << sl);
+	tlsf->firstLevel |= 1ull << fl;
+}
+
+static inline void tlsfUnlink(struct Tlsf* tlsf, u16 idx) {
+	struct TlsfRegion* region = &tlsfRegions.data[idx];
+
+	if (region->nextFree != TLSF_NONE)
+		tlsfRegions.data[region->nextFree].previousFree = region->previousFree;
+
+	if (region->previousFree != TLSF_NONE)
+		tlsfRegions.data[region->previousFree].nextFree = region->nextFree;
+	else {
+		u32 fl, sl;
+		tlsfMapping(region->size, &fl, &sl);
+
+		tlsf->heads[fl][sl] = region->nextFree;
+		if (region->nextFree == TLSF_NONE) {
+			tlsf->secondLevels[fl] &= (u16)~(1 << sl);
+			if (!tlsf->secondLevels[fl])
+				tlsf->firstLevel &= ~(1ull << fl);
+		}
+	}
+
+	region->free = false;
+}
+
+// the start of the first class whose every region holds size bytes
+static inline u64 tlsfRoundUp(u64 size) {
+	u64 step = 1ull << (63 - (u32)__builtin_clzll(size) - TLSF_SL_BITS);
+	return (size + step - 1) & ~(step - 1);
+}
+
+// how big a block has to be for an allocation of size and alignment to be certain to find room in it
+static inline u64 tlsfFitSize(u64 size, u64 alignment) {
+	size = (__builtin_elementwise_max(size, 1ull) + TLSF_GRANULARITY - 1) & ~(u64)(TLSF_GRANULARITY - 1);
+	alignment = __builtin_elementwise_max(alignment, (u64)TLSF_GRANULARITY);
+
+	return tlsfRoundUp(size + alignment - TLSF_GRANULARITY);
+}
+
+// a free region at least size bytes long, from the smallest class where every region is, or TLSF_NONE
+static inline u16 tlsfFind(const struct Tlsf* tlsf, u64 size) {
+	u32 fl, sl;
+	tlsfMapping(tlsfRoundUp(size), &fl, &sl);
+
+	if (fl >= TLSF_FL_COUNT)
+		return TLSF_NONE;
+
+	u32 slMap = tlsf->secondLevels[fl] & (~0u << sl);
+	if (!slMap) {
+		u64 flMap = tlsf->firstLevel & (~0ull << (fl + 1));
+		if (!flMap)
+			return TLSF_NONE;
+
+		fl = (u32)__builtin_ctzll(flMap);
+		slMap = tlsf->secondLevels[fl];
+	}
+
+	return tlsf->heads[fl][__builtin_ctz(slMap)];
+}
+
+// keeps the first size bytes of a region that isn't on a free list and returns the rest as a region of its own, also
+// off the free lists; TLSF_NONE when nothing is left over or the side table is full, the region then stays whole
+static inline u16 tlsfSplit(u16 idx, u64 size) {
+	struct TlsfRegion* region = &tlsfRegions.data[idx];
+	if (region->size == size)
+		return TLSF_NONE;
+
+	u16 rest = poolInsert(&tlsfRegions.index);
+	if (rest == TLSF_NONE)
+		return TLSF_NONE;
+
+	tlsfRegions.data[rest] = (struct TlsfRegion){
+		.offset = region->offset + size,
+		.size = region->size - size,
+		.previous = idx,
+		.next = region->next,
+		.block = region->block
+	};
+
+	if (region->next != TLSF_NONE)
+		tlsfRegions.data[region->next].previous = rest;
+
+	region->next = rest;
+	region->size = size;
+
+	return rest;
+}
+
+// makes a whole block of size bytes available; false when the side table is full
+static inline bool tlsfAddBlock(struct Tlsf* tlsf, u16 block, u64 size) {
+	u16 idx = poolInsert(&tlsfRegions.index);
+	if (idx == TLSF_NONE)
+		return false;
+
+	tlsfRegions.data[idx] = (struct TlsfRegion){
+		.size = size,
+		.previous = TLSF_NONE,
+		.next = TLSF_NONE,
+		.block = block
+	};
+
+	tlsf->size += size;
+	tlsfInsert(tlsf, idx);
+
+	return true;
+}
+
+// alignment is a power of two; returns the region or TLSF_NONE when no block has room
+static inline u16 tlsfAllocate(struct Tlsf* tlsf, u64 size, u64 alignment) {
+	size = (__builtin_elementwise_max(size, 1ull) + TLSF_GRANULARITY - 1) & ~(u64)(TLSF_GRANULARITY - 1);
+	alignment = __builtin_elementwise_max(alignment, (u64)TLSF_GRANULARITY);
+
+	// enough to align the start of any region found
+	u16 idx = tlsfFind(tlsf, size + alignment - TLSF_GRANULARITY);
+	if (idx == TLSF_NONE)
+		return TLSF_NONE;
+
+	tlsfUnlink(tlsf, idx);
+
+	struct TlsfRegion* region = &tlsfRegions.data[idx];
+	u64 padding = ((region->offset + alignment - 1) & ~(alignment - 1)) - region->offset;
+
+	if (padding) {
+		u16 aligned = tlsfSplit(idx, padding);
+		tlsfInsert(tlsf, idx);
+
+		if (aligned == TLSF_NONE)
+			return TLSF_NONE;
+
+		idx = aligned;
+	}
+
+	u16 rest = tlsfSplit(idx, size);
+	if (rest != TLSF_NONE)
+		tlsfInsert(tlsf, rest);
+
+	tlsf->used += tlsfRegions.data[idx].size;
+
+	return idx;
+}
+
+// merges with whichever physical neighbours are free, so free space never stays split into adjacent pieces
+static inline void tlsfFree(struct Tlsf* tlsf, u16 idx) {
+	struct TlsfRegion* region = &tlsfRegions.data[idx];
+	tlsf->used -= region->size;
+
+	u16 next = region->next;
+	if (next != TLSF_NONE && tlsfRegions.data[next].free) {
+		tlsfUnlink(tlsf, next);
+
+		region->size += tlsfRegions.data[next].size;
+		region->next = tlsfRegions.data[next].next;
+		if (region->next != TLSF_NONE)
+			tlsfRegions.data[region->next].previous = idx;
+
+		poolRemove(&tlsfRegions.index, next);
+	}
+
+	u16 previous = region->previous;
+	if (previous != TLSF_NONE && tlsfRegions.data[previous].free) {
+		tlsfUnlink(tlsf, previous);
+
+		tlsfRegions.data[previous].size += region->size;
+		tlsfRegions.data[previous].next = region->next;
+		if (region->next != TLSF_NONE)
+			tlsfRegions.data[region->next].previous = previous;
+
+		poolRemove(&tlsfRegions.index, idx);
+		idx = previous;
+	}
+
+	tlsfInsert(tlsf, idx);
+}
@@ -0,0 +1,840 @@
+#pragma once
+
+#include "platform.h"
+
+// TrueType outlines baked into a signed distance field atlas: contours are flattened to line segments and each texel
+// keeps its distance to the nearest one, so the one atlas rasterized at FONT_PIXELS_PER_EM stays sharp at every size the
+// UI draws text at. Tables are read in place through big-endian loads and never written; hinting is skipped. assets.c
+// bakes offline, the client only loads the result.
+#define TTF_MAX_SEGMENTS 4096 // per glyph, composites included
+#define TTF_MAX_POINTS 1024 // per simple glyph
+#define TTF_MAX_DEPTH 4 // composite glyphs nested in composite glyphs
+#define TTF_MAX_KERN_LOOKUPS 16
+
+#define FONT_FIRST_CHAR 32
+#define FONT_CHAR_COUNT 95 // printable ASCII
+#define FONT_PIXELS_PER_EM 64.f
+#define FONT_SPREAD 6.f // texels
+#define FONT_ATLAS_SIZE 2048
+
+struct FontGlyph {
+	u16 x, y, width, height; // in the atlas, spread included
+	float left, bottom, right, top; // the same rect around the pen in ems, y up
+	float advance; // ems
+};
+
+// the font blob is one of these followed by the first rows of the atlas, width texels each
+struct FontAtlas {
+	float ascender, descender, lineGap; // ems
+	float pixelsPerEm;
+	float spread; // texels from the outline to where the field reaches 0 or 1
+	u16 width, height;
+	u16 rows; // from the top that hold glyphs, the rest stay empty
+	struct FontGlyph glyphs[FONT_CHAR_COUNT];
+	float kerning[FONT_CHAR_COUNT][FONT_CHAR_COUNT]; // ems added to the advance of the first glyph before the second
+};
+
+struct Ttf {
+	const u8* data;
+	u32 size;
+
+	const u8* cmap; // the subtable glyphs are looked up in
+	const u8* hmtx;
+	const u8* loca;
+	const u8* glyf;
+	u32 glyfSize;
+	const u8* gpos;
+	const u8* kern; // only read when GPOS has no kern feature
+
+	u16 kernLookups[TTF_MAX_KERN_LOOKUPS]; // GPOS lookups the kern feature uses
+	u16 kernLookupCount;
+
+	u16 cmapFormat;
+	u16 unitsPerEm;
+	u16 glyphCount;
+	u16 hMetricCount;
+	bool longLoca;
+	i16 ascender, descender, lineGap;
+};
+
+struct TtfSegment {
+	vec2 a, b;
+};
+
+struct TtfOutline {
+	struct TtfSegment segments[TTF_MAX_SEGMENTS];
+	u32 segmentCount;
+	float tolerance; // font units a flattened curve may stray from the real one
+	vec2 min, max;
+};
+
+// p' = xAxis * p.x + yAxis * p.y + offset
+struct TtfTransform {
+	vec2 xAxis, yAxis, offset;
+};
+
+static inline u16 ttfU16(const u8* p) {
+	return (u16)(p[0] << 8 | p[1]);
+}
+
+static inline i16 ttfI16(const u8* p) {
+	return (i16)ttfU16(p);
+}
+
+static inline u32 ttfU32(const u8* p) {
+	return (u32)p[0] << 24 | (u32)p[1] << 16 | (u32)p[2] << 8 | p[3];
+}
+
+static inline float ttfF2Dot14(const u8* p) {
+	return (float)ttfI16(p) / 16384.f;
+}
+
+static inline bool ttfFits(const struct Ttf* ttf, const u8* p, u32 size) {
+	return p >= ttf->data && p <= ttf->data + ttf->size && size <= (u32)(ttf->data + ttf->size - p);
+}
+
+// NULL when the table is missing or shorter than minimumSize; length may be NULL
+static inline const u8* ttfTable(const struct Ttf* ttf, u32 tag, u32 minimumSize, u32* length) {
+	u16 tableCount = ttfU16(ttf->data + 4);
+	if (12 + tableCount * 16u > ttf->size)
+		return NULL;
+
+	for (u16 i = 0; i < tableCount; i++) {
+		const u8* record = ttf->data + 12 + i * 16;
+		if (ttfU32(record) != tag)
+			continue;
+
+		u32 offset = ttfU32(record + 8);
+		u32 size = ttfU32(record + 12);
+		if (size < minimumSize || offset > ttf->size || size > ttf->size - offset)
+			return NULL;
+
+		if (length)
+			*length = size;
+
+		return ttf->data + offset;
+	}
+
+	return NULL;
+}
+
+static inline bool ttfInit(struct Ttf* ttf, const u8* data, u32 size) {
+	*ttf = (struct Ttf){ .data = data, .size = size };
+	if (size < 12)
+		return false;
+
+	const u8* head = ttfTable(ttf, 'head', 54, NULL);
+	const u8* hhea = ttfTable(ttf, 'hhea', 36, NULL);
+	const u8* maxp = ttfTable(ttf, 'maxp', 6, NULL);
+	const u8* cmap = ttfTable(ttf, 'cmap', 4, NULL);
+	if (!head || !hhea || !maxp || !cmap)
+		return false;
+
+	ttf->unitsPerEm = ttfU16(head + 18);
+	ttf->longLoca = ttfI16(head + 50) != 0;
+	ttf->glyphCount = ttfU16(maxp + 4);
+	ttf->ascender = ttfI16(hhea + 4);
+	ttf->descender = ttfI16(hhea + 6);
+	ttf->lineGap = ttfI16(hhea + 8);
+	ttf->hMetricCount = ttfU16(hhea + 34);
+	if (!ttf->unitsPerEm || !ttf->hMetricCount)
+		return false;
+
+	ttf->hmtx = ttfTable(ttf, 'hmtx', 4u * ttf->hMetricCount, NULL);
+	ttf->loca = ttfTable(ttf, 'loca', (ttf->glyphCount + 1u) * (ttf->longLoca ? 4u : 2u), NULL);
+	ttf->glyf = ttfTable(ttf, 'glyf', 0, &ttf->glyfSize);
+	if (!ttf->hmtx || !ttf->loca || !ttf->glyf)
+		return false;
+
+	ttf->kern = ttfTable(ttf, 'kern', 4, NULL);
+
+	// every language system lists its own kern feature, mostly sharing lookups
+	if ((ttf->gpos = ttfTable(ttf, 'GPOS', 10, NULL))) {
+		const u8* features = ttf->gpos + ttfU16(ttf->gpos + 6);
+		u16 featureCount = ttfFits(ttf, features, 2) ? ttfU16(features) : 0;
+
+		for (u16 i = 0; i < featureCount && ttfFits(ttf, features + 2 + i * 6, 6); i++) {
+			const u8* record = features + 2 + i * 6;
+			if (ttfU32(record) != 'kern')
+				continue;
+
+			const u8* feature = features + ttfU16(record + 4);
+			u16 lookupCount = ttfFits(ttf, feature, 4) ? ttfU16(feature + 2) : 0;
+
+			for (u16 j = 0; j < lookupCount && ttfFits(ttf, feature + 4 + j * 2, 2); j++) {
+				u16 lookup = ttfU16(feature + 4 + j * 2);
+
+				u16 k = 0;
+				while (k < ttf->kernLookupCount && ttf->kernLookups[k] != lookup)
+					k++;
+
+				if (k == ttf->kernLookupCount && k < TTF_MAX_KERN_LOOKUPS)
+					ttf->kernLookups[ttf->kernLookupCount++] = lookup;
+			}
+		}
+	}
+
+	// a full Unicode format 12 subtable over a BMP format 4 one
+	u16 subtableCount = ttfU16(cmap + 2);
+	for (u16 i = 0; i < subtableCount; i++) {
+		const u8* record = cmap + 4 + i * 8;
+		if (record + 8 > data + size)
+			break;
+
+		u16 platform = ttfU16(record);
+		u16 encoding = ttfU16(record + 2);
+		const u8* subtable = cmap + ttfU32(record + 4);
+		if (subtable + 16 > data + size)
+			continue;
+
+		u16 format = ttfU16(subtable);
+		bool unicode = platform == 0 || (platform == 3 && (encoding == 1 || encoding == 10));
+
+		if (unicode && (format == 12 || (format == 4 && ttf->cmapFormat != 12))) {
+			ttf->cmap = subtable;
+			ttf->cmapFormat = format;
+		}
+	}
+
+	return ttf->cmap != NULL;
+}
+
+// 0, the missing glyph, when the font doesn't have one
+static inline u16 ttfGlyphIndex(const struct Ttf* ttf, u32 codePoint) {
+	const u8* cmap = ttf->cmap;
+
+	if (ttf->cmapFormat == 4) {
+		if (codePoint > 0xFFFF)
+			return 0;
+
+		u16 segmentCount = ttfU16(cmap + 6) / 2;
+		const u8* endCodes = cmap + 14;
+		const u8* startCodes = endCodes + segmentCount * 2 + 2;
+		const u8* idDeltas = startCodes + segmentCount * 2;
+		const u8* idRangeOffsets = idDeltas + segmentCount * 2;
+		if (idRangeOffsets + segmentCount * 2 > ttf->data + ttf->size)
+			return 0;
+
+		// the first segment ending at or after codePoint
+		u16 low = 0, high = segmentCount;
+		while (low < high) {
+			u16 middle = (low + high) / 2;
+			if (ttfU16(endCodes + middle * 2) < codePoint)
+				low = middle + 1;
+			else
+				high = middle;
+		}
+
+		if (low == segmentCount || ttfU16(startCodes + low * 2) > codePoint)
+			return 0;
+
+		u16 idDelta = ttfU16(idDeltas + low * 2);
+		u16 idRangeOffset = ttfU16(idRangeOffsets + low * 2);
+		if (!idRangeOffset)
+			return (u16)(codePoint + idDelta);
+
+		const u8* glyph = idRangeOffsets + low * 2 + idRangeOffset + (codePoint - ttfU16(startCodes + low * 2)) * 2;
+		if (glyph + 2 > ttf->data + ttf->size)
+			return 0;
+
+		u16 index = ttfU16(glyph);
+		return index ? (u16)(index + idDelta) : 0;
+	}
+
+	u32 groupCount = ttfU32(cmap + 12);
+	if (cmap + 16 + groupCount * 12 > ttf->data + ttf->size)
+		return 0;
+
+	u32 low = 0, high = groupCount;
+	while (low < high) {
+		u32 middle = (low + high) / 2;
+		const u8* group = cmap + 16 + middle * 12;
+
+		if (codePoint < ttfU32(group))
+			high = middle;
+		else if (codePoint > ttfU32(group + 4))
+			low = middle + 1;
+		else
+			return (u16)(ttfU32(group + 8) + codePoint - ttfU32(group));
+	}
+
+	return 0;
+}
+
+static inline u16 ttfAdvance(const struct Ttf* ttf, u16 glyph) {
+	return ttfU16(ttf->hmtx + 4 * (glyph < ttf->hMetricCount ? glyph : ttf->hMetricCount - 1));
+}
+
+// where glyph sits in a coverage table, -1 when it isn't covered
+static inline i32 ttfCoverage(const struct Ttf* ttf, const u8* coverage, u16 glyph) {
+	if (!ttfFits(ttf, coverage, 4))
+		return -1;
+
+	u16 format = ttfU16(coverage);
+	u16 count = ttfU16(coverage + 2);
+	u32 stride = format == 1 ? 2 : 6;
+	if ((format != 1 && format != 2) || !ttfFits(ttf, coverage + 4, count * stride))
+		return -1;
+
+	// glyphs one at a time, or ranges of start, end and the coverage index of start; both sorted
+	u16 low = 0, high = count;
+	while (low < high) {
+		u16 middle = (low + high) / 2;
+		const u8* record = coverage + 4 + middle * stride;
+
+		if (glyph < ttfU16(record))
+			high = middle;
+		else if (glyph > ttfU16(record + (format == 1 ? 0 : 2)))
+			low = middle + 1;
+		else
+			return format == 1 ? middle : ttfU16(record + 4) + glyph - ttfU16(record);
+	}
+
+	return -1;
+}
+
+static inline u16 ttfClass(const struct Ttf* ttf, const u8* classDef, u16 glyph) {
+	if (!ttfFits(ttf, classDef, 6))
+		return 0;
+
+	if (ttfU16(classDef) == 1) {
+		u16 start = ttfU16(classDef + 2);
+		u16 count = ttfU16(classDef + 4);
+
+		if (glyph < start || glyph - start >= count || !ttfFits(ttf, classDef + 6 + (glyph - start) * 2, 2))
+			return 0;
+
+		return ttfU16(classDef + 6 + (glyph - start) * 2);
+	}
+
+	u16 rangeCount = ttfU16(classDef + 2);
+	if (!ttfFits(ttf, classDef + 4, rangeCount * 6u))
+		return 0;
+
+	u16 low = 0, high = rangeCount;
+	while (low < high) {
+		u16 middle = (low + high) / 2;
+		const u8* range = classDef + 4 + middle * 6;
+
+		if (glyph < ttfU16(range))
+			high = middle;
+		else if (glyph > ttfU16(range + 2))
+			low = middle + 1;
+		else
+			return ttfU16(range + 4);
+	}
+
+	return 0;
+}
+
+// value records hold only the fields their format has bits for, in bit order; x advance is bit 2
+static inline i16 ttfXAdvance(const u8* value, u16 valueFormat) {
+	return (valueFormat & 4) ? ttfI16(value + 2 * __builtin_popcount(valueFormat & 3)) : 0;
+}
+
+// false when a PairPos subtable doesn't cover left followed by right, so the next subtable gets a look
+static inline bool ttfPairAdjustment(const struct Ttf* ttf, const u8* subtable, u16 left, u16 right, i16* adjustment) {
+	if (!ttfFits(ttf, subtable, 10))
+		return false;
+
+	u16 format = ttfU16(subtable);
+	i32 index = ttfCoverage(ttf, subtable + ttfU16(subtable + 2), left);
+	if (index < 0)
+		return false;
+
+	u16 valueFormat1 = ttfU16(subtable + 4);
+	u16 valueFormat2 = ttfU16(subtable + 6);
+	u32 valueSize = 2u * (u32)(__builtin_popcount(valueFormat1 & 0xFF) + __builtin_popcount(valueFormat2 & 0xFF));
+
+	if (format == 1) { // the right glyphs each left glyph pairs with
+		u16 pairSetCount = ttfU16(subtable + 8);
+		if (index >= pairSetCount || !ttfFits(ttf, subtable + 10 + index * 2, 2))
+			return false;
+
+		const u8* pairSet = subtable + ttfU16(subtable + 10 + index * 2);
+		u32 stride = 2 + valueSize;
+		u16 pairCount = ttfFits(ttf, pairSet, 2) ? ttfU16(pairSet) : 0;
+		if (!ttfFits(ttf, pairSet + 2, pairCount * stride))
+			return false;
+
+		u16 low = 0, high = pairCount;
+		while (low < high) {
+			u16 middle = (low + high) / 2;
+			const u8* record = pairSet + 2 + middle * stride;
+			u16 second = ttfU16(record);
+
+			if (right < second)
+				high = middle;
+			else if (right > second)
+				low = middle + 1;
+			else {
+				*adjustment = ttfXAdvance(record + 2, valueFormat1);
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	if (format == 2 && ttfFits(ttf, subtable, 16)) { // a matrix of glyph classes
+		u16 class1 = ttfClass(ttf, subtable + ttfU16(subtable + 8), left);
+		u16 class2 = ttfClass(ttf, subtable + ttfU16(subtable + 10), right);
+		u16 class1Count = ttfU16(subtable + 12);
+		u16 class2Count = ttfU16(subtable + 14);
+
+		const u8* record = subtable + 16 + (class1 * class2Count + class2) * valueSize;
+		if (class1 >= class1Count || class2 >= class2Count || !ttfFits(ttf, record, valueSize))
+			return false;
+
+		*adjustment = ttfXAdvance(record, valueFormat1);
+		return true;
+	}
+
+	return false;
+}
+
+// font units to add between left and right: from the GPOS kern feature when the font has one, else the kern table
+static inline i16 ttfKerning(const struct Ttf* ttf, u16 left, u16 right) {
+	i32 total = 0;
+
+	if (ttf->kernLookupCount) {
+		const u8* lookups = ttf->gpos + ttfU16(ttf->gpos + 8);
+
+		for (u16 i = 0; i < ttf->kernLookupCount; i++) {
+			if (!ttfFits(ttf, lookups + 2 + ttf->kernLookups[i] * 2, 2))
+				continue;
+
+			const u8* lookup = lookups + ttfU16(lookups + 2 + ttf->kernLookups[i] * 2);
+			if (!ttfFits(ttf, lookup, 6))
+				continue;
+
+			u16 type = ttfU16(lookup);
+			u16 subtableCount = ttfU16(lookup + 4);
+
+			for (u16 j = 0; j < subtableCount && ttfFits(ttf, lookup + 6 + j * 2, 2); j++) {
+				const u8* subtable = lookup + ttfU16(lookup + 6 + j * 2);
+
+				// an extension subtable only holds the type and a 32-bit offset of the real one
+				u16 subtableType = type;
+				if (type == 9 && ttfFits(ttf, subtable, 8)) {
+					subtableType = ttfU16(subtable + 2);
+					subtable += ttfU32(subtable + 4);
+				}
+
+				i16 adjustment;
+				if (subtableType == 2 && ttfPairAdjustment(ttf, subtable, left, right, &adjustment)) {
+					total += adjustment;
+					break;
+				}
+			}
+		}
+
+		return (i16)total;
+	}
+
+	if (!ttf->kern || ttfU16(ttf->kern) != 0)
+		return 0;
+
+	// horizontal format 0 subtables: pairs sorted on left and right together
+	u16 tableCount = ttfU16(ttf->kern + 2);
+	const u8* subtable = ttf->kern + 4;
+	u32 key = (u32)left << 16 | right;
+
+	for (u16 i = 0; i < tableCount && ttfFits(ttf, subtable, 14); i++, subtable += ttfU16(subtable + 2)) {
+		if ((ttfU16(subtable + 4) & 0xFF07) != 1)
+			continue;
+
+		u16 pairCount = ttfU16(subtable + 6);
+		const u8* pairs = subtable + 14;
+		if (!ttfFits(ttf, pairs, pairCount * 6u))
+			continue;
+
+		u16 low = 0, high = pairCount;
+		while (low < high) {
+			u16 middle = (low + high) / 2;
+			u32 pair = ttfU32(pairs + middle * 6);
+
+			if (key < pair)
+				high = middle;
+			else if (key > pair)
+				low = middle + 1;
+			else {
+				total += ttfI16(pairs + middle * 6 + 4);
+				break;
+			}
+		}
+
+		if (!ttfU16(subtable + 2))
+			break;
+	}
+
+	return (i16)total;
+}
+
+static inline void ttfLine(struct TtfOutline* outline, vec2 a, vec2 b) {
+	if (outline->segmentCount == TTF_MAX_SEGMENTS)
+		return;
+
+	outline->segments[outline->segmentCount++] = (struct TtfSegment){ a, b };
+	outline->min = __builtin_elementwise_min(outline->min, __builtin_elementwise_min(a, b));
+	outline->max = __builtin_elementwise_max(outline->max, __builtin_elementwise_max(a, b));
+}
+
+// a quadratic strays from its chord by at most a quarter of a - 2 * control + b, and n pieces cut that by n squared
+static inline void ttfQuad(struct TtfOutline* outline, vec2 a, vec2 control, vec2 b) {
+	float deviation = vec2Length(a - 2.f * control + b) / 4.f;
+	u32 steps = (u32)__builtin_ceilf(__builtin_sqrtf(deviation / outline->tolerance));
+	steps = clamp(steps, 1, 32);
+
+	vec2 previous = a;
+	for (u32 i = 1; i <= steps; i++) {
+		float t = (float)i / (float)steps;
+		vec2 p = (1.f - t) * (1.f - t) * a + 2.f * (1.f - t) * t * control + t * t * b;
+
+		ttfLine(outline, previous, p);
+		previous = p;
+	}
+}
+
+static inline bool ttfGlyphOutline(const struct Ttf* ttf, u16 glyph, struct TtfTransform transform, struct TtfOutline* outline, u32 depth);
+
+static inline bool ttfSimpleGlyph(const u8* p, const u8* end, i16 contourCount, struct TtfTransform transform, struct TtfOutline* outline) {
+	const u8* endPoints = p + 10;
+	if (endPoints + contourCount * 2 + 2 > end)
+		return false;
+
+	u32 pointCount = ttfU16(endPoints + (contourCount - 1) * 2) + 1u;
+	if (pointCount > TTF_MAX_POINTS)
+		return false;
+
+	const u8* cursor = endPoints + contourCount * 2;
+	cursor += 2 + ttfU16(cursor); // instructions
+
+	// bit 0 on curve, bits 1 and 2 a byte coordinate, bit 3 repeated, bits 4 and 5 the sign of a byte coordinate or
+	// else that the coordinate didn't change
+	u8 flags[TTF_MAX_POINTS];
+	for (u32 i = 0; i < pointCount;) {
+		if (cursor >= end)
+			return false;
+
+		u8 flag = *cursor++;
+		u32 repeat = 1;
+		if (flag & 8) {
+			if (cursor >= end)
+				return false;
+
+			repeat += *cursor++;
+		}
+
+		while (repeat-- && i < pointCount)
+			flags[i++] = flag;
+	}
+
+	vec2 points[TTF_MAX_POINTS];
+	for (u32 axis = 0; axis < 2; axis++) {
+		u8 byteBit = axis ? 4 : 2;
+		u8 sameBit = axis ? 32 : 16;
+		i32 value = 0;
+
+		for (u32 i = 0; i < pointCount; i++) {
+			if (flags[i] & byteBit) {
+				if (cursor + 1 > end)
+					return false;
+
+				value += (flags[i] & sameBit) ? *cursor : -*cursor;
+				cursor += 1;
+			} else if (!(flags[i] & sameBit)) {
+				if (cursor + 2 > end)
+					return false;
+
+				value += ttfI16(cursor);
+				cursor += 2;
+			}
+
+			points[i][axis] = (float)value;
+		}
+	}
+
+	for (u32 i = 0; i < pointCount; i++)
+		points[i] = transform.xAxis * points[i].x + transform.yAxis * points[i].y + transform.offset;
+
+	u32 first = 0;
+	for (i16 c = 0; c < contourCount; first = ttfU16(endPoints + c * 2) + 1u, c++) {
+		u32 last = ttfU16(endPoints + c * 2);
+		if (last < first || last >= pointCount)
+			return false;
+
+		u32 count = last - first + 1;
+
+		// walk from an on-curve point, or from between the first and last when every point is a control point;
+		// consecutive control points have an implied on-curve point halfway between them
+		u32 on = 0;
+		while (on < count && !(flags[first + on] & 1))
+			on++;
+
+		vec2 start = on < count ? points[first + on] : (points[first] + points[last]) * 0.5f;
+		vec2 previous = start;
+		vec2 control;
+		bool pending = false;
+
+		for (u32 k = on < count ? 1 : 0; k < count; k++) {
+			u32 i = first + (on < count ? (on + k) % count : k);
+
+			if (flags[i] & 1) {
+				if (pending)
+					ttfQuad(outline, previous, control, points[i]);
+				else
+					ttfLine(outline, previous, points[i]);
+
+				previous = points[i];
+				pending = false;
+			} else {
+				if (pending) {
+					vec2 middle = (control + points[i]) * 0.5f;
+					ttfQuad(outline, previous, control, middle);
+					previous = middle;
+				}
+
+				control = points[i];
+				pending = true;
+			}
+		}
+
+		if (pending)
+			ttfQuad(outline, previous, control, start);
+		else if (previous.x != start.x || previous.y != start.y)
+			ttfLine(outline, previous, start);
+	}
+
+	return true;
+}
+
+static inline bool ttfCompositeGlyph(const struct Ttf* ttf, const u8* p, const u8* end, struct TtfTransform transform, struct TtfOutline* outline, u32 depth) {
+	const u8* cursor = p + 10;
+	u16 flags;
+
+	do {
+		if (cursor + 4 > end)
+			return false;
+
+		flags = ttfU16(cursor);
+		u16 glyph = ttfU16(cursor + 2);
+		cursor += 4;
+
+		vec2 offset;
+		if (flags & 1) { // word arguments
+			if (cursor + 4 > end)
+				return false;
+
+			offset = (vec2){ ttfI16(cursor), ttfI16(cursor + 2) };
+			cursor += 4;
+		} else {
+			if (cursor + 2 > end)
+				return false;
+
+			offset = (vec2){ (i8)cursor[0], (i8)cursor[1] };
+			cursor += 2;
+		}
+
+		// arguments that name points to line up instead of an offset are rare enough to place at the origin
+		if (!(flags & 2))
+			offset = (vec2){ };
+
+		struct TtfTransform component = { { 1.f, 0.f }, { 0.f, 1.f }, offset };
+		if (flags & 8) { // one scale
+			if (cursor + 2 > end)
+				return false;
+
+			float scale = ttfF2Dot14(cursor);
+			component.xAxis = (vec2){ scale, 0.f };
+			component.yAxis = (vec2){ 0.f, scale };
+			cursor += 2;
+		} else if (flags & 0x40) { // x and y scale
+			if (cursor + 4 > end)
+				return false;
+
+			component.xAxis = (vec2){ ttfF2Dot14(cursor), 0.f };
+			component.yAxis = (vec2){ 0.f, ttfF2Dot14(cursor + 2) };
+			cursor += 4;
+		} else if (flags & 0x80) { // two by two
+			if (cursor + 8 > end)
+				return false;
+
+			component.xAxis = (vec2){ ttfF2Dot14(cursor), ttfF2Dot14(cursor + 2) };
+			component.yAxis = (vec2){ ttfF2Dot14(cursor + 4), ttfF2Dot14(cursor + 6) };
+			cursor += 8;
+		}
+
+		struct TtfTransform combined = {
+			transform.xAxis * component.xAxis.x + transform.yAxis * component.xAxis.y,
+			transform.xAxis * component.yAxis.x + transform.yAxis * component.yAxis.y,
+			transform.xAxis * component.offset.x + transform.yAxis * component.offset.y + transform.offset
+		};
+
+		if (!ttfGlyphOutline(ttf, glyph, combined, outline, depth + 1))
+			return false;
+	} while (flags & 0x20); // more components
+
+	return true;
+}
+
+// appends glyph's contours, in font units through transform, to outline
+static inline bool ttfGlyphOutline(const struct Ttf* ttf, u16 glyph, struct TtfTransform transform, struct TtfOutline* outline, u32 depth) {
+	if (glyph >= ttf->glyphCount || depth > TTF_MAX_DEPTH)
+		return false;
+
+	u32 start, end;
+	if (ttf->longLoca) {
+		start = ttfU32(ttf->loca + glyph * 4);
+		end = ttfU32(ttf->loca + glyph * 4 + 4);
+	} else {
+		start = ttfU16(ttf->loca + glyph * 2) * 2u;
+		end = ttfU16(ttf->loca + glyph * 2 + 2) * 2u;
+	}
+
+	if (start == end)
+		return true; // no outline, like a space
+
+	if (start > end || end > ttf->glyfSize || end - start < 10)
+		return false;
+
+	const u8* p = ttf->glyf + start;
+	i16 contourCount = ttfI16(p);
+
+	if (contourCount > 0)
+		return ttfSimpleGlyph(p, ttf->glyf + end, contourCount, transform, outline);
+
+	if (contourCount < 0)
+		return ttfCompositeGlyph(ttf, p, ttf->glyf + end, transform, outline, depth);
+
+	return true;
+}
+
+// texel (i, j) of the width by height field sits at corner + (i + 0.5, -(j + 0.5)) / scale in font units. 0.5 is on the
+// outline and the field climbs to 1 spread texels inside; inside is wherever the nonzero winding rule says so.
+static inline void ttfDistanceField(const struct TtfOutline* outline, vec2 corner, float scale, float spread, u8* pixels, u32 stride, u32 width, u32 height) {
+	for (u32 j = 0; j < height; j++)
+		for (u32 i = 0; i < width; i++) {
+			vec2 p = corner + (vec2){ (float)i + 0.5f, -((float)j + 0.5f) } / scale;
+
+			float nearest = __builtin_inff();
+			i32 winding = 0;
+
+			for (u32 s = 0; s < outline->segmentCount; s++) {
+				vec2 a = outline->segments[s].a;
+				vec2 b = outline->segments[s].b;
+				vec2 ab = b - a;
+				vec2 ap = p - a;
+
+				float t = fclampf(vec2Dot(ap, ab) / __builtin_fmaxf(vec2Dot(ab, ab), 1e-12f), 0.f, 1.f);
+				vec2 d = ap - ab * t;
+				nearest = __builtin_fminf(nearest, vec2Dot(d, d));
+
+				if ((a.y <= p.y) != (b.y <= p.y) && a.x + (p.y - a.y) * ab.x / ab.y > p.x)
+					winding += b.y > a.y ? 1 : -1;
+			}
+
+			float distance = __builtin_sqrtf(nearest) * scale * (winding ? 1.f : -1.f);
+			pixels[j * stride + i] = (u8)(fclampf(0.5f + distance / (2.f * spread), 0.f, 1.f) * 255.f + 0.5f);
+		}
+}
+
+// rasterizes printable ASCII into the width by height R8 pixels, packed in shelves tallest first
+static inline bool ttfBakeAtlas(const struct Ttf* ttf, float pixelsPerEm, float spread, u8* pixels, u16 width, u16 height, struct FontAtlas* atlas) {
+	static struct TtfOutline outline;
+
+	float scale = pixelsPerEm / (float)ttf->unitsPerEm;
+	float padding = __builtin_ceilf(spread);
+	struct TtfTransform identity = { { 1.f, 0.f }, { 0.f, 1.f }, { } };
+
+	*atlas = (struct FontAtlas){
+		.ascender = (float)ttf->ascender / (float)ttf->unitsPerEm,
+		.descender = (float)ttf->descender / (float)ttf->unitsPerEm,
+		.lineGap = (float)ttf->lineGap / (float)ttf->unitsPerEm,
+		.pixelsPerEm = pixelsPerEm,
+		.spread = spread,
+		.width = width,
+		.height = height
+	};
+
+	__builtin_memset(pixels, 0, (u32)width * height);
+
+	u16 indices[FONT_CHAR_COUNT];
+	for (u8 c = 0; c < FONT_CHAR_COUNT; c++)
+		indices[c] = ttfGlyphIndex(ttf, FONT_FIRST_CHAR + c);
+
+	for (u8 left = 0; left < FONT_CHAR_COUNT; left++)
+		for (u8 right = 0; right < FONT_CHAR_COUNT; right++)
+			atlas->kerning[left][right] = (float)ttfKerning(ttf, indices[left], indices[right]) / (float)ttf->unitsPerEm;
+
+	// measured first so the packer can sort by height, then outlined again to rasterize; a single outline stays in cache
+	vec2 corners[FONT_CHAR_COUNT];
+	u8 order[FONT_CHAR_COUNT];
+
+	for (u8 c = 0; c < FONT_CHAR_COUNT; c++) {
+		struct FontGlyph* glyph = &atlas->glyphs[c];
+		u16 index = indices[c];
+
+		outline = (struct TtfOutline){ .tolerance = 0.2f / scale, .min = { __builtin_inff(), __builtin_inff() }, .max = { -__builtin_inff(), -__builtin_inff() } };
+		if (!ttfGlyphOutline(ttf, index, identity, &outline, 0))
+			return false;
+
+		glyph->advance = (float)ttfAdvance(ttf, index) / (float)ttf->unitsPerEm;
+		order[c] = c;
+
+		if (!outline.segmentCount)
+			continue;
+
+		glyph->width = (u16)(__builtin_ceilf((outline.max.x - outline.min.x) * scale) + 2.f * padding);
+		glyph->height = (u16)(__builtin_ceilf((outline.max.y - outline.min.y) * scale) + 2.f * padding);
+
+		corners[c] = (vec2){ outline.min.x - padding / scale, outline.max.y + padding / scale };
+		glyph->left = corners[c].x / (float)ttf->unitsPerEm;
+		glyph->top = corners[c].y / (float)ttf->unitsPerEm;
+		glyph->right = glyph->left + (float)glyph->width / pixelsPerEm;
+		glyph->bottom = glyph->top - (float)glyph->height / pixelsPerEm;
+	}
+
+	for (u8 i = 1; i < FONT_CHAR_COUNT; i++)
+		for (u8 j = i; j > 0 && atlas->glyphs[order[j - 1]].height < atlas->glyphs[order[j]].height; j--) {
+			u8 swap = order[j];
+			order[j] = order[j - 1];
+			order[j - 1] = swap;
+		}
+
+	// a texel between cells keeps bilinear filtering from reaching into a neighbour
+	u16 x = 0, y = 0, shelfHeight = 0;
+	for (u8 i = 0; i < FONT_CHAR_COUNT; i++) {
+		struct FontGlyph* glyph = &atlas->glyphs[order[i]];
+		if (!glyph->width)
+			continue;
+
+		if (x + glyph->width > width) {
+			x = 0;
+			y += shelfHeight + 1;
+			shelfHeight = 0;
+		}
+
+		if (glyph->width > width || y + glyph->height > height)
+			return false;
+
+		glyph->x = x;
+		glyph->y = y;
+		x += glyph->width + 1;
+		shelfHeight = __builtin_elementwise_max(shelfHeight, glyph->height);
+	}
+
+	atlas->rows = __builtin_elementwise_min((u16)(y + shelfHeight + 1), height);
+
+	for (u8 c = 0; c < FONT_CHAR_COUNT; c++) {
+		struct FontGlyph* glyph = &atlas->glyphs[c];
+		if (!glyph->width)
+			continue;
+
+		outline = (struct TtfOutline){ .tolerance = 0.2f / scale, .min = { __builtin_inff(), __builtin_inff() }, .max = { -__builtin_inff(), -__builtin_inff() } };
+		ttfGlyphOutline(ttf, indices[c], identity, &outline, 0);
+		ttfDistanceField(&outline, corners[c], scale, spread, pixels + glyph->y * width + glyph->x, width, glyph->width, glyph->height);
+	}
+
+	return true;
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "interpolation.h"
+
+// the simulation thread publishes what every body looks like after each tick, together with where it was the tick
+// before, and the render thread draws between the two. Three states rotate so neither side ever waits: the writer fills
+// one, the reader holds one and the third is swapped between them through a single atomic index.
+#define WORLD_STATES 3
+#define WORLD_STATE_FRESH 4 // set on the shared index until the reader takes it
+
+struct WorldBody {
+	vec3 from;
+	vec3 to;
+	float yawFrom;
+	float yawTo;
+	float pitch;
+	float radius;
+};
+
+struct WorldState {
+	u64 time; // nanoseconds after start that the tick completed
+	u16 count;
+	struct WorldBody bodies[BODY_CAPACITY];
+};
+
+static struct {
+	struct WorldState states[WORLD_STATES];
+
+	// simulation thread: where each entity was drawn at the last published tick
+	vec3 positions[UINT16_MAX];
+	float yaws[UINT16_MAX];
+	u64 times[UINT16_MAX];
+
+	u32 published;
+	u32 taken; // by the reader; the difference is ticks it never saw
+} world;
+
+// kept apart from the states so they stay zero-initialized
+static struct {
+	u32 shared;
+	u32 writing; // simulation thread only
+	u32 reading; // render thread only
+} worldSlots = {
+	.shared = 1,
+	.reading = 2
+};
+
+// simulation thread, once a tick has run: remote entities are placed by the snapshot interpolation at that moment
+static inline void worldPublish(u64 time) {
+	struct WorldState* state = &world.states[worldSlots.writing];
+	state->time = time;
+	state->count = bodies.count;
+
+	for (u16 body = 0; body < bodies.count; body++) {
+		u16 id = bodies.entity[body];
+
+		float yaw;
+		vec3 position = interpolationPosition(body, &yaw);
+
+		// anything that wasn't there last tick appears in place rather than sliding in from a stale spot
+		bool continuous = world.times[id] && world.times[id] == time - NANOSECONDS_PER_TICK;
+
+		state->bodies[body] = (struct WorldBody){
+			.from = continuous ? world.positions[id] : position,
+			.to = position,
+			.yawFrom = continuous ? world.yaws[id] : yaw,
+			.yawTo = yaw,
+			.pitch = entities.data[id].pitch,
+			.radius = bodies.radius[body]
+		};
+
+		world.positions[id] = position;
+		world.yaws[id] = yaw;
+		world.times[id] = time;
+	}
+
+	worldSlots.writing = __atomic_exchange_n(&worldSlots.shared, worldSlots.writing | WORLD_STATE_FRESH, __ATOMIC_ACQ_REL) & ~WORLD_STATE_FRESH;
+	world.published++;
+}
+
+// render thread: the newest published state, held until the next call, and how far into the following tick now is
+static inline const struct WorldState* worldAcquire(u64 now, float* alpha) {
+	if (__atomic_load_n(&worldSlots.shared, __ATOMIC_RELAXED) & WORLD_STATE_FRESH) {
+		worldSlots.reading = __atomic_exchange_n(&worldSlots.shared, worldSlots.reading, __ATOMIC_ACQ_REL) & ~WORLD_STATE_FRESH;
+		world.taken++;
+	}
+
+	const struct WorldState* state = &world.states[worldSlots.reading];
+	*alpha = now > state->time ? __builtin_fminf((float)(now - state->time) / (float)NANOSECONDS_PER_TICK, 1.f) : 0.f;
+
+	return state;
+}
+
+static inline vec3 worldBodyPosition(const struct WorldBody* body, float alpha, float* yaw) {
+	*yaw = body->yawFrom + normalizeAngle(body->yawTo - body->yawFrom) * alpha;
+	return vec3Lerp(body->from, body->to, alpha);
+}
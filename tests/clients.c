@@ -0,0 +1,127 @@
+#include "simulation.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define CLIENTS_BENCH_PEERS 10000
+#define CLIENTS_BENCH_LOOKUPS 1000000
+#define CLIENTS_BENCH_SCANS 10000 // the linear walk is slow enough that fewer lookups give the same average
+
+static struct NetAddress peers[CLIENTS_BENCH_PEERS];
+static u16 peerClients[CLIENTS_BENCH_PEERS];
+
+static u32 failures;
+static u32 seed = 0x9E3779B9;
+
+#define CHECK(condition) do { \
+	if (!(condition)) { \
+		fprintf(stderr, "%s:%d: %s\n", __FILE__, __LINE__, #condition); \
+		failures++; \
+	} \
+} while (0)
+
+static u32 random32(void) {
+	seed ^= seed << 13;
+	seed ^= seed >> 17;
+	seed ^= seed << 5;
+	return seed;
+}
+
+// a quarter share an IPv4 address behind NAT and differ only by port, a quarter are distinct IPv4 hosts, half are IPv6
+static struct NetAddress peerAddress(u32 i) {
+	switch (i & 3) {
+		case 0:
+			return netAddressV4(192, 168, 1, 1, (u16)(1024 + i));
+		case 1:
+			return netAddressV4(10, (u8)(i >> 16), (u8)(i >> 8), (u8)i, 9001);
+		default: {
+			struct NetAddress address = { .family = NET_FAMILY_V6, .port = __builtin_bswap16(9001) };
+			address.ip.v6[0] = 0x20;
+			address.ip.v6[1] = 0x01;
+			__builtin_memcpy(&address.ip.v6[12], &i, sizeof(i));
+			return address;
+		}
+	}
+}
+
+// what the receive loop did before the lookup table: compare against every client
+static u16 clientScan(const struct NetAddress* address) {
+	for (u16 i = 0; i < clients.index.count; i++) {
+		u16 idx = clients.index.dense[i];
+		if (netAddressEqual(&clients.data[idx].address, address))
+			return idx;
+	}
+
+	return (u16)-1;
+}
+
+int main(void) {
+	for (u32 i = 0; i < CLIENTS_BENCH_PEERS; i++) {
+		peers[i] = peerAddress(i);
+		peerClients[i] = clientCreate(&peers[i]);
+		CHECK(peerClients[i] != POOL_NONE);
+	}
+
+	for (u32 i = 0; i < CLIENTS_BENCH_PEERS; i++)
+		CHECK(clientFind(&peers[i]) == peerClients[i]);
+
+	struct NetAddress stranger = netAddressV4(192, 168, 1, 1, 80);
+	CHECK(clientFind(&stranger) == (u16)-1);
+
+	u64 checksum = 0;
+
+	u64 start = platformClock();
+	for (u32 i = 0; i < CLIENTS_BENCH_LOOKUPS; i++)
+		checksum += clientFind(&peers[random32() % CLIENTS_BENCH_PEERS]);
+	u64 hitTime = platformClock() - start;
+
+	// misses walk a probe run to its end, so they are the slow case
+	start = platformClock();
+	for (u32 i = 0; i < CLIENTS_BENCH_LOOKUPS; i++) {
+		struct NetAddress address = peerAddress(CLIENTS_BENCH_PEERS + random32() % CLIENTS_BENCH_PEERS);
+		checksum += clientFind(&address);
+	}
+	u64 missTime = platformClock() - start;
+
+	start = platformClock();
+	for (u32 i = 0; i < CLIENTS_BENCH_SCANS; i++)
+		checksum += clientScan(&peers[random32() % CLIENTS_BENCH_PEERS]);
+	u64 scanTime = platformClock() - start;
+
+	printf("%u peers: %.1f ns a hit, %.1f ns a miss, %.1f ns a linear scan (checksum %llu)\n",
+		CLIENTS_BENCH_PEERS,
+		(double)hitTime / CLIENTS_BENCH_LOOKUPS,
+		(double)missTime / CLIENTS_BENCH_LOOKUPS,
+		(double)scanTime / CLIENTS_BENCH_SCANS,
+		(unsigned long long)checksum);
+
+	// half go quiet and expire; backward shift deletion must leave every survivor reachable
+	for (u32 i = 0; i < CLIENTS_BENCH_PEERS; i++)
+		clients.data[peerClients[i]].lastSeen = i & 1 ? 0 : CLIENT_TIMEOUT_TICKS;
+
+	clientsExpire(CLIENT_TIMEOUT_TICKS + 1);
+	CHECK(clients.index.count == CLIENTS_BENCH_PEERS / 2);
+
+	for (u32 i = 0; i < CLIENTS_BENCH_PEERS; i++)
+		CHECK(clientFind(&peers[i]) == (i & 1 ? (u16)-1 : peerClients[i]));
+
+	// and they can come back, into whatever slots are free now
+	for (u32 i = 1; i < CLIENTS_BENCH_PEERS; i += 2)
+		peerClients[i] = clientCreate(&peers[i]);
+
+	for (u32 i = 0; i < CLIENTS_BENCH_PEERS; i++)
+		CHECK(clientFind(&peers[i]) == peerClients[i]);
+
+	u32 used = 0;
+	for (u32 slot = 0; slot < CLIENT_LOOKUP_SIZE; slot++)
+		used += clientLookup.slots[slot].client != 0;
+
+	CHECK(used == CLIENTS_BENCH_PEERS);
+
+	if (failures) {
+		fprintf(stderr, "%u checks failed\n", failures);
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
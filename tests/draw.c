@@ -0,0 +1,349 @@
+#include "draw.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define DRAW_BENCH_ENTITIES 10000
+#define DRAW_BENCH_FRAMES 100
+#define DRAW_BENCH_WORKERS 4 // whatever the core count, so the parallel paths always run
+#define DRAW_BENCH_FIELD 256.f // world units either side of the camera the bodies are scattered over
+
+// what the device functions were asked to record, instead of recording it
+struct RecordedDraw {
+	VkBuffer buffer;
+	VkDeviceSize offset;
+	u32 drawCount;
+	u32 stride;
+	bool indexed;
+};
+
+static struct RecordedDraw recorded[64];
+static u32 recordedCount;
+static u32 directDraws;
+static u32 pushes;
+
+static vec3 bodyPositions[DRAW_BENCH_ENTITIES];
+static float bodyRadii[DRAW_BENCH_ENTITIES];
+
+static u32 failures;
+static u32 seed = 0x9E3779B9;
+
+#define CHECK(condition) do { \
+	if (!(condition)) { \
+		fprintf(stderr, "%s:%d: %s\n", __FILE__, __LINE__, #condition); \
+		failures++; \
+	} \
+} while (0)
+
+static u32 random32(void) {
+	seed ^= seed << 13;
+	seed ^= seed >> 17;
+	seed ^= seed << 5;
+	return seed;
+}
+
+static float randomFloat(float min, float max) {
+	return min + (max - min) * (float)(random32() >> 8) / (float)(1 << 24);
+}
+
+static void record(VkBuffer buffer, VkDeviceSize offset, u32 drawCount, u32 stride, bool indexed) {
+	if (recordedCount < _countof(recorded))
+		recorded[recordedCount] = (struct RecordedDraw){ buffer, offset, drawCount, stride, indexed };
+
+	recordedCount++;
+}
+
+static VKAPI_ATTR void VKAPI_CALL stubDrawIndexedIndirect(VkCommandBuffer, VkBuffer buffer, VkDeviceSize offset, u32 drawCount, u32 stride) {
+	record(buffer, offset, drawCount, stride, true);
+}
+
+static VKAPI_ATTR void VKAPI_CALL stubDrawIndirect(VkCommandBuffer, VkBuffer buffer, VkDeviceSize offset, u32 drawCount, u32 stride) {
+	record(buffer, offset, drawCount, stride, false);
+}
+
+static VKAPI_ATTR void VKAPI_CALL stubDrawIndexed(VkCommandBuffer, u32, u32, u32, i32, u32) {
+	directDraws++;
+}
+
+static VKAPI_ATTR void VKAPI_CALL stubDraw(VkCommandBuffer, u32, u32, u32, u32) {
+	directDraws++;
+}
+
+static VKAPI_ATTR void VKAPI_CALL stubPushConstants(VkCommandBuffer, VkPipelineLayout, VkShaderStageFlags, u32, u32, const void*) {
+	pushes++;
+}
+
+static bool sameMatrix(mat4 a, mat4 b) {
+	for (u8 r = 0; r < 4; r++)
+		for (u8 c = 0; c < 4; c++)
+			if (a[r][c] != b[r][c])
+				return false;
+
+	return true;
+}
+
+// a distinct normal matrix per element, so each instance can be traced back to what was queued
+static mat3 tagMatrix(float tag) {
+	mat3 m = mat3FromMat4(mat4FromTranslation((vec3){ }));
+	m[1][1] = tag;
+
+	return m;
+}
+
+struct Queued {
+	u32 worker;
+	enum Primitives primitive;
+	enum Materials material;
+	vec3 position;
+};
+
+// identity clip space keeps what's visible easy to say: -1 to 1 in x and y, 0 to 1 in z
+static const struct Queued queued[] = {
+	{ 0, PRIMITIVE_CUBE, MATERIAL_PURPLE, { 0.f, 0.f, 0.5f } },
+	{ 0, PRIMITIVE_ICOSAHEDRON, MATERIAL_ROCK, { 0.5f, 0.5f, 0.5f } },
+	{ 1, PRIMITIVE_CUBE, MATERIAL_PURPLE, { -0.5f, 0.f, 0.5f } },
+	{ 1, PRIMITIVE_TORUS, MATERIAL_METAL, { 10.f, 0.f, 0.5f } }, // right of the frustum
+	{ 1, PRIMITIVE_ICOSAHEDRON, MATERIAL_ROCK, { 0.f, -0.5f, 0.5f } },
+	{ 3, PRIMITIVE_CUBE, MATERIAL_PURPLE, { 0.5f, -0.5f, 0.25f } },
+	{ 3, PRIMITIVE_TORUS, MATERIAL_METAL, { 0.f, 0.f, -5.f } }, // past the far plane
+};
+
+static mat4 queuedTransform(const struct Queued* element) {
+	return mat4FromRotationTranslationScale((quat){ 0.f, 0.f, 0.f, 1.f }, element->position, (vec3){ 0.1f, 0.1f, 0.1f });
+}
+
+static void testRecording(void) {
+	mat4 identity = mat4FromTranslation((vec3){ });
+	VkDeviceSize commandsOffset = BUFFER_OFFSET_DRAW_COMMANDS + frame * BUFFER_RANGE_DRAW_COMMANDS;
+
+	recordedCount = 0;
+	drawBeginFrame();
+
+	for (u32 i = 0; i < _countof(queued); i++)
+		drawPrimitive(queued[i].worker, queued[i].primitive, queued[i].material, queuedTransform(&queued[i]), tagMatrix((float)(i + 1)));
+
+	drawFlush(identity);
+
+	CHECK(drawQueue.visible == 5);
+	CHECK(drawQueue.culled == 2);
+	CHECK(drawQueue.draws == 2);
+	CHECK(modelMatricesCount == 5);
+	CHECK(recordedCount == 2);
+
+	// buckets go in key order, primitive first, so the cubes come before the icosahedra
+	CHECK(recorded[0].indexed);
+	CHECK(recorded[0].buffer == buffers[BUFFER_FRAME].handle);
+	CHECK(recorded[0].offset == commandsOffset);
+	CHECK(recorded[0].drawCount == 1);
+	CHECK(recorded[0].stride == sizeof(VkDrawIndexedIndirectCommand));
+
+	VkDrawIndexedIndirectCommand* cubes = (VkDrawIndexedIndirectCommand*)((u8*)buffers[BUFFER_FRAME].data + recorded[0].offset);
+	CHECK(cubes->indexCount == primitives[PRIMITIVE_CUBE].indexCount);
+	CHECK(cubes->firstIndex == primitives[PRIMITIVE_CUBE].firstIndex);
+	CHECK(cubes->vertexOffset == primitives[PRIMITIVE_CUBE].vertexOffset);
+	CHECK(cubes->instanceCount == 3);
+	CHECK(cubes->firstInstance == 0);
+
+	CHECK(!recorded[1].indexed);
+	CHECK(recorded[1].offset == commandsOffset + sizeof(VkDrawIndexedIndirectCommand));
+	CHECK(recorded[1].stride == sizeof(VkDrawIndirectCommand));
+
+	VkDrawIndirectCommand* icosahedra = (VkDrawIndirectCommand*)((u8*)buffers[BUFFER_FRAME].data + recorded[1].offset);
+	CHECK(icosahedra->vertexCount == primitives[PRIMITIVE_ICOSAHEDRON].vertexCount);
+	CHECK(icosahedra->firstVertex == primitives[PRIMITIVE_ICOSAHEDRON].firstVertex);
+	CHECK(icosahedra->instanceCount == 2);
+	CHECK(icosahedra->firstInstance == 3);
+
+	// every visible element landed once, in its bucket's range, with its own normal matrix and its material's data
+	u32 seen = 0;
+	for (u32 i = 0; i < _countof(queued); i++) {
+		const struct Primitive* primitive = &primitives[queued[i].primitive];
+		mat4 model = mat4TranslateScale(queuedTransform(&queued[i]), primitive->min, primitive->max - primitive->min);
+
+		for (u32 instance = 0; instance < modelMatricesCount; instance++) {
+			if (!sameMatrix(modelMatrices[instance], model))
+				continue;
+
+			seen++;
+
+			const struct Material* material = &materials[queued[i].material];
+			CHECK(queued[i].primitive == PRIMITIVE_CUBE ? instance < 3 : instance >= 3);
+			CHECK(shaderInstances[instance].normalMatrix[1][1] == (float)(i + 1));
+			CHECK(shaderInstances[instance].color.r == material->rgba.r / 255.f);
+			CHECK(shaderInstances[instance].colorIndex == material->color);
+			CHECK(shaderInstances[instance].normalIndex == material->normal);
+		}
+	}
+
+	CHECK(seen == 5);
+
+	// a second pass in the same frame carries on after the first, in both the instances and the commands
+	drawPrimitive(2, PRIMITIVE_QUAD, MATERIAL_WOOD_DARK, queuedTransform(&queued[0]), tagMatrix(8.f));
+	drawFlush(identity);
+
+	CHECK(recordedCount == 3);
+	CHECK(recorded[2].offset == commandsOffset + 2 * sizeof(VkDrawIndexedIndirectCommand));
+	CHECK(((VkDrawIndexedIndirectCommand*)((u8*)buffers[BUFFER_FRAME].data + recorded[2].offset))->firstInstance == 5);
+	CHECK(modelMatricesCount == 6);
+	CHECK(drawQueue.draws == 3);
+	CHECK(drawQueue.visible == 6);
+
+	// nothing left queued for the next flush
+	drawFlush(identity);
+	CHECK(recordedCount == 3);
+	CHECK(modelMatricesCount == 6);
+}
+
+// the same walk as drawBodies over one node per body, queued for the indirect draws
+static void queueBodies(void*, u32 first, u32 count, u32 worker) {
+	for (u32 i = first; i < first + count; i++) {
+		struct Node* node = &nodes[NODE_PURPLE_CUBE];
+		struct Mesh* mesh = &meshes[node->mesh];
+
+		mat4 body = mat4FromRotationTranslationScale(quatFromAxisAngle((vec3){ 0.f, 1.f, 0.f }, (float)i), bodyPositions[i], (vec3){ bodyRadii[i], bodyRadii[i], bodyRadii[i] });
+		mat4 transform = body * mat4FromRotationTranslationScale(node->rotation, node->translation, node->scale);
+		mat3 normalMatrix = mat3Adjoint(mat3FromMat4(body));
+
+		for (u16 e = 0; e < mesh->count; e++)
+			drawPrimitive(worker, mesh->elements[e].primitive, mesh->elements[e].material, transform, normalMatrix);
+	}
+}
+
+// what drawScene did before the queue: a model matrix, a push of the material and normal matrix and a draw per element
+static void recordBodiesDirect(void) {
+	for (u32 i = 0; i < DRAW_BENCH_ENTITIES; i++) {
+		struct Node* node = &nodes[NODE_PURPLE_CUBE];
+		struct Mesh* mesh = &meshes[node->mesh];
+
+		mat4 body = mat4FromRotationTranslationScale(quatFromAxisAngle((vec3){ 0.f, 1.f, 0.f }, (float)i), bodyPositions[i], (vec3){ bodyRadii[i], bodyRadii[i], bodyRadii[i] });
+		mat4 transform = body * mat4FromRotationTranslationScale(node->rotation, node->translation, node->scale);
+
+		for (u16 e = 0; e < mesh->count; e++) {
+			struct Primitive* primitive = &primitives[mesh->elements[e].primitive];
+			struct Material* material = &materials[mesh->elements[e].material];
+
+			modelMatrices[modelMatricesCount] = mat4TranslateScale(transform, primitive->min, primitive->max - primitive->min);
+
+			vkCmdPushConstants(commandBuffer, pipelineLayout, VK_SHADER_STAGE_FRAGMENT_BIT, 96, sizeof(struct ShaderInstance), &(struct ShaderInstance){
+				.normalMatrix = mat3Adjoint(mat3FromMat4(body)),
+				.color = { material->rgba.r / 255.f, material->rgba.g / 255.f, material->rgba.b / 255.f, material->rgba.a / 255.f },
+				.colorIndex = material->color,
+				.normalIndex = material->normal
+			});
+
+			if (primitive->indexed)
+				vkCmdDrawIndexed(commandBuffer, primitive->indexCount, 1, primitive->firstIndex, primitive->vertexOffset, modelMatricesCount);
+			else
+				vkCmdDraw(commandBuffer, primitive->vertexCount, 1, primitive->firstVertex, modelMatricesCount);
+
+			modelMatricesCount++;
+		}
+	}
+}
+
+// the client's projection and a camera at the origin, so some of the field is behind or beside it and gets culled
+static mat4 benchViewProjection(void) {
+	float f = 1.f / __builtin_tanf(0.78f / 2);
+
+	mat4 projection = mat4FromTranslation((vec3){ });
+	projection[0][0] = f / (16.f / 9.f);
+	projection[1][1] = -f;
+	projection[2][2] = 0.f;
+	projection[2][3] = 0.1f;
+	projection[3][2] = -1.f;
+	projection[3][3] = 0.f;
+
+	return projection * mat4FromTranslation((vec3){ });
+}
+
+// milliseconds a frame
+static double benchQueued(mat4 viewProjection, bool parallel, double* flushTime) {
+	u64 queueTotal = 0, flushTotal = 0;
+
+	for (u32 i = 0; i < DRAW_BENCH_FRAMES; i++) {
+		frame = i % FRAMES_IN_FLIGHT;
+		recordedCount = 0;
+		drawBeginFrame();
+
+		u64 start = platformClock();
+
+		if (parallel)
+			jobsParallelFor(0, queueBodies, NULL, DRAW_BENCH_ENTITIES, DRAW_BODY_BATCH);
+		else
+			queueBodies(NULL, 0, DRAW_BENCH_ENTITIES, 0);
+
+		u64 queuedAt = platformClock();
+		drawFlush(viewProjection);
+
+		queueTotal += queuedAt - start;
+		flushTotal += platformClock() - queuedAt;
+
+		CHECK(drawQueue.visible + drawQueue.culled == DRAW_BENCH_ENTITIES);
+		CHECK(drawQueue.draws == recordedCount);
+	}
+
+	*flushTime = flushTotal / 1e6 / DRAW_BENCH_FRAMES;
+	return queueTotal / 1e6 / DRAW_BENCH_FRAMES;
+}
+
+static void benchRecording(void) {
+	// jobsInit, with a fixed worker count
+	platformSemaphoreInit(&jobs.wake);
+	jobs.workerCount = DRAW_BENCH_WORKERS;
+
+	for (u32 i = 1; i < jobs.workerCount; i++)
+		platformThreadStart(jobsWorker, (void*)(uintptr_t)i);
+
+	for (u32 i = 0; i < DRAW_BENCH_ENTITIES; i++) {
+		bodyPositions[i] = (vec3){ randomFloat(-DRAW_BENCH_FIELD, DRAW_BENCH_FIELD), randomFloat(-4.f, 4.f), randomFloat(-DRAW_BENCH_FIELD, DRAW_BENCH_FIELD) };
+		bodyRadii[i] = randomFloat(0.5f, 2.f);
+	}
+
+	mat4 viewProjection = benchViewProjection();
+
+	double inlineFlush, parallelFlush;
+	double inlineQueue = benchQueued(viewProjection, false, &inlineFlush);
+	double parallelQueue = benchQueued(viewProjection, true, &parallelFlush);
+	u32 draws = drawQueue.draws, visible = drawQueue.visible, culled = drawQueue.culled;
+
+	u64 start = platformClock();
+	for (u32 i = 0; i < DRAW_BENCH_FRAMES; i++) {
+		frame = i % FRAMES_IN_FLIGHT;
+		directDraws = 0;
+		drawBeginFrame();
+		recordBodiesDirect();
+	}
+	double directTime = (platformClock() - start) / 1e6 / DRAW_BENCH_FRAMES;
+
+	CHECK(directDraws == DRAW_BENCH_ENTITIES);
+	CHECK(pushes == DRAW_BENCH_ENTITIES * DRAW_BENCH_FRAMES);
+
+	printf("%u entities: %.3f ms to queue and %.3f ms to flush on one thread, %.3f ms and %.3f ms on %u workers, into %u draws (%u visible, %u culled); %.3f ms for %u draws recorded one by one\n",
+		DRAW_BENCH_ENTITIES, inlineQueue, inlineFlush, parallelQueue, parallelFlush, jobs.workerCount,
+		draws, visible, culled, directTime, directDraws);
+}
+
+int main(void) {
+	vkCmdDrawIndexedIndirect = stubDrawIndexedIndirect;
+	vkCmdDrawIndirect = stubDrawIndirect;
+	vkCmdDrawIndexed = stubDrawIndexed;
+	vkCmdDraw = stubDraw;
+	vkCmdPushConstants = stubPushConstants;
+
+	// the frame buffer is plain memory, what the commands point into is only ever read back by the checks
+	buffers[BUFFER_FRAME].handle = (VkBuffer)(uintptr_t)0x1000;
+	buffers[BUFFER_FRAME].data = platformMemoryReserve(buffers[BUFFER_FRAME].size);
+	platformMemoryCommit(buffers[BUFFER_FRAME].data, buffers[BUFFER_FRAME].size);
+
+	frame = 1;
+	testRecording();
+
+	benchRecording();
+
+	if (failures) {
+		fprintf(stderr, "%u checks failed\n", failures);
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
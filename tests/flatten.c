@@ -0,0 +1,197 @@
+#include "2d.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define FLATTEN_BENCH_SHAPES 10000
+#define FLATTEN_BENCH_DENSE 4096 // samples a curve is checked against
+#define FLATTEN_KAPPA 0.5523f // control point distance for a quarter circle of radius 1
+
+static u32 failures;
+
+#define CHECK(condition) do { \
+	if (!(condition)) { \
+		fprintf(stderr, "%s:%d: %s\n", __FILE__, __LINE__, #condition); \
+		failures++; \
+	} \
+} while (0)
+
+// arc and bezierCurveTo before flattening went by tolerance: a circle got two steps per unit of radius up to 256 and
+// a cubic 32 even steps, each point evaluated from scratch
+static void fixedArc(float x, float y, float radius, float start, float end) {
+	struct SubPath2D* p = pathSubPath();
+	p->closed = true;
+
+	u32 steps = (u32)__builtin_fminf(256.f, ((end - start) * radius / M_PI));
+	float stepAngle = (end - start) / (float)steps;
+
+	for (u32 i = 0; i < steps; i++) {
+		float angle = normalizeAngle(start + (float)i * stepAngle);
+		pathPoint((vec2){ x + radius * __builtin_cosf(angle), y + radius * __builtin_sinf(angle) });
+	}
+}
+
+static void fixedBezierCurveTo(float c1x, float c1y, float c2x, float c2y, float x, float y) {
+	vec2 start = path.points[path.pointCount - 1];
+	u32 steps = 32;
+
+	for (u32 i = 1; i <= steps; i++) {
+		float t = (float)i / (float)steps;
+		float u = 1.0f - t;
+		pathPoint((vec2){
+			u * u * u * start.x + 3 * u * u * t * c1x + 3 * u * t * t * c2x + t * t * t * x,
+			u * u * u * start.y + 3 * u * u * t * c1y + 3 * u * t * t * c2y + t * t * t * y
+		});
+	}
+}
+
+static vec2 cubicPoint(vec2 p0, vec2 p1, vec2 p2, vec2 p3, float t) {
+	float u = 1.f - t;
+	return u * u * u * p0 + 3.f * u * u * t * p1 + 3.f * u * t * t * p2 + t * t * t * p3;
+}
+
+// a button with quarter circle corners, clockwise from the end of the top left corner
+static void roundedRect(float width, float height, float radius, bool fixed) {
+	void (*curve)(float, float, float, float, float, float) = fixed ? fixedBezierCurveTo : bezierCurveTo;
+	float k = radius * (1.f - FLATTEN_KAPPA);
+
+	moveTo(radius, 0.f);
+	lineTo(width - radius, 0.f);
+	curve(width - k, 0.f, width, k, width, radius);
+	lineTo(width, height - radius);
+	curve(width, height - k, width - k, height, width - radius, height);
+	lineTo(radius, height);
+	curve(k, height, 0.f, height - k, 0.f, height - radius);
+	lineTo(0.f, radius);
+	curve(0.f, k, k, 0.f, radius, 0.f);
+	closePath();
+}
+
+struct Shape {
+	const char* name;
+	float radius; // of the circle or the corners
+	float width, height; // zero for a circle
+};
+
+// every chord of a flattened circle keeps its middle within tolerance of the circle, and every point is on it
+static void checkCircle(float radius) {
+	float tolerance = pathTolerance();
+	vec2* points = path.points;
+	u32 count = path.pointCount;
+
+	CHECK(count >= 3);
+
+	for (u32 i = 0; i < count; i++) {
+		vec2 a = points[i];
+		vec2 b = points[i + 1 < count ? i + 1 : 0];
+
+		CHECK(__builtin_fabsf(vec2Length(a) - radius) <= tolerance * 0.01f + radius * 1e-5f);
+		CHECK(radius - vec2Length(0.5f * (a + b)) <= tolerance * 1.01f);
+	}
+}
+
+// each corner's chords against the curve sampled densely, the nearest sample to a chord's middle must be within
+// tolerance; the points are found by walking the path from the corner's start
+static void checkCorners(const struct Shape* shape) {
+	float tolerance = pathTolerance();
+	float r = shape->radius;
+	float k = r * (1.f - FLATTEN_KAPPA);
+	float w = shape->width;
+	float h = shape->height;
+
+	vec2 corners[4][4] = {
+		{ { w - r, 0.f }, { w - k, 0.f }, { w, k }, { w, r } },
+		{ { w, h - r }, { w, h - k }, { w - k, h }, { w - r, h } },
+		{ { r, h }, { k, h }, { 0.f, h - k }, { 0.f, h - r } },
+		{ { 0.f, r }, { 0.f, k }, { k, 0.f }, { r, 0.f } }
+	};
+
+	u32 point = 1; // the start of the first corner
+	for (u32 c = 0; c < 4; c++) {
+		vec2* curve = corners[c];
+		CHECK(vec2Length(path.points[point] - curve[0]) < 1e-4f);
+
+		for (; point + 1 < path.pointCount; point++) {
+			vec2 middle = 0.5f * (path.points[point] + path.points[point + 1]);
+
+			float nearest = __builtin_inff();
+			for (u32 s = 0; s <= FLATTEN_BENCH_DENSE; s++)
+				nearest = __builtin_fminf(nearest, vec2Length(cubicPoint(curve[0], curve[1], curve[2], curve[3], (float)s / FLATTEN_BENCH_DENSE) - middle));
+
+			CHECK(nearest <= tolerance * 1.01f);
+
+			if (vec2Length(path.points[point + 1] - curve[3]) < 1e-4f)
+				break;
+		}
+
+		// past the corner's end and the straight edge after it
+		point += 2;
+	}
+}
+
+static void drawShape(const struct Shape* shape, bool fixed) {
+	beginPath();
+
+	if (!shape->width) {
+		if (fixed)
+			fixedArc(0.f, 0.f, shape->radius, 0.f, M_PI * 2.f);
+		else
+			arc(0.f, 0.f, shape->radius, 0.f, M_PI * 2.f);
+	} else
+		roundedRect(shape->width, shape->height, shape->radius, fixed);
+}
+
+// nanoseconds a shape, from the start of the path to its last point
+static double timeShape(const struct Shape* shape, bool fixed) {
+	u64 start = platformClock();
+
+	for (u32 i = 0; i < FLATTEN_BENCH_SHAPES; i++) {
+		arenaReset(&frameArena);
+		path = (struct Path2D){ };
+		drawShape(shape, fixed);
+	}
+
+	return (double)(platformClock() - start) / FLATTEN_BENCH_SHAPES;
+}
+
+static void bench(const struct Shape* shape, float scale) {
+	setTransform(mat4From2DAffine(scale, 0.f, 0.f, scale, 0.f, 0.f));
+
+	double fixedTime = timeShape(shape, true);
+	u32 fixedPoints = path.pointCount;
+
+	double time = timeShape(shape, false);
+	u32 points = path.pointCount;
+
+	if (!shape->width)
+		checkCircle(shape->radius);
+	else
+		checkCorners(shape);
+
+	printf("%-24s at %.0fx: %4u points in %6.0f ns, fixed steps gave %4u points in %6.0f ns\n",
+		shape->name, scale, points, time, fixedPoints, fixedTime);
+}
+
+int main(void) {
+	arenaInit(&frameArena, 64ull << 20);
+	viewport = mat4FromTranslation((vec3){ });
+
+	const struct Shape shapes[] = {
+		{ .name = "settings button", .radius = 32.f },
+		{ .name = "transition circle", .radius = 1101.f }, // half the diagonal at 1080p
+		{ .name = "button, 8 px corners", .radius = 8.f, .width = 256.f, .height = 64.f },
+		{ .name = "dialog, 16 px corners", .radius = 16.f, .width = 1024.f, .height = 512.f }
+	};
+
+	for (u32 i = 0; i < _countof(shapes); i++) {
+		bench(&shapes[i], 1.f);
+		bench(&shapes[i], 2.f);
+	}
+
+	if (failures) {
+		fprintf(stderr, "%u checks failed\n", failures);
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
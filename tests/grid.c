@@ -0,0 +1,147 @@
+#include "grid.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define GRID_BENCH_TICKS 100
+#define GRID_BENCH_CHECKS 256 // queries compared with a brute force scan at each size
+#define GRID_BENCH_INTEREST 4096 // world units, about what a snapshot asks for
+
+static u16 results[UINT16_MAX];
+static u16 expected[UINT16_MAX];
+
+static u32 failures;
+static u32 seed = 0x9E3779B9;
+
+#define CHECK(condition) do { \
+	if (!(condition)) { \
+		fprintf(stderr, "%s:%d: %s\n", __FILE__, __LINE__, #condition); \
+		failures++; \
+	} \
+} while (0)
+
+static u32 random32(void) {
+	seed ^= seed << 13;
+	seed ^= seed >> 17;
+	seed ^= seed << 5;
+	return seed;
+}
+
+static int compareU16(const void* a, const void* b) {
+	return (int)*(const u16*)a - (int)*(const u16*)b;
+}
+
+// the same overlap test as gridQuery, over every body
+static u32 bruteQuery(uvec3 position, u16 radius, u16* out) {
+	u32 count = 0;
+
+	for (u16 i = 0; i < bodies.count; i++) {
+		i64 dx = ((i64)bodies.positionX[i] - (i64)position.x) >> 8;
+		i64 dz = ((i64)bodies.positionZ[i] - (i64)position.z) >> 8;
+		i64 r = ((i64)radius + (i64)bodies.radius[i]) << 8;
+
+		if (dx * dx + dz * dz <= r * r)
+			out[count++] = bodies.entity[i];
+	}
+
+	return count;
+}
+
+static void populate(u32 count) {
+	while (entities.index.count)
+		entityDestroy(entities.index.dense[entities.index.count - 1]);
+
+	for (u32 i = 0; i < count; i++) {
+		u16 radius = 1 + random32() % 8;
+		uvec3 position = { random32(), (u32)radius << 16, random32() };
+
+		u16 idx = entityCreate((struct Entity){ .mass = 1 }, position, radius);
+		CHECK(idx != POOL_NONE);
+		if (idx == POOL_NONE)
+			return;
+
+		u16 body = entities.data[idx].body;
+		bodies.velocityX[body] = (i32)(random32() % (1 << 18)) - (1 << 17);
+		bodies.velocityZ[body] = (i32)(random32() % (1 << 18)) - (1 << 17);
+	}
+}
+
+static void bench(u32 count) {
+	populate(count);
+
+	u64 integrateTime = 0, rebuildTime = 0, broadphaseTime = 0, interestTime = 0;
+	u64 pairs = 0;
+
+	for (u32 tick = 0; tick < GRID_BENCH_TICKS; tick++) {
+		u64 start = platformClock();
+		bodiesIntegrate();
+		u64 integrated = platformClock();
+		gridRebuild();
+		u64 rebuilt = platformClock();
+
+		// every body against its neighbours, the way collision would use it
+		for (u16 i = 0; i < bodies.count; i++)
+			pairs += gridQuery(bodyPosition(i), bodies.radius[i], results, UINT16_MAX);
+
+		u64 collided = platformClock();
+
+		uvec3 center = bodyPosition((u16)(random32() % bodies.count));
+		gridQuery(center, GRID_BENCH_INTEREST, results, UINT16_MAX);
+
+		integrateTime += integrated - start;
+		rebuildTime += rebuilt - integrated;
+		broadphaseTime += collided - rebuilt;
+		interestTime += platformClock() - collided;
+	}
+
+	printf("%5u entities: %7.3f ms integrate, %7.3f ms rebuild, %7.3f ms a query per body (%.2f hits each), %6.2f us an interest query\n",
+		count,
+		integrateTime / 1e6 / GRID_BENCH_TICKS,
+		rebuildTime / 1e6 / GRID_BENCH_TICKS,
+		broadphaseTime / 1e6 / GRID_BENCH_TICKS,
+		(double)pairs / GRID_BENCH_TICKS / count,
+		interestTime / 1e3 / GRID_BENCH_TICKS);
+
+	CHECK(grid.elementCount == count);
+	CHECK(grid.cellStart[GRID_CELLS] == count);
+
+	// every body sits in the cell of its centre, exactly once
+	u32 seen = 0;
+	for (u32 cell = 0; cell < GRID_CELLS; cell++)
+		for (u32 i = grid.cellStart[cell]; i < grid.cellStart[cell + 1]; i++, seen++)
+			CHECK(gridCell(grid.elements[i].x, grid.elements[i].z) == cell);
+
+	CHECK(seen == count);
+
+	for (u32 c = 0; c < GRID_BENCH_CHECKS; c++) {
+		uvec3 position = { random32(), 0, random32() };
+		u16 radius = (u16)(random32() % GRID_BENCH_INTEREST);
+
+		u32 found = gridQuery(position, radius, results, UINT16_MAX);
+		u32 wanted = bruteQuery(position, radius, expected);
+
+		CHECK(found == wanted);
+		if (found != wanted)
+			continue;
+
+		qsort(results, found, sizeof(u16), compareU16);
+		qsort(expected, wanted, sizeof(u16), compareU16);
+		CHECK(!__builtin_memcmp(results, expected, found * sizeof(u16)));
+	}
+}
+
+int main(void) {
+	bench(1000);
+	bench(10000);
+	bench(UINT16_MAX);
+
+	// entity ids are u16 and POOL_NONE is taken, so UINT16_MAX entities is everything there is room for
+	CHECK(entityCreate((struct Entity){ }, (uvec3){ }, 1) == POOL_NONE);
+
+	if (failures) {
+		fprintf(stderr, "%u checks failed\n", failures);
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
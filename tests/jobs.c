@@ -0,0 +1,125 @@
+#include "jobs.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define JOBS_BENCH_ROUNDS 10000
+#define JOBS_BENCH_VALUES (1 << 20)
+#define JOBS_BENCH_OUTER 64 // nested case: this many jobs, each a parallel-for of its own
+#define JOBS_BENCH_WORKERS 4 // whatever the core count, so stealing and sleeping are always exercised
+
+static u32 values[JOBS_BENCH_VALUES];
+static u64 partials[JOBS_BENCH_VALUES / 64];
+static u64 nested[JOBS_BENCH_OUTER];
+
+static u32 failures;
+
+#define CHECK(condition) do { \
+	if (!(condition)) { \
+		fprintf(stderr, "%s:%d: %s\n", __FILE__, __LINE__, #condition); \
+		failures++; \
+	} \
+} while (0)
+
+static void nothing(void*, u32, u32, u32) {
+}
+
+// partial sums of 64 values each, starting base groups in, so batches never write the same slot
+struct SumRange {
+	u64* out;
+	u32 base;
+};
+
+static void sum(void* data, u32 first, u32 count, u32) {
+	const struct SumRange* range = data;
+
+	for (u32 i = first; i < first + count; i++) {
+		u64 total = 0;
+		for (u32 j = 0; j < 64; j++)
+			total += values[(range->base + i) * 64 + j];
+
+		range->out[i] = total;
+	}
+}
+
+static void sumNested(void*, u32 first, u32 count, u32 worker) {
+	for (u32 i = first; i < first + count; i++) {
+		u64 inner[16];
+		jobsParallelFor(worker, sum, &(struct SumRange){ inner, i * 16 }, 16, 1);
+
+		nested[i] = 0;
+		for (u32 j = 0; j < 16; j++)
+			nested[i] += inner[j];
+	}
+}
+
+// spawns jobCount empty jobs on worker 0 and waits for them, which is the whole cost of a fork/join
+static double forkJoin(u32 jobCount) {
+	u64 start = platformClock();
+
+	for (u32 round = 0; round < JOBS_BENCH_ROUNDS; round++) {
+		struct JobCounter counter = { };
+
+		for (u32 i = 0; i < jobCount; i++)
+			jobsSpawn(0, &counter, nothing, NULL, i, 1);
+
+		jobsWait(0, &counter);
+	}
+
+	return (double)(platformClock() - start) / JOBS_BENCH_ROUNDS;
+}
+
+int main(void) {
+	// jobsInit, with a fixed worker count
+	platformSemaphoreInit(&jobs.wake);
+	jobs.workerCount = JOBS_BENCH_WORKERS;
+
+	for (u32 i = 1; i < jobs.workerCount; i++)
+		platformThreadStart(jobsWorker, (void*)(uintptr_t)i);
+
+	u64 expected = 0;
+	for (u32 i = 0; i < JOBS_BENCH_VALUES; i++) {
+		values[i] = i * 2654435761u >> 8;
+		expected += values[i];
+	}
+
+	// a call that fits in one batch never touches the deques, which is the floor the others are measured against
+	u64 start = platformClock();
+	for (u32 round = 0; round < JOBS_BENCH_ROUNDS; round++)
+		jobsParallelFor(0, nothing, NULL, 1, 1);
+	double inlineTime = (double)(platformClock() - start) / JOBS_BENCH_ROUNDS;
+
+	printf("%u workers: %.0f ns inline, %.0f ns to fork/join 1 job, %.0f ns 8 jobs, %.0f ns 64 jobs\n",
+		jobs.workerCount, inlineTime, forkJoin(1), forkJoin(8), forkJoin(64));
+
+	for (u32 round = 0; round < 100; round++) {
+		__builtin_memset(partials, 0, sizeof(partials));
+		jobsParallelFor(0, sum, &(struct SumRange){ partials, 0 }, JOBS_BENCH_VALUES / 64, 16);
+
+		u64 total = 0;
+		for (u32 i = 0; i < JOBS_BENCH_VALUES / 64; i++)
+			total += partials[i];
+
+		CHECK(total == expected);
+	}
+
+	// every outer job waits on its own inner jobs, which other workers may be running or stealing
+	for (u32 round = 0; round < 100; round++) {
+		jobsParallelFor(0, sumNested, NULL, JOBS_BENCH_OUTER, 1);
+
+		for (u32 i = 0; i < JOBS_BENCH_OUTER; i++) {
+			u64 want = 0;
+			for (u32 j = i * 16 * 64; j < (i + 1) * 16 * 64; j++)
+				want += values[j];
+
+			CHECK(nested[i] == want);
+		}
+	}
+
+	if (failures) {
+		fprintf(stderr, "%u checks failed\n", failures);
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
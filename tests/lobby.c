@@ -0,0 +1,360 @@
+#include "gui.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define LOBBY_BENCH_FRAMES 1000
+#define LOBBY_BENCH_WIDTH 1920
+#define LOBBY_BENCH_HEIGHT 1080
+
+// children live as long as their parents do, which in the client is the whole run
+static struct UINode settingsChildren[2];
+static struct UINode settingsTooltipText;
+static struct UINode discordIcon;
+
+static char descriptions[UINT8_MAX][64];
+static struct UINode joinButtons[UINT8_MAX];
+static struct UINode roomItems[UINT8_MAX + 1];
+
+// what the stubs saw this frame
+static u32 drawCalls;
+static u32 pipelineBinds;
+static u32 indicesDrawn;
+
+static u32 failures;
+
+#define CHECK(condition) do { \
+	if (!(condition)) { \
+		fprintf(stderr, "%s:%d: %s\n", __FILE__, __LINE__, #condition); \
+		failures++; \
+	} \
+} while (0)
+
+static VKAPI_ATTR void VKAPI_CALL stubBindIndexBuffer(VkCommandBuffer, VkBuffer, VkDeviceSize, VkIndexType) {
+}
+
+static VKAPI_ATTR void VKAPI_CALL stubBindVertexBuffers(VkCommandBuffer, u32, u32, const VkBuffer*, const VkDeviceSize*) {
+}
+
+static VKAPI_ATTR void VKAPI_CALL stubBindPipeline(VkCommandBuffer, VkPipelineBindPoint, VkPipeline) {
+	pipelineBinds++;
+}
+
+static VKAPI_ATTR void VKAPI_CALL stubDrawIndexed(VkCommandBuffer, u32 indexCount, u32, u32, i32, u32) {
+	drawCalls++;
+	indicesDrawn += indexCount;
+}
+
+// the lobby as the client lays it out once the name has been entered: the room list open, the name field shrunk away
+static void buildLobby(u8 roomCount) {
+	title = (struct UINode){
+		.type = UI_TYPE_TEXT,
+		.position = {
+			.old = { 0, ((i16)windowHeight / 2) - 256 },
+			.new = { 0, ((i16)windowHeight / 2) - 256 }
+		},
+		.scale = { .old = 255, .new = 255 },
+		.color = {
+			.base = colors.white,
+			.border = colors.black,
+			.old = colors.white,
+			.new = colors.white
+		},
+		.text = "Extreme Game"
+	};
+	u16 tw = (u16)textWidth(title.text, 32.f);
+	title.position.old.x = title.position.new.x = ((i16)windowWidth / 2) - (tw / 2);
+
+	settingsButton = (struct UINode){
+		.type = UI_TYPE_BUTTON,
+		.flags = UI_FLAG_ON_HOVER_ROTATE_ICON,
+		.body = UI_BODY_CIRCLE,
+		.onClick = UI_ON_CLICK_SETTINGS,
+		.position = {
+			.old = { 16 + 32, 16 + 32 },
+			.new = { 16 + 32, 16 + 32 }
+		},
+		.scale = { .old = 255, .new = 255 },
+		.radius = 32,
+		.color = {
+			.base = colors.gray,
+			.border = blendColor(colors.gray, colors.black, 0.25),
+			.old = colors.gray,
+			.new = colors.gray
+		},
+		.childCount = 2,
+		.children = settingsChildren
+	};
+
+	settingsChildren[0] = (struct UINode){
+		.type = UI_TYPE_ICON,
+		.scale = { .old = 255, .new = 255 },
+		.extent = { 48, 48 },
+		.imageView = IMAGE_VIEW_GEAR
+	};
+
+	settingsChildren[1] = (struct UINode){
+		.type = UI_TYPE_TOOLTIP,
+		.body = UI_BODY_SQUARE,
+		.position = {
+			.old = { 16, 96 },
+			.new = { 16, 96 }
+		},
+		.scale = { .old = 255, .new = 255 },
+		.extent = { 128, 32 },
+		.color = {
+			.base = { 56, 56, 56, 124 },
+			.old = { 56, 56, 56, 124 },
+			.new = { 56, 56, 56, 124 }
+		},
+		.childCount = 1,
+		.children = &settingsTooltipText
+	};
+
+	settingsTooltipText = (struct UINode){
+		.type = UI_TYPE_TEXT,
+		.position = {
+			.old = { 4, 4 },
+			.new = { 4, 4 }
+		},
+		.text = "settings"
+	};
+
+	discordButton = (struct UINode){
+		.type = UI_TYPE_BUTTON,
+		.body = UI_BODY_SQUARE,
+		.onClick = UI_ON_CLICK_DISCORD,
+		.position = {
+			.old = { 16 + 64 + 16, 16 },
+			.new = { 16 + 64 + 16, 16 }
+		},
+		.scale = { .old = 255, .new = 255 },
+		.extent = { 64, 64 },
+		.color = {
+			.base = colors.discordBlue,
+			.border = blendColor(colors.discordBlue, colors.black, 0.25),
+			.old = colors.discordBlue,
+			.new = colors.discordBlue
+		},
+		.childCount = 1,
+		.children = &discordIcon
+	};
+
+	discordIcon = (struct UINode){
+		.type = UI_TYPE_ICON,
+		.position = {
+			.old = { 32, 32 },
+			.new = { 32, 32 }
+		},
+		.scale = { .old = 255, .new = 255 },
+		.extent = { 48, 48 },
+		.imageView = IMAGE_VIEW_DISCORD
+	};
+
+	nameDiv = (struct UINode){
+		.type = UI_TYPE_NONE,
+		.scale = { .old = 0, .new = 0 }
+	};
+
+	roomList = (struct UINode){
+		.type = UI_TYPE_LIST,
+		.body = UI_BODY_SQUARE,
+		.position = {
+			.old = { 128, 128 },
+			.new = { 128, 128 }
+		},
+		.scale = { .old = 255, .new = 255 },
+		.extent = {
+			(u16)(windowWidth - 256),
+			(u16)(windowHeight - 256)
+		},
+		.color = {
+			.base = colors.yellow,
+			.border = blendColor(colors.yellow, colors.black, 0.25),
+			.old = colors.yellow,
+			.new = colors.yellow
+		},
+		.childCount = 1 + roomCount,
+		.children = roomItems
+	};
+
+	for (u8 i = 0; i < roomCount; i++) {
+		joinButtons[i] = (struct UINode){
+			.type = UI_TYPE_BUTTON,
+			.body = UI_BODY_SQUARE,
+			.flags = UI_FLAG_ARROW_ICON,
+			.position = {
+				.old = { 512 - (16 + 32), 16 },
+				.new = { 512 - (16 + 32), 16 }
+			},
+			.scale = { .old = 255, .new = 255 },
+			.extent = { 32, 32},
+			.color = {
+				.base = colors.green,
+				.border = blendColor(colors.green, colors.black, 0.25),
+				.old = colors.green,
+				.new = colors.green
+			}
+		};
+
+		snprintf(descriptions[i], sizeof(descriptions[i]), "room %u", i + 1);
+
+		roomItems[1 + i] = (struct UINode){
+			.type = UI_TYPE_LIST_ITEM,
+			.body = UI_BODY_SQUARE,
+			.position = {
+				.old = { 8, (i16)(8 + i * (64 + 8)) },
+				.new = { 8, (i16)(8 + i * (64 + 8)) }
+			},
+			.scale = { .old = 255, .new = 255 },
+			.extent = { 512, 64 },
+			.color = {
+				.base = colors.red,
+				.border = blendColor(colors.red, colors.black, 0.25),
+				.old = colors.red,
+				.new = colors.red
+			},
+			.text = descriptions[i],
+			.childCount = 1,
+			.children = &joinButtons[i]
+		};
+	}
+
+	roomItems[0] = (struct UINode){ // host game
+		.type = UI_TYPE_BUTTON,
+		.body = UI_BODY_SQUARE,
+		.onClick = UI_ON_CLICK_HOST_ROOM,
+		.position = {
+			.old = { (i16)roomList.extent.x - (256 + 32), (i16)roomList.extent.y - (64 + 32) },
+			.new = { (i16)roomList.extent.x - (256 + 32), (i16)roomList.extent.y - (64 + 32) }
+		},
+		.scale = { .old = 255, .new = 255 },
+		.extent = { 256, 64 },
+		.color = {
+			.base = colors.green,
+			.border = blendColor(colors.green, colors.black, 0.25),
+			.old = colors.green,
+			.new = colors.green
+		}
+	};
+
+	exitButton = (struct UINode){
+		.type = UI_TYPE_BUTTON,
+		.flags = UI_FLAG_CLOSE_ICON,
+		.body = UI_BODY_SQUARE,
+		.onClick = UI_ON_CLICK_LEAVE_LOBBY,
+		.position = {
+			.old = { (i16)(roomList.position.new.x + (roomList.extent.x - (32 + 32))), roomList.position.new.y + 32 },
+			.new = { (i16)(roomList.position.new.x + (roomList.extent.x - (32 + 32))), roomList.position.new.y + 32 }
+		},
+		.scale = { .old = 255, .new = 255 },
+		.extent = { 32, 32 },
+		.color = {
+			.base = colors.red,
+			.border = blendColor(colors.red, colors.black, 0.25),
+			.old = colors.red,
+			.new = colors.red
+		}
+	};
+
+	createRoomDialog = (struct UINode){
+		.type = UI_TYPE_DIALOG,
+		.body = UI_BODY_SQUARE,
+		.scale = { .old = 0, .new = 0 }
+	};
+}
+
+// the 2D half of the client's frame loop, in the same order, with no transition circle and so no scene
+static void lobbyFrame(void) {
+	arenaReset(&frameArena);
+	path = (struct Path2D){ };
+
+	streamsBeginFrame();
+	drawCalls = 0;
+	pipelineBinds = 0;
+	indicesDrawn = 0;
+
+	drawUINode(&title);
+	drawUINode(&nameDiv);
+	drawUINode(&roomList);
+	drawUINode(&createRoomDialog);
+	drawUINode(&discordButton);
+	drawUINode(&settingsButton);
+	drawUINode(&exitButton);
+
+	flush2D();
+	ringEndFrame(&frameRing);
+
+	frame = (frame + 1) % FRAMES_IN_FLIGHT;
+	msElapsed += 16;
+}
+
+static void bench(u8 roomCount) {
+	buildLobby(roomCount);
+
+	// the first frame lays the text out, every one after should record exactly the same
+	lobbyFrame();
+	u32 recorded = batch2D.recorded;
+	u32 draws = batch2D.draws;
+	u32 indices = indicesDrawn;
+
+	u64 frameTime = 0, flushTime = 0;
+
+	for (u32 i = 0; i < LOBBY_BENCH_FRAMES; i++) {
+		u64 start = platformClock();
+		lobbyFrame();
+		frameTime += platformClock() - start;
+		flushTime += batch2D.flushTime;
+
+		CHECK(batch2D.recorded == recorded);
+		CHECK(batch2D.draws == draws);
+		CHECK(drawCalls == draws);
+		CHECK(indicesDrawn == indices);
+		CHECK(pipelineBinds <= draws);
+	}
+
+	// the lobby is nearly all paths with a couple of icons and some text between them, so plenty of it merges
+	CHECK(draws < recorded);
+
+	printf("%3u rooms: %4u commands that were a draw each, now %2u draws and %2u pipeline binds, %6.1f us a frame of which %5.1f us flushing\n",
+		roomCount, recorded, draws, pipelineBinds,
+		frameTime / 1e3 / LOBBY_BENCH_FRAMES,
+		flushTime / 1e3 / LOBBY_BENCH_FRAMES);
+}
+
+int main(void) {
+	vkCmdBindIndexBuffer = stubBindIndexBuffer;
+	vkCmdBindVertexBuffers = stubBindVertexBuffers;
+	vkCmdBindPipeline = stubBindPipeline;
+	vkCmdDrawIndexed = stubDrawIndexed;
+
+	// the ring hands out plain memory that nothing reads back
+	buffers[BUFFER_FRAME].handle = (VkBuffer)(uintptr_t)0x1000;
+	buffers[BUFFER_FRAME].data = platformMemoryReserve(buffers[BUFFER_FRAME].size);
+	platformMemoryCommit(buffers[BUFFER_FRAME].data, buffers[BUFFER_FRAME].size);
+
+	arenaInit(&frameArena, 256ull << 20);
+
+	windowWidth = LOBBY_BENCH_WIDTH;
+	windowHeight = LOBBY_BENCH_HEIGHT;
+
+	viewport = mat4FromTranslation((vec3){ -1.f, -1.f, 0.f });
+	viewport[0][0] = 2.f / (float)windowWidth;
+	viewport[1][1] = 2.f / (float)windowHeight;
+
+	// past every animation, with the mouse nowhere near anything so nothing is hovered
+	msElapsed = 1u << 20;
+	deltaTime = 0.016f;
+	mouse = (POINT){ -(1 << 14), -(1 << 14) };
+
+	bench(0);
+	bench(4);
+	bench(11); // as many as fit the list at 1080p
+
+	if (failures) {
+		fprintf(stderr, "%u checks failed\n", failures);
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,218 @@
+#include "tlsf.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+static u32 failures;
+
+#define CHECK(condition) do { \
+	if (!(condition)) { \
+		fprintf(stderr, "%s:%d: %s\n", __FILE__, __LINE__, #condition); \
+		failures++; \
+	} \
+} while (0)
+
+// walks a block front to back: regions tile it exactly, no two free ones touch, and every free one is on the list of
+// its size class; returns how many regions the block is in
+static u32 tlsfCheck(const struct Tlsf* tlsf, u16 block, u64 blockSize) {
+	u16 first = TLSF_NONE;
+	u32 live = 0;
+
+	for (u16 i = 0; i < tlsfRegions.index.count; i++) {
+		u16 idx = tlsfRegions.index.dense[i];
+		if (tlsfRegions.data[idx].block != block)
+			continue;
+
+		live++;
+		if (tlsfRegions.data[idx].previous == TLSF_NONE)
+			first = idx;
+	}
+
+	u32 walked = 0;
+	u64 offset = 0;
+	bool previousFree = false;
+
+	for (u16 idx = first; idx != TLSF_NONE; idx = tlsfRegions.data[idx].next) {
+		const struct TlsfRegion* region = &tlsfRegions.data[idx];
+
+		CHECK(region->offset == offset);
+		CHECK(region->size && region->size % TLSF_GRANULARITY == 0);
+		CHECK(!(previousFree && region->free));
+
+		if (region->free) {
+			u32 fl, sl;
+			tlsfMapping(region->size, &fl, &sl);
+
+			bool listed = false;
+			if (tlsf->secondLevels[fl] & (1 << sl))
+				for (u16 at = tlsf->heads[fl][sl]; at != TLSF_NONE && !listed; at = tlsfRegions.data[at].nextFree)
+					listed = at == idx;
+
+			CHECK(listed);
+		}
+
+		offset += region->size;
+		previousFree = region->free;
+		walked++;
+	}
+
+	CHECK(offset == blockSize);
+	CHECK(walked == live);
+
+	return walked;
+}
+
+static void testSplit(void) {
+	struct Tlsf tlsf = { };
+	CHECK(tlsfAddBlock(&tlsf, 0, 1 << 20));
+
+	u16 a = tlsfAllocate(&tlsf, 1000, 1);
+	CHECK(a != TLSF_NONE);
+	CHECK(tlsfRegions.data[a].offset == 0);
+	CHECK(tlsfRegions.data[a].size == 1024);
+	CHECK(tlsf.used == 1024);
+	CHECK(tlsfCheck(&tlsf, 0, 1 << 20) == 2);
+
+	u16 b = tlsfAllocate(&tlsf, 2048, 1);
+	CHECK(tlsfRegions.data[b].offset == 1024);
+	CHECK(tlsfCheck(&tlsf, 0, 1 << 20) == 3);
+
+	// only a class every region of which fits is searched, so the rest of the block can't be had in one piece
+	CHECK(tlsfAllocate(&tlsf, (1 << 20) - 3072, 1) == TLSF_NONE);
+	CHECK(tlsfAllocate(&tlsf, 1 << 19, 1) != TLSF_NONE);
+
+	tlsfFree(&tlsf, a);
+	CHECK(tlsfCheck(&tlsf, 0, 1 << 20) == 4);
+}
+
+static void testMerge(void) {
+	struct Tlsf tlsf = { };
+	CHECK(tlsfAddBlock(&tlsf, 1, 1 << 16));
+
+	u16 regions[4];
+	for (u32 i = 0; i < 4; i++)
+		regions[i] = tlsfAllocate(&tlsf, 1 << 14, 1);
+
+	CHECK(tlsfCheck(&tlsf, 1, 1 << 16) == 4);
+
+	// with the next one free, then the previous one, then both
+	tlsfFree(&tlsf, regions[2]);
+	tlsfFree(&tlsf, regions[1]);
+	CHECK(tlsfCheck(&tlsf, 1, 1 << 16) == 3);
+
+	tlsfFree(&tlsf, regions[0]);
+	CHECK(tlsfCheck(&tlsf, 1, 1 << 16) == 2);
+
+	tlsfFree(&tlsf, regions[3]);
+	CHECK(tlsfCheck(&tlsf, 1, 1 << 16) == 1);
+	CHECK(tlsf.used == 0);
+
+	u16 whole = tlsfAllocate(&tlsf, 1 << 16, 1);
+	CHECK(whole != TLSF_NONE && tlsfRegions.data[whole].size == 1 << 16);
+}
+
+static void testAlignment(void) {
+	struct Tlsf tlsf = { };
+	CHECK(tlsfAddBlock(&tlsf, 2, 1 << 20));
+
+	u16 small = tlsfAllocate(&tlsf, 256, 1);
+
+	for (u64 alignment = 512; alignment <= 1 << 16; alignment <<= 1) {
+		u16 idx = tlsfAllocate(&tlsf, 300, alignment);
+
+		CHECK(idx != TLSF_NONE);
+		CHECK(tlsfRegions.data[idx].offset % alignment == 0);
+		CHECK(tlsfRegions.data[idx].size == 512);
+
+		tlsfCheck(&tlsf, 2, 1 << 20);
+		tlsfFree(&tlsf, idx);
+	}
+
+	// the padding in front of an aligned region goes back on the free lists
+	u16 aligned = tlsfAllocate(&tlsf, 256, 1 << 12);
+	CHECK(tlsfRegions.data[aligned].offset == 1 << 12);
+	CHECK(tlsfCheck(&tlsf, 2, 1 << 20) == 4);
+
+	tlsfFree(&tlsf, aligned);
+	tlsfFree(&tlsf, small);
+	CHECK(tlsfCheck(&tlsf, 2, 1 << 20) == 1);
+}
+
+static void testFragmentation(void) {
+	enum { CHUNK = 1 << 12, CHUNKS = 64 };
+
+	struct Tlsf tlsf = { };
+	CHECK(tlsfAddBlock(&tlsf, 3, CHUNK * CHUNKS));
+
+	u16 chunks[CHUNKS];
+	for (u32 i = 0; i < CHUNKS; i++)
+		chunks[i] = tlsfAllocate(&tlsf, CHUNK, 1);
+
+	CHECK(tlsf.used == CHUNK * CHUNKS);
+
+	// half the space is free but no two free chunks touch
+	for (u32 i = 0; i < CHUNKS; i += 2)
+		tlsfFree(&tlsf, chunks[i]);
+
+	CHECK(tlsfCheck(&tlsf, 3, CHUNK * CHUNKS) == CHUNKS);
+	CHECK(tlsfAllocate(&tlsf, CHUNK * 2, 1) == TLSF_NONE);
+
+	u16 refill = tlsfAllocate(&tlsf, CHUNK, 1);
+	CHECK(refill != TLSF_NONE);
+	tlsfFree(&tlsf, refill);
+
+	for (u32 i = 1; i < CHUNKS; i += 2)
+		tlsfFree(&tlsf, chunks[i]);
+
+	CHECK(tlsfCheck(&tlsf, 3, CHUNK * CHUNKS) == 1);
+
+	// random sizes and alignments, freed in random order, always tile the block and merge back to one region
+	u16 live[256];
+	u32 liveCount = 0;
+	u32 seed = 0x9E3779B9;
+
+	for (u32 step = 0; step < 20000; step++) {
+		seed ^= seed << 13;
+		seed ^= seed >> 17;
+		seed ^= seed << 5;
+
+		if (liveCount < 256 && (seed & 1 || !liveCount)) {
+			u64 size = 1 + (seed >> 8) % (CHUNK * 4);
+			u64 alignment = 1ull << ((seed >> 4) % 14);
+
+			u16 idx = tlsfAllocate(&tlsf, size, alignment);
+			if (idx != TLSF_NONE) {
+				CHECK(tlsfRegions.data[idx].offset % __builtin_elementwise_max(alignment, (u64)TLSF_GRANULARITY) == 0);
+				CHECK(tlsfRegions.data[idx].size >= size);
+				live[liveCount++] = idx;
+			}
+		} else {
+			u32 pick = (seed >> 8) % liveCount;
+			tlsfFree(&tlsf, live[pick]);
+			live[pick] = live[--liveCount];
+		}
+
+		if (step % 64 == 0)
+			tlsfCheck(&tlsf, 3, CHUNK * CHUNKS);
+	}
+
+	while (liveCount)
+		tlsfFree(&tlsf, live[--liveCount]);
+
+	CHECK(tlsf.used == 0);
+	CHECK(tlsfCheck(&tlsf, 3, CHUNK * CHUNKS) == 1);
+}
+
+int main(void) {
+	testSplit();
+	testMerge();
+	testAlignment();
+	testFragmentation();
+
+	if (failures) {
+		fprintf(stderr, "%u checks failed\n", failures);
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,67 @@
+#include "ttf.h"
+#include "ttf_reference.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// texel values a cell may be off by; flattened points can round differently once the compiler contracts into FMAs
+#define TTF_TEST_TOLERANCE 2
+
+INCBIN(ubuntuBold, "assets/Ubuntu-B.ttf");
+
+static u8 pixels[FONT_ATLAS_SIZE * FONT_ATLAS_SIZE];
+static struct FontAtlas atlas;
+
+static u32 failures;
+
+#define CHECK(condition) do { \
+	if (!(condition)) { \
+		fprintf(stderr, "%s:%d: %s\n", __FILE__, __LINE__, #condition); \
+		failures++; \
+	} \
+} while (0)
+
+int main(void) {
+	struct Ttf ttf;
+
+	CHECK(ttfInit(&ttf, (const u8*)incbin_ubuntuBold_start, (u32)(incbin_ubuntuBold_end - incbin_ubuntuBold_start)));
+	CHECK(ttfBakeAtlas(&ttf, FONT_PIXELS_PER_EM, FONT_SPREAD, pixels, FONT_ATLAS_SIZE, FONT_ATLAS_SIZE, &atlas));
+
+	if (failures)
+		return EXIT_FAILURE;
+
+	for (u32 r = 0; r < sizeof(ttfReferenceCells) / sizeof(ttfReferenceCells[0]); r++) {
+		const struct TtfReferenceCell* reference = &ttfReferenceCells[r];
+		const struct FontGlyph* glyph = &atlas.glyphs[reference->c - FONT_FIRST_CHAR];
+
+		CHECK(glyph->width == reference->width && glyph->height == reference->height);
+		if (glyph->width != reference->width || glyph->height != reference->height)
+			continue;
+
+		u32 mismatches = 0;
+		i32 worst = 0;
+
+		for (u32 j = 0; j < glyph->height; j++)
+			for (u32 i = 0; i < glyph->width; i++) {
+				i32 difference = abs((i32)pixels[(glyph->y + j) * FONT_ATLAS_SIZE + glyph->x + i] - (i32)reference->pixels[j * reference->width + i]);
+
+				if (difference > TTF_TEST_TOLERANCE)
+					mismatches++;
+
+				if (difference > worst)
+					worst = difference;
+			}
+
+		if (mismatches) {
+			fprintf(stderr, "'%c': %u texels off by up to %d\n", reference->c, mismatches, worst);
+			failures++;
+		}
+	}
+
+	if (failures) {
+		fprintf(stderr, "%u checks failed\n", failures);
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,532 @@
+#pragma once
+
+// cells of assets/Ubuntu-B.ttf baked by ttfBakeAtlas at FONT_PIXELS_PER_EM 64 and FONT_SPREAD 6, row by row from the
+// top; ':' and '"' are composite glyphs
+struct TtfReferenceCell {
+	char c;
+	u16 width, height;
+	const u8* pixels;
+};
+
+static const u8 ttfReferenceA[57 * 57] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+	0x0b, 0x0a, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x15, 0x1d,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1c, 0x14, 0x09, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x1b, 0x28, 0x31, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+	0x35, 0x35, 0x35, 0x35, 0x30, 0x27, 0x19, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x18, 0x2a,
+	0x39, 0x45, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x44, 0x37, 0x28,
+	0x16, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x22, 0x35, 0x48, 0x57, 0x5f, 0x60, 0x60, 0x60, 0x60,
+	0x60, 0x60, 0x60, 0x60, 0x60, 0x5f, 0x55, 0x45, 0x32, 0x1f, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x17,
+	0x2b, 0x3e, 0x51, 0x65, 0x74, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x73, 0x62,
+	0x4f, 0x3b, 0x28, 0x15, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x20, 0x33, 0x47, 0x5a, 0x6d, 0x81, 0x8a, 0x8a,
+	0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x7e, 0x6b, 0x57, 0x44, 0x31, 0x1d, 0x0a, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+	0x16, 0x29, 0x3c, 0x50, 0x63, 0x76, 0x8a, 0x9d, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9a,
+	0x87, 0x74, 0x60, 0x4d, 0x39, 0x26, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x1f, 0x32, 0x45, 0x58, 0x6c, 0x7f, 0x92,
+	0xa6, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xa3, 0x90, 0x7c, 0x69, 0x56, 0x42, 0x2f, 0x1c,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x14, 0x27, 0x3b, 0x4e, 0x61, 0x75, 0x88, 0x9b, 0xaf, 0xc2, 0xca, 0xca, 0xca, 0xca, 0xca,
+	0xbf, 0xac, 0x98, 0x85, 0x72, 0x5e, 0x4b, 0x38, 0x24, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1d, 0x30, 0x44, 0x57, 0x6a, 0x7d,
+	0x91, 0xa4, 0xb7, 0xcb, 0xde, 0xdf, 0xdf, 0xdf, 0xdb, 0xc8, 0xb5, 0xa1, 0x8e, 0x7b, 0x67, 0x54,
+	0x41, 0x2d, 0x1a, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x12, 0x26, 0x39, 0x4c, 0x60, 0x73, 0x86, 0x9a, 0xad, 0xc0, 0xd4, 0xe7, 0xe1, 0xe0,
+	0xe4, 0xe4, 0xd1, 0xbd, 0xaa, 0x97, 0x83, 0x70, 0x5d, 0x49, 0x36, 0x23, 0x0f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1b, 0x2f, 0x42, 0x55, 0x69,
+	0x7c, 0x8f, 0xa2, 0xb6, 0xc9, 0xdc, 0xd3, 0xcc, 0xcb, 0xd0, 0xd9, 0xda, 0xc6, 0xb3, 0x9f, 0x8c,
+	0x79, 0x65, 0x52, 0x3f, 0x2b, 0x18, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x11, 0x24, 0x37, 0x4b, 0x5e, 0x71, 0x85, 0x98, 0xab, 0xbf, 0xd2, 0xcf, 0xc1,
+	0xb8, 0xb6, 0xbc, 0xc8, 0xd8, 0xcf, 0xbc, 0xa8, 0x95, 0x82, 0x6e, 0x5b, 0x48, 0x34, 0x21, 0x0d,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x19, 0x2c, 0x40, 0x54,
+	0x67, 0x7a, 0x8e, 0xa1, 0xb4, 0xc7, 0xd5, 0xc2, 0xb0, 0xa4, 0xa1, 0xaa, 0xba, 0xcd, 0xd8, 0xc4,
+	0xb1, 0x9e, 0x8a, 0x77, 0x64, 0x50, 0x3d, 0x29, 0x16, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0d, 0x21, 0x35, 0x48, 0x5c, 0x6f, 0x83, 0x96, 0xaa, 0xbd, 0xd0, 0xcd,
+	0xba, 0xa6, 0x93, 0x8d, 0x9d, 0xb1, 0xc5, 0xd9, 0xcd, 0xba, 0xa6, 0x93, 0x80, 0x6c, 0x59, 0x45,
+	0x31, 0x1e, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x15, 0x29, 0x3d,
+	0x50, 0x64, 0x78, 0x8b, 0x9f, 0xb2, 0xc6, 0xd9, 0xc6, 0xb2, 0x9e, 0x8a, 0x82, 0x96, 0xa9, 0xbd,
+	0xd1, 0xd6, 0xc3, 0xaf, 0x9c, 0x88, 0x74, 0x61, 0x4d, 0x39, 0x26, 0x12, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1d, 0x31, 0x45, 0x58, 0x6c, 0x80, 0x93, 0xa7, 0xbb, 0xce,
+	0xd3, 0xbf, 0xab, 0x97, 0x83, 0x7a, 0x8e, 0xa2, 0xb5, 0xc9, 0xdd, 0xcb, 0xb7, 0xa4, 0x90, 0x7c,
+	0x69, 0x55, 0x42, 0x2e, 0x1a, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x26,
+	0x39, 0x4d, 0x61, 0x74, 0x88, 0x9b, 0xaf, 0xc3, 0xd6, 0xcb, 0xb7, 0xa3, 0x90, 0x7c, 0x72, 0x86,
+	0x9a, 0xae, 0xc1, 0xd5, 0xd3, 0xc0, 0xac, 0x98, 0x85, 0x71, 0x5d, 0x4a, 0x36, 0x23, 0x0f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1a, 0x2e, 0x41, 0x55, 0x69, 0x7c, 0x90, 0xa4, 0xb7,
+	0xcb, 0xd7, 0xc4, 0xb0, 0x9c, 0x88, 0x74, 0x6b, 0x7e, 0x92, 0xa6, 0xba, 0xce, 0xdb, 0xc8, 0xb4,
+	0xa0, 0x8d, 0x79, 0x66, 0x52, 0x3e, 0x2b, 0x17, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f,
+	0x22, 0x36, 0x49, 0x5d, 0x71, 0x84, 0x98, 0xac, 0xbf, 0xd3, 0xd0, 0xbc, 0xa8, 0x94, 0x80, 0x6d,
+	0x63, 0x77, 0x8a, 0x9e, 0xb2, 0xc6, 0xda, 0xd0, 0xbc, 0xa9, 0x95, 0x81, 0x6e, 0x5a, 0x47, 0x33,
+	0x1f, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x17, 0x2a, 0x3e, 0x52, 0x65, 0x79, 0x8d, 0xa0,
+	0xb4, 0xc7, 0xdb, 0xc8, 0xb4, 0xa1, 0x8d, 0x79, 0x65, 0x5b, 0x6f, 0x83, 0x96, 0xaa, 0xbe, 0xd2,
+	0xd8, 0xc4, 0xb1, 0x9d, 0x8a, 0x76, 0x62, 0x4f, 0x3b, 0x28, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0b, 0x1f, 0x32, 0x46, 0x5a, 0x6d, 0x81, 0x95, 0xa8, 0xbc, 0xd0, 0xd5, 0xc1, 0xad, 0x99, 0x85,
+	0x71, 0x5d, 0x53, 0x67, 0x7b, 0x8f, 0xa3, 0xb6, 0xca, 0xde, 0xcd, 0xb9, 0xa5, 0x92, 0x7e, 0x6b,
+	0x57, 0x43, 0x30, 0x1c, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x27, 0x3b, 0x4e, 0x62, 0x76, 0x89,
+	0x9d, 0xb0, 0xc4, 0xd8, 0xcd, 0xb9, 0xa5, 0x91, 0x7e, 0x6a, 0x56, 0x4c, 0x5f, 0x73, 0x87, 0x9b,
+	0xaf, 0xc3, 0xd7, 0xd5, 0xc1, 0xae, 0x9a, 0x86, 0x73, 0x5f, 0x4b, 0x38, 0x24, 0x11, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x07, 0x1b, 0x2f, 0x43, 0x56, 0x6a, 0x7e, 0x91, 0xa5, 0xb9, 0xcc, 0xd9, 0xc5, 0xb2, 0x9e,
+	0x8a, 0x76, 0x62, 0x4e, 0x44, 0x58, 0x6c, 0x80, 0x94, 0xa7, 0xbb, 0xcf, 0xdd, 0xc9, 0xb6, 0xa2,
+	0x8f, 0x7b, 0x67, 0x54, 0x40, 0x2c, 0x18, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x23, 0x37, 0x4a, 0x5e, 0x72,
+	0x86, 0x99, 0xad, 0xc1, 0xd4, 0xd2, 0xbe, 0xaa, 0x96, 0x82, 0x6e, 0x5b, 0x47, 0x3d, 0x50, 0x64,
+	0x78, 0x8c, 0xa0, 0xb4, 0xc8, 0xdb, 0xd2, 0xbe, 0xaa, 0x97, 0x83, 0x6f, 0x5c, 0x48, 0x34, 0x20,
+	0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x16, 0x2a, 0x3e, 0x52, 0x66, 0x7a, 0x8e, 0xa1, 0xb5, 0xc9, 0xdc, 0xca, 0xb6,
+	0xa2, 0x8f, 0x7b, 0x67, 0x53, 0x3f, 0x35, 0x49, 0x5d, 0x71, 0x84, 0x98, 0xac, 0xc0, 0xd4, 0xda,
+	0xc6, 0xb2, 0x9f, 0x8b, 0x77, 0x63, 0x4f, 0x3b, 0x28, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1e, 0x32, 0x46, 0x5a,
+	0x6d, 0x81, 0x95, 0xa9, 0xbd, 0xd1, 0xd7, 0xc3, 0xaf, 0x9b, 0x87, 0x73, 0x5f, 0x4b, 0x38, 0x2d,
+	0x41, 0x55, 0x69, 0x7d, 0x91, 0xa5, 0xb9, 0xcd, 0xe1, 0xce, 0xba, 0xa6, 0x92, 0x7f, 0x6b, 0x57,
+	0x43, 0x2f, 0x1b, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x12, 0x26, 0x39, 0x4d, 0x61, 0x75, 0x89, 0x9d, 0xb1, 0xc4, 0xd8, 0xd0,
+	0xbc, 0xa8, 0x94, 0x80, 0x6c, 0x58, 0x44, 0x30, 0x26, 0x3a, 0x4e, 0x62, 0x76, 0x8a, 0x9e, 0xb2,
+	0xc6, 0xda, 0xd6, 0xc2, 0xae, 0x9a, 0x86, 0x72, 0x5e, 0x4b, 0x37, 0x23, 0x0f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x19, 0x2d, 0x41,
+	0x55, 0x69, 0x7d, 0x90, 0xa4, 0xb8, 0xcc, 0xdc, 0xc8, 0xb4, 0xa0, 0x8c, 0x79, 0x65, 0x51, 0x3d,
+	0x39, 0x39, 0x39, 0x47, 0x5b, 0x6f, 0x83, 0x97, 0xab, 0xbe, 0xd2, 0xdd, 0xc9, 0xb5, 0xa2, 0x8e,
+	0x7a, 0x66, 0x52, 0x3e, 0x2b, 0x17, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x21, 0x35, 0x49, 0x5d, 0x70, 0x84, 0x98, 0xac, 0xc0, 0xd4,
+	0xd5, 0xc1, 0xad, 0x99, 0x85, 0x71, 0x5d, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x53, 0x67, 0x7b,
+	0x8f, 0xa3, 0xb7, 0xcb, 0xdf, 0xd1, 0xbd, 0xa9, 0x95, 0x82, 0x6e, 0x5a, 0x46, 0x32, 0x1e, 0x0a,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x15, 0x29,
+	0x3c, 0x50, 0x64, 0x78, 0x8c, 0xa0, 0xb3, 0xc7, 0xdb, 0xce, 0xba, 0xa6, 0x92, 0x7e, 0x6a, 0x64,
+	0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x74, 0x88, 0x9c, 0xb0, 0xc4, 0xd8, 0xd8, 0xc5,
+	0xb1, 0x9d, 0x89, 0x75, 0x61, 0x4e, 0x3a, 0x26, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1c, 0x30, 0x44, 0x58, 0x6c, 0x80, 0x93, 0xa7, 0xbb,
+	0xcf, 0xde, 0xc9, 0xb4, 0x9f, 0x8b, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
+	0x79, 0x79, 0x81, 0x95, 0xaa, 0xbf, 0xd4, 0xe0, 0xcc, 0xb8, 0xa5, 0x91, 0x7d, 0x69, 0x55, 0x41,
+	0x2d, 0x1a, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+	0x24, 0x38, 0x4c, 0x5f, 0x73, 0x87, 0x9b, 0xaf, 0xc3, 0xd7, 0xdf, 0xca, 0xb5, 0xa1, 0x91, 0x8e,
+	0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x98, 0xac, 0xc0, 0xd5,
+	0xe8, 0xd4, 0xc0, 0xac, 0x98, 0x84, 0x71, 0x5d, 0x49, 0x35, 0x21, 0x0d, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x18, 0x2b, 0x3f, 0x53, 0x67, 0x7b, 0x8f, 0xa3,
+	0xb6, 0xca, 0xde, 0xe4, 0xd1, 0xbe, 0xaf, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
+	0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa9, 0xb6, 0xc8, 0xdb, 0xef, 0xdb, 0xc8, 0xb4, 0xa0, 0x8c, 0x78,
+	0x64, 0x50, 0x3d, 0x29, 0x15, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0b, 0x1f, 0x33, 0x47, 0x5b, 0x6f, 0x82, 0x96, 0xaa, 0xbe, 0xd2, 0xe6, 0xee, 0xdc, 0xcd, 0xc0,
+	0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xbc, 0xc6,
+	0xd4, 0xe5, 0xf7, 0xe3, 0xcf, 0xbb, 0xa7, 0x94, 0x80, 0x6c, 0x58, 0x44, 0x30, 0x1d, 0x09, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x27, 0x3a, 0x4e, 0x62, 0x76, 0x8a,
+	0x9e, 0xb2, 0xc6, 0xd9, 0xed, 0xe5, 0xdd, 0xda, 0xd4, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce,
+	0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xd0, 0xd8, 0xdb, 0xe0, 0xe9, 0xeb, 0xd7, 0xc3, 0xaf,
+	0x9b, 0x87, 0x74, 0x60, 0x4c, 0x38, 0x24, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x1a, 0x2e, 0x42, 0x56, 0x6a, 0x7e, 0x92, 0xa6, 0xb9, 0xcd, 0xe1, 0xdf, 0xd2, 0xc9,
+	0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5,
+	0xc5, 0xc5, 0xc6, 0xcc, 0xd8, 0xe6, 0xde, 0xcb, 0xb7, 0xa3, 0x8f, 0x7b, 0x67, 0x53, 0x3f, 0x2b,
+	0x17, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x21, 0x35, 0x49, 0x5d, 0x71,
+	0x85, 0x99, 0xad, 0xc1, 0xd5, 0xe3, 0xd1, 0xc1, 0xb5, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf,
+	0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xb1, 0xba, 0xc8, 0xda, 0xe6,
+	0xd2, 0xbe, 0xaa, 0x96, 0x82, 0x6e, 0x5a, 0x46, 0x32, 0x1e, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x14, 0x28, 0x3c, 0x50, 0x64, 0x78, 0x8c, 0xa0, 0xb4, 0xc8, 0xdc, 0xdb, 0xc7,
+	0xb4, 0xa3, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a,
+	0x9a, 0x9a, 0x9a, 0x9a, 0x9d, 0xaa, 0xbd, 0xd0, 0xe4, 0xd9, 0xc5, 0xb1, 0x9d, 0x89, 0x75, 0x61,
+	0x4e, 0x3a, 0x26, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1c, 0x30, 0x43, 0x57,
+	0x6b, 0x7f, 0x93, 0xa7, 0xbb, 0xcf, 0xe3, 0xd4, 0xc0, 0xac, 0x98, 0x86, 0x85, 0x85, 0x85, 0x85,
+	0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x8d, 0xa1, 0xb5,
+	0xc9, 0xdd, 0xe1, 0xcd, 0xb9, 0xa5, 0x91, 0x7d, 0x69, 0x55, 0x41, 0x2d, 0x19, 0x05, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0f, 0x23, 0x37, 0x4b, 0x5f, 0x73, 0x87, 0x9b, 0xaf, 0xc3, 0xd7, 0xe1,
+	0xcd, 0xb9, 0xa5, 0x91, 0x7d, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+	0x70, 0x70, 0x70, 0x70, 0x70, 0x72, 0x86, 0x9a, 0xae, 0xc2, 0xd6, 0xe8, 0xd4, 0xc0, 0xac, 0x98,
+	0x84, 0x70, 0x5c, 0x48, 0x34, 0x20, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x16, 0x2a, 0x3e,
+	0x52, 0x66, 0x7a, 0x8e, 0xa2, 0xb6, 0xca, 0xde, 0xda, 0xc6, 0xb2, 0x9e, 0x8a, 0x76, 0x62, 0x5a,
+	0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x6b, 0x7f,
+	0x93, 0xa7, 0xbb, 0xcf, 0xe3, 0xdb, 0xc7, 0xb3, 0x9f, 0x8b, 0x77, 0x63, 0x4f, 0x3b, 0x27, 0x13,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1d, 0x31, 0x45, 0x59, 0x6d, 0x81, 0x95, 0xa9, 0xbd, 0xd1,
+	0xe5, 0xd3, 0xbf, 0xab, 0x97, 0x83, 0x6f, 0x5b, 0x47, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+	0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x50, 0x64, 0x78, 0x8c, 0xa0, 0xb4, 0xc8, 0xdc, 0xe2, 0xce,
+	0xba, 0xa6, 0x92, 0x7e, 0x6a, 0x56, 0x42, 0x2e, 0x1a, 0x06, 0x00, 0x00, 0x00, 0x00, 0x10, 0x24,
+	0x38, 0x4c, 0x60, 0x74, 0x88, 0x9c, 0xb0, 0xc4, 0xd8, 0xe0, 0xcc, 0xb8, 0xa4, 0x90, 0x7c, 0x68,
+	0x54, 0x40, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x49,
+	0x5d, 0x71, 0x85, 0x99, 0xad, 0xc1, 0xd5, 0xea, 0xd6, 0xc2, 0xae, 0x9a, 0x86, 0x71, 0x5d, 0x49,
+	0x35, 0x21, 0x0d, 0x00, 0x00, 0x00, 0x03, 0x17, 0x2b, 0x3f, 0x53, 0x67, 0x7b, 0x8f, 0xa3, 0xb7,
+	0xcb, 0xdf, 0xda, 0xc6, 0xb1, 0x9d, 0x89, 0x75, 0x61, 0x4d, 0x39, 0x25, 0x1b, 0x1b, 0x1b, 0x1b,
+	0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x2e, 0x42, 0x56, 0x6a, 0x7e, 0x92, 0xa6, 0xbb, 0xcf,
+	0xe3, 0xdd, 0xc9, 0xb5, 0xa1, 0x8d, 0x79, 0x65, 0x50, 0x3c, 0x28, 0x14, 0x00, 0x00, 0x00, 0x0a,
+	0x1e, 0x32, 0x46, 0x5a, 0x6e, 0x82, 0x96, 0xaa, 0xbe, 0xd1, 0xd1, 0xd1, 0xbf, 0xab, 0x97, 0x82,
+	0x6e, 0x5a, 0x46, 0x32, 0x1e, 0x0a, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x13,
+	0x27, 0x3b, 0x4f, 0x63, 0x77, 0x8c, 0xa0, 0xb4, 0xc8, 0xd1, 0xd1, 0xd0, 0xbc, 0xa8, 0x94, 0x80,
+	0x6c, 0x58, 0x43, 0x2f, 0x1b, 0x07, 0x00, 0x00, 0x11, 0x25, 0x39, 0x4d, 0x61, 0x75, 0x89, 0x9d,
+	0xb1, 0xbc, 0xbc, 0xbc, 0xbc, 0xb8, 0xa4, 0x90, 0x7c, 0x68, 0x53, 0x3f, 0x2b, 0x17, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x20, 0x34, 0x48, 0x5d, 0x71, 0x85, 0x99,
+	0xad, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xaf, 0x9b, 0x87, 0x73, 0x5f, 0x4b, 0x37, 0x22, 0x0e, 0x00,
+	0x04, 0x18, 0x2c, 0x40, 0x54, 0x68, 0x7c, 0x90, 0xa5, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x9d,
+	0x89, 0x75, 0x61, 0x4d, 0x39, 0x24, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x05, 0x19, 0x2e, 0x42, 0x56, 0x6a, 0x7e, 0x92, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
+	0xa2, 0x8e, 0x7a, 0x66, 0x52, 0x3e, 0x2a, 0x16, 0x01, 0x09, 0x1e, 0x33, 0x47, 0x5b, 0x6f, 0x83,
+	0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x83, 0x6e, 0x5a, 0x46, 0x32, 0x1e, 0x09,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x27, 0x3b, 0x4f, 0x63,
+	0x78, 0x8c, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x81, 0x6d, 0x59, 0x45, 0x30,
+	0x1b, 0x06, 0x0b, 0x20, 0x35, 0x4a, 0x5f, 0x74, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+	0x7c, 0x7c, 0x7b, 0x68, 0x54, 0x3f, 0x2b, 0x17, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0c, 0x20, 0x34, 0x49, 0x5d, 0x71, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+	0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x72, 0x5d, 0x47, 0x32, 0x1d, 0x08, 0x08, 0x1d, 0x31, 0x45, 0x57,
+	0x65, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x5d, 0x4c, 0x39, 0x24,
+	0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x1a, 0x2e,
+	0x42, 0x54, 0x63, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x64, 0x55,
+	0x42, 0x2e, 0x1a, 0x05, 0x02, 0x16, 0x28, 0x39, 0x48, 0x51, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+	0x52, 0x52, 0x52, 0x52, 0x52, 0x4c, 0x3f, 0x2f, 0x1d, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x25, 0x37, 0x46, 0x50, 0x52, 0x52, 0x52, 0x52,
+	0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x50, 0x46, 0x37, 0x26, 0x13, 0x00, 0x00, 0x0b, 0x1b,
+	0x2a, 0x35, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x38, 0x2f,
+	0x21, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0x19, 0x28, 0x34, 0x3b, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+	0x3b, 0x34, 0x28, 0x19, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x19, 0x22, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x24, 0x1c, 0x11, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x17, 0x20, 0x26, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x26, 0x21, 0x17, 0x0a, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x06, 0x0e, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x0f, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x0c, 0x11, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x12, 0x12, 0x11, 0x0d, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00,
+};
+
+static const u8 ttfReferenceG[43 * 59] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x05, 0x07, 0x08, 0x0a, 0x0a, 0x09, 0x08, 0x08, 0x06, 0x04, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x08, 0x0e, 0x13, 0x18, 0x1a, 0x1c,
+	0x1d, 0x1f, 0x20, 0x1f, 0x1e, 0x1d, 0x1b, 0x19, 0x16, 0x14, 0x11, 0x0d, 0x09, 0x06, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x06, 0x10, 0x17, 0x1d, 0x22, 0x28, 0x2d, 0x2f, 0x31, 0x33, 0x34, 0x35, 0x34, 0x33,
+	0x32, 0x30, 0x2e, 0x2b, 0x29, 0x26, 0x22, 0x1e, 0x1b, 0x16, 0x11, 0x0b, 0x06, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x10, 0x19, 0x23, 0x2c,
+	0x31, 0x37, 0x3c, 0x42, 0x45, 0x46, 0x48, 0x49, 0x4a, 0x49, 0x48, 0x47, 0x45, 0x43, 0x41, 0x3e,
+	0x3b, 0x37, 0x33, 0x30, 0x2a, 0x25, 0x20, 0x1a, 0x10, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x1a, 0x23, 0x2c, 0x36, 0x3f, 0x46, 0x4b, 0x51, 0x56, 0x5a,
+	0x5b, 0x5d, 0x5f, 0x5f, 0x5e, 0x5d, 0x5c, 0x5b, 0x58, 0x56, 0x53, 0x50, 0x4c, 0x48, 0x44, 0x3f,
+	0x3a, 0x35, 0x2d, 0x21, 0x12, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x11,
+	0x1e, 0x2b, 0x36, 0x40, 0x49, 0x52, 0x5b, 0x60, 0x65, 0x6b, 0x6f, 0x71, 0x72, 0x74, 0x75, 0x74,
+	0x73, 0x72, 0x70, 0x6d, 0x6b, 0x68, 0x65, 0x61, 0x5d, 0x59, 0x54, 0x4e, 0x49, 0x3f, 0x30, 0x1f,
+	0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x14, 0x22, 0x2f, 0x3c, 0x49, 0x53, 0x5c,
+	0x65, 0x6f, 0x75, 0x7a, 0x7f, 0x84, 0x86, 0x87, 0x89, 0x8a, 0x89, 0x88, 0x87, 0x85, 0x82, 0x80,
+	0x7d, 0x7a, 0x76, 0x72, 0x6d, 0x68, 0x63, 0x5c, 0x4e, 0x3c, 0x28, 0x14, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x15, 0x25, 0x32, 0x3f, 0x4c, 0x5a, 0x66, 0x6f, 0x78, 0x82, 0x89, 0x8e, 0x94,
+	0x99, 0x9b, 0x9d, 0x9e, 0x9f, 0x9e, 0x9d, 0x9c, 0x9a, 0x97, 0x95, 0x92, 0x8e, 0x8b, 0x87, 0x82,
+	0x7d, 0x78, 0x6b, 0x57, 0x42, 0x2d, 0x18, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x22, 0x32,
+	0x43, 0x50, 0x5d, 0x6a, 0x77, 0x82, 0x8b, 0x95, 0x9e, 0xa3, 0xa8, 0xae, 0xb0, 0xb2, 0xb3, 0xb4,
+	0xb3, 0xb2, 0xb1, 0xaf, 0xad, 0xaa, 0xa7, 0xa3, 0xa0, 0x9c, 0x97, 0x91, 0x83, 0x6e, 0x58, 0x43,
+	0x2e, 0x19, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1f, 0x2f, 0x40, 0x50, 0x61, 0x6e, 0x7b, 0x88,
+	0x95, 0x9f, 0xa8, 0xb1, 0xb8, 0xbd, 0xc2, 0xc5, 0xc7, 0xc9, 0xc9, 0xc9, 0xc8, 0xc7, 0xc4, 0xc2,
+	0xbf, 0xbc, 0xb8, 0xb5, 0xb0, 0xab, 0x98, 0x83, 0x6e, 0x58, 0x43, 0x2e, 0x19, 0x03, 0x00, 0x00,
+	0x00, 0x08, 0x1b, 0x2c, 0x3d, 0x4d, 0x5e, 0x6e, 0x7f, 0x8c, 0x99, 0xa6, 0xb2, 0xbb, 0xc4, 0xcc,
+	0xd2, 0xd1, 0xcd, 0xc9, 0xc5, 0xc3, 0xc4, 0xc5, 0xc7, 0xca, 0xcf, 0xd4, 0xd1, 0xcd, 0xca, 0xc3,
+	0xad, 0x98, 0x83, 0x6e, 0x58, 0x43, 0x2e, 0x19, 0x03, 0x00, 0x00, 0x00, 0x12, 0x25, 0x38, 0x4a,
+	0x5b, 0x6b, 0x7c, 0x8c, 0x9c, 0xaa, 0xb7, 0xc4, 0xce, 0xd7, 0xce, 0xc2, 0xbc, 0xb8, 0xb4, 0xb0,
+	0xae, 0xaf, 0xb0, 0xb2, 0xb5, 0xbc, 0xc9, 0xd9, 0xe2, 0xd8, 0xc3, 0xad, 0x98, 0x83, 0x6e, 0x58,
+	0x43, 0x2e, 0x19, 0x03, 0x00, 0x00, 0x08, 0x1b, 0x2e, 0x41, 0x54, 0x67, 0x79, 0x89, 0x9a, 0xaa,
+	0xba, 0xc7, 0xd5, 0xd8, 0xcb, 0xbe, 0xb0, 0xa7, 0xa3, 0x9f, 0x9b, 0x99, 0x9a, 0x9b, 0x9d, 0xa0,
+	0xab, 0xbb, 0xce, 0xe2, 0xd8, 0xc3, 0xad, 0x98, 0x83, 0x6e, 0x58, 0x43, 0x2e, 0x19, 0x03, 0x00,
+	0x00, 0x12, 0x25, 0x38, 0x4b, 0x5e, 0x71, 0x84, 0x96, 0xa7, 0xb7, 0xc8, 0xd8, 0xd6, 0xc8, 0xba,
+	0xad, 0xa0, 0x93, 0x8e, 0x8a, 0x86, 0x84, 0x84, 0x85, 0x88, 0x8d, 0x9f, 0xb3, 0xc8, 0xdd, 0xd8,
+	0xc3, 0xad, 0x98, 0x83, 0x6e, 0x58, 0x43, 0x2e, 0x19, 0x03, 0x00, 0x05, 0x19, 0x2d, 0x41, 0x54,
+	0x67, 0x7a, 0x8d, 0xa0, 0xb3, 0xc5, 0xd5, 0xdd, 0xca, 0xb8, 0xaa, 0x9c, 0x8f, 0x82, 0x79, 0x75,
+	0x71, 0x6e, 0x6f, 0x70, 0x73, 0x88, 0x9d, 0xb2, 0xc7, 0xdd, 0xd8, 0xc3, 0xad, 0x98, 0x83, 0x6e,
+	0x58, 0x43, 0x2e, 0x19, 0x03, 0x00, 0x0a, 0x1f, 0x33, 0x48, 0x5c, 0x71, 0x84, 0x97, 0xaa, 0xbd,
+	0xd0, 0xe3, 0xd4, 0xc1, 0xae, 0x9b, 0x8c, 0x7f, 0x71, 0x64, 0x60, 0x5c, 0x59, 0x5a, 0x5d, 0x72,
+	0x88, 0x9d, 0xb2, 0xc7, 0xdd, 0xd8, 0xc3, 0xad, 0x98, 0x83, 0x6e, 0x58, 0x43, 0x2e, 0x19, 0x03,
+	0x00, 0x10, 0x24, 0x39, 0x4d, 0x62, 0x76, 0x8b, 0x9f, 0xb3, 0xc6, 0xd9, 0xdd, 0xca, 0xb7, 0xa4,
+	0x91, 0x7e, 0x6e, 0x61, 0x53, 0x4b, 0x47, 0x44, 0x48, 0x5d, 0x72, 0x88, 0x9d, 0xb2, 0xc7, 0xdd,
+	0xd8, 0xc3, 0xad, 0x98, 0x83, 0x6e, 0x58, 0x43, 0x2e, 0x19, 0x03, 0x01, 0x15, 0x2a, 0x3e, 0x53,
+	0x67, 0x7c, 0x90, 0xa5, 0xb9, 0xce, 0xe2, 0xd4, 0xc1, 0xae, 0x9b, 0x88, 0x75, 0x62, 0x50, 0x43,
+	0x37, 0x33, 0x33, 0x48, 0x5d, 0x72, 0x88, 0x9d, 0xb2, 0xc7, 0xdd, 0xd8, 0xc3, 0xad, 0x98, 0x83,
+	0x6e, 0x58, 0x43, 0x2e, 0x19, 0x03, 0x04, 0x19, 0x2e, 0x43, 0x58, 0x6d, 0x81, 0x96, 0xaa, 0xbf,
+	0xd3, 0xe4, 0xcf, 0xba, 0xa5, 0x91, 0x7e, 0x6b, 0x58, 0x45, 0x32, 0x25, 0x1e, 0x33, 0x48, 0x5d,
+	0x72, 0x88, 0x9d, 0xb2, 0xc7, 0xdd, 0xd8, 0xc3, 0xad, 0x98, 0x83, 0x6e, 0x58, 0x43, 0x2e, 0x19,
+	0x03, 0x06, 0x1b, 0x30, 0x45, 0x5b, 0x70, 0x85, 0x9a, 0xaf, 0xc4, 0xd9, 0xe1, 0xcc, 0xb7, 0xa2,
+	0x8d, 0x78, 0x63, 0x4f, 0x3c, 0x29, 0x16, 0x1d, 0x33, 0x48, 0x5d, 0x72, 0x88, 0x9d, 0xb2, 0xc7,
+	0xdd, 0xd8, 0xc3, 0xad, 0x98, 0x83, 0x6e, 0x58, 0x43, 0x2e, 0x19, 0x03, 0x08, 0x1d, 0x32, 0x47,
+	0x5c, 0x71, 0x87, 0x9c, 0xb1, 0xc6, 0xdb, 0xde, 0xc9, 0xb4, 0x9f, 0x8a, 0x75, 0x60, 0x4b, 0x36,
+	0x21, 0x0c, 0x1d, 0x33, 0x48, 0x5d, 0x72, 0x88, 0x9d, 0xb2, 0xc7, 0xdd, 0xd8, 0xc3, 0xad, 0x98,
+	0x83, 0x6e, 0x58, 0x43, 0x2e, 0x19, 0x03, 0x09, 0x1e, 0x34, 0x49, 0x5e, 0x73, 0x88, 0x9e, 0xb3,
+	0xc8, 0xdd, 0xdb, 0xc6, 0xb1, 0x9c, 0x87, 0x72, 0x5d, 0x48, 0x33, 0x1e, 0x09, 0x1d, 0x33, 0x48,
+	0x5d, 0x72, 0x88, 0x9d, 0xb2, 0xc7, 0xdd, 0xd8, 0xc3, 0xad, 0x98, 0x83, 0x6e, 0x58, 0x43, 0x2e,
+	0x19, 0x03, 0x0b, 0x20, 0x35, 0x4a, 0x60, 0x75, 0x8a, 0x9f, 0xb4, 0xca, 0xdf, 0xd9, 0xc4, 0xaf,
+	0x9a, 0x84, 0x6f, 0x5a, 0x45, 0x30, 0x1b, 0x08, 0x1d, 0x33, 0x48, 0x5d, 0x72, 0x88, 0x9d, 0xb2,
+	0xc7, 0xdd, 0xd8, 0xc3, 0xad, 0x98, 0x83, 0x6e, 0x58, 0x43, 0x2e, 0x19, 0x03, 0x09, 0x1e, 0x34,
+	0x49, 0x5e, 0x73, 0x88, 0x9d, 0xb3, 0xc8, 0xdd, 0xdb, 0xc6, 0xb1, 0x9c, 0x87, 0x72, 0x5d, 0x47,
+	0x32, 0x1d, 0x08, 0x1d, 0x33, 0x48, 0x5d, 0x72, 0x88, 0x9d, 0xb2, 0xc7, 0xdd, 0xd8, 0xc3, 0xad,
+	0x98, 0x83, 0x6e, 0x58, 0x43, 0x2e, 0x19, 0x03, 0x07, 0x1c, 0x32, 0x47, 0x5c, 0x71, 0x86, 0x9b,
+	0xb1, 0xc6, 0xdb, 0xde, 0xc8, 0xb3, 0x9e, 0x89, 0x74, 0x5f, 0x4a, 0x35, 0x20, 0x0b, 0x1d, 0x33,
+	0x48, 0x5d, 0x72, 0x88, 0x9d, 0xb2, 0xc7, 0xdd, 0xd8, 0xc3, 0xad, 0x98, 0x83, 0x6e, 0x58, 0x43,
+	0x2e, 0x19, 0x03, 0x05, 0x1b, 0x30, 0x45, 0x5a, 0x6f, 0x84, 0x9a, 0xaf, 0xc4, 0xd9, 0xe0, 0xcb,
+	0xb6, 0xa1, 0x8c, 0x76, 0x61, 0x4d, 0x3a, 0x27, 0x19, 0x1d, 0x33, 0x48, 0x5d, 0x72, 0x88, 0x9d,
+	0xb2, 0xc7, 0xdd, 0xd8, 0xc3, 0xad, 0x98, 0x83, 0x6e, 0x58, 0x43, 0x2e, 0x19, 0x03, 0x03, 0x19,
+	0x2e, 0x43, 0x58, 0x6d, 0x82, 0x98, 0xad, 0xc2, 0xd6, 0xe2, 0xcd, 0xb8, 0xa4, 0x90, 0x7d, 0x6a,
+	0x57, 0x44, 0x35, 0x2e, 0x2c, 0x33, 0x48, 0x5d, 0x72, 0x88, 0x9d, 0xb2, 0xc7, 0xdd, 0xd8, 0xc3,
+	0xad, 0x98, 0x83, 0x6e, 0x58, 0x43, 0x2e, 0x19, 0x03, 0x02, 0x17, 0x2c, 0x41, 0x56, 0x6a, 0x7f,
+	0x93, 0xa7, 0xbb, 0xd0, 0xe4, 0xd3, 0xc0, 0xac, 0x99, 0x86, 0x73, 0x60, 0x53, 0x47, 0x43, 0x41,
+	0x44, 0x48, 0x5d, 0x72, 0x88, 0x9d, 0xb2, 0xc7, 0xdd, 0xd8, 0xc3, 0xad, 0x98, 0x83, 0x6e, 0x58,
+	0x43, 0x2e, 0x19, 0x03, 0x00, 0x13, 0x27, 0x3b, 0x50, 0x64, 0x78, 0x8c, 0xa1, 0xb5, 0xc9, 0xdd,
+	0xdc, 0xc9, 0xb6, 0xa3, 0x90, 0x7d, 0x71, 0x64, 0x5c, 0x58, 0x56, 0x59, 0x5c, 0x64, 0x72, 0x88,
+	0x9d, 0xb2, 0xc7, 0xdd, 0xd8, 0xc3, 0xad, 0x98, 0x83, 0x6e, 0x58, 0x43, 0x2e, 0x19, 0x03, 0x00,
+	0x0c, 0x21, 0x35, 0x49, 0x5d, 0x72, 0x86, 0x9a, 0xae, 0xc3, 0xd5, 0xe5, 0xd2, 0xbf, 0xac, 0x9b,
+	0x8e, 0x82, 0x75, 0x71, 0x6d, 0x6b, 0x6e, 0x71, 0x78, 0x80, 0x89, 0x9d, 0xb2, 0xc8, 0xdd, 0xd8,
+	0xc3, 0xad, 0x98, 0x83, 0x6e, 0x58, 0x43, 0x2e, 0x19, 0x03, 0x00, 0x06, 0x1a, 0x2e, 0x43, 0x57,
+	0x6b, 0x7f, 0x94, 0xa6, 0xb7, 0xc9, 0xdb, 0xdb, 0xc9, 0xb9, 0xac, 0x9f, 0x93, 0x89, 0x86, 0x82,
+	0x80, 0x83, 0x86, 0x8b, 0x93, 0x9b, 0xa7, 0xb9, 0xcc, 0xe0, 0xd8, 0xc3, 0xad, 0x98, 0x83, 0x6e,
+	0x58, 0x43, 0x2e, 0x19, 0x03, 0x00, 0x00, 0x14, 0x28, 0x3c, 0x50, 0x64, 0x76, 0x88, 0x9a, 0xac,
+	0xbd, 0xcf, 0xdc, 0xd7, 0xca, 0xbd, 0xb1, 0xa4, 0x9e, 0x9a, 0x97, 0x95, 0x98, 0x9b, 0x9f, 0xa7,
+	0xaf, 0xb8, 0xc5, 0xd6, 0xe8, 0xd8, 0xc3, 0xad, 0x98, 0x83, 0x6e, 0x58, 0x43, 0x2e, 0x19, 0x03,
+	0x00, 0x00, 0x0d, 0x21, 0x35, 0x47, 0x59, 0x6b, 0x7c, 0x8e, 0xa0, 0xb1, 0xbf, 0xcc, 0xd9, 0xdb,
+	0xce, 0xc2, 0xb7, 0xb3, 0xaf, 0xac, 0xaa, 0xad, 0xb0, 0xb3, 0xbb, 0xc3, 0xcb, 0xd5, 0xe3, 0xed,
+	0xd8, 0xc3, 0xad, 0x98, 0x83, 0x6e, 0x58, 0x43, 0x2e, 0x19, 0x03, 0x00, 0x00, 0x05, 0x18, 0x2a,
+	0x3b, 0x4d, 0x5f, 0x71, 0x82, 0x93, 0xa1, 0xae, 0xbb, 0xc7, 0xcf, 0xd6, 0xd4, 0xcc, 0xc8, 0xc4,
+	0xc1, 0xbf, 0xc2, 0xc5, 0xc8, 0xc7, 0xc6, 0xcb, 0xd6, 0xe4, 0xed, 0xd8, 0xc3, 0xad, 0x98, 0x83,
+	0x6e, 0x58, 0x43, 0x2e, 0x19, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x1e, 0x30, 0x41, 0x53, 0x65, 0x75,
+	0x83, 0x90, 0x9e, 0xab, 0xb3, 0xbb, 0xc3, 0xc7, 0xc9, 0xcb, 0xcd, 0xcb, 0xc9, 0xc6, 0xbf, 0xb8,
+	0xb2, 0xb1, 0xb8, 0xc6, 0xd6, 0xe8, 0xd8, 0xc3, 0xad, 0x98, 0x83, 0x6e, 0x58, 0x43, 0x2e, 0x19,
+	0x03, 0x00, 0x00, 0x00, 0x01, 0x12, 0x24, 0x36, 0x47, 0x58, 0x65, 0x72, 0x80, 0x8d, 0x98, 0x9f,
+	0xa7, 0xaf, 0xb2, 0xb4, 0xb6, 0xb8, 0xb6, 0xb4, 0xb2, 0xab, 0xa4, 0x9e, 0x9c, 0xa8, 0xb9, 0xcc,
+	0xe0, 0xd8, 0xc3, 0xad, 0x98, 0x83, 0x6e, 0x58, 0x43, 0x2e, 0x19, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0x18, 0x2a, 0x3a, 0x47, 0x54, 0x62, 0x6f, 0x7c, 0x84, 0x8c, 0x93, 0x9a, 0x9d, 0x9f, 0xa1,
+	0xa3, 0xa1, 0x9f, 0x9d, 0x97, 0x90, 0x89, 0x8a, 0x9d, 0xb2, 0xc8, 0xdd, 0xd7, 0xc2, 0xad, 0x97,
+	0x82, 0x6d, 0x58, 0x43, 0x2e, 0x18, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x1c, 0x29, 0x37,
+	0x44, 0x51, 0x5f, 0x68, 0x70, 0x78, 0x7f, 0x85, 0x88, 0x8a, 0x8c, 0x8e, 0x8c, 0x8a, 0x88, 0x83,
+	0x7c, 0x75, 0x88, 0x9d, 0xb2, 0xc7, 0xdd, 0xd5, 0xc0, 0xab, 0x95, 0x80, 0x6b, 0x56, 0x41, 0x2c,
+	0x16, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x18, 0x22, 0x29, 0x33, 0x41, 0x4d, 0x55, 0x5c,
+	0x64, 0x6c, 0x70, 0x72, 0x75, 0x77, 0x79, 0x77, 0x75, 0x72, 0x6f, 0x68, 0x74, 0x89, 0x9e, 0xb3,
+	0xc8, 0xdd, 0xd3, 0xbe, 0xa9, 0x93, 0x7e, 0x69, 0x54, 0x3f, 0x2a, 0x15, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x07, 0x18, 0x28, 0x35, 0x3e, 0x40, 0x3c, 0x39, 0x41, 0x48, 0x50, 0x58, 0x5b, 0x5d, 0x60,
+	0x62, 0x64, 0x62, 0x5f, 0x5d, 0x5a, 0x63, 0x78, 0x8d, 0xa2, 0xb7, 0xcc, 0xe1, 0xd1, 0xbc, 0xa7,
+	0x92, 0x7c, 0x67, 0x52, 0x3d, 0x28, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x24, 0x36, 0x46,
+	0x52, 0x55, 0x50, 0x4a, 0x44, 0x3e, 0x3c, 0x43, 0x46, 0x48, 0x4a, 0x4d, 0x4e, 0x4c, 0x4a, 0x48,
+	0x57, 0x69, 0x7b, 0x90, 0xa5, 0xba, 0xcf, 0xe3, 0xcf, 0xba, 0xa5, 0x90, 0x7a, 0x65, 0x50, 0x3b,
+	0x26, 0x11, 0x00, 0x00, 0x00, 0x00, 0x02, 0x17, 0x2c, 0x40, 0x53, 0x64, 0x6a, 0x64, 0x5e, 0x58,
+	0x52, 0x4c, 0x49, 0x46, 0x44, 0x43, 0x42, 0x45, 0x47, 0x4c, 0x57, 0x62, 0x74, 0x87, 0x99, 0xab,
+	0xbe, 0xd3, 0xdc, 0xc8, 0xb4, 0xa0, 0x8c, 0x77, 0x63, 0x4e, 0x39, 0x24, 0x0f, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x1b, 0x30, 0x45, 0x5a, 0x6e, 0x7f, 0x79, 0x73, 0x6d, 0x66, 0x61, 0x5e, 0x5b, 0x59,
+	0x58, 0x57, 0x5a, 0x5c, 0x5f, 0x69, 0x74, 0x80, 0x92, 0xa4, 0xb6, 0xc8, 0xda, 0xd5, 0xc1, 0xad,
+	0x99, 0x85, 0x71, 0x5c, 0x48, 0x34, 0x20, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x1f, 0x34, 0x49,
+	0x5e, 0x73, 0x87, 0x8d, 0x87, 0x81, 0x7b, 0x76, 0x73, 0x70, 0x6e, 0x6d, 0x6d, 0x6f, 0x72, 0x74,
+	0x7b, 0x86, 0x91, 0x9d, 0xaf, 0xc1, 0xd3, 0xe0, 0xce, 0xba, 0xa6, 0x92, 0x7e, 0x6a, 0x56, 0x42,
+	0x2d, 0x19, 0x05, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x24, 0x39, 0x4d, 0x62, 0x77, 0x8c, 0xa1, 0x9b,
+	0x95, 0x8f, 0x8b, 0x88, 0x85, 0x84, 0x83, 0x82, 0x84, 0x87, 0x89, 0x8e, 0x98, 0xa3, 0xae, 0xbb,
+	0xcc, 0xde, 0xd3, 0xc2, 0xb1, 0x9f, 0x8b, 0x77, 0x63, 0x4f, 0x3b, 0x27, 0x12, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x13, 0x28, 0x3d, 0x52, 0x67, 0x7b, 0x90, 0xa5, 0xb0, 0xaa, 0xa4, 0xa0, 0x9d, 0x9a,
+	0x99, 0x98, 0x97, 0x99, 0x9c, 0x9e, 0xa1, 0xab, 0xb5, 0xc0, 0xcb, 0xd9, 0xd7, 0xc7, 0xb5, 0xa4,
+	0x93, 0x82, 0x70, 0x5c, 0x48, 0x34, 0x20, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x03, 0x18, 0x2c, 0x41,
+	0x56, 0x6b, 0x80, 0x94, 0xa9, 0xbe, 0xbe, 0xb8, 0xb5, 0xb2, 0xaf, 0xae, 0xad, 0xac, 0xae, 0xb1,
+	0xb4, 0xb6, 0xbd, 0xc8, 0xd2, 0xdd, 0xd1, 0xc5, 0xb9, 0xa9, 0x98, 0x87, 0x76, 0x65, 0x53, 0x41,
+	0x2d, 0x19, 0x05, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1c, 0x31, 0x46, 0x5a, 0x6f, 0x84, 0x99, 0xae,
+	0xc2, 0xd2, 0xcd, 0xca, 0xc7, 0xc4, 0xc3, 0xc2, 0xc1, 0xc3, 0xc6, 0xc9, 0xcb, 0xd0, 0xd7, 0xd1,
+	0xcb, 0xc0, 0xb4, 0xa8, 0x9c, 0x8b, 0x7a, 0x69, 0x58, 0x47, 0x36, 0x24, 0x11, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0b, 0x20, 0x35, 0x4a, 0x5f, 0x74, 0x88, 0x9d, 0xb2, 0xbc, 0xc1, 0xc7, 0xca, 0xcc,
+	0xce, 0xd0, 0xd2, 0xd3, 0xd2, 0xd0, 0xce, 0xcc, 0xc9, 0xc3, 0xbd, 0xb6, 0xae, 0xa2, 0x96, 0x8a,
+	0x7e, 0x6d, 0x5c, 0x4b, 0x3a, 0x29, 0x18, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x25, 0x39,
+	0x4e, 0x63, 0x78, 0x8d, 0x9d, 0xa2, 0xa8, 0xad, 0xb2, 0xb5, 0xb7, 0xb9, 0xba, 0xbc, 0xbe, 0xbd,
+	0xbb, 0xb9, 0xb7, 0xb5, 0xaf, 0xa8, 0xa2, 0x9c, 0x90, 0x85, 0x79, 0x6d, 0x60, 0x50, 0x3f, 0x2e,
+	0x1c, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x27, 0x3c, 0x52, 0x67, 0x7c, 0x83, 0x89,
+	0x8e, 0x93, 0x98, 0x9d, 0xa0, 0xa2, 0xa3, 0xa5, 0xa7, 0xa9, 0xa7, 0xa6, 0xa4, 0xa2, 0xa0, 0x9a,
+	0x94, 0x8e, 0x87, 0x7f, 0x73, 0x67, 0x5b, 0x4f, 0x42, 0x32, 0x21, 0x10, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x24, 0x39, 0x4d, 0x5f, 0x6a, 0x6f, 0x74, 0x79, 0x7e, 0x84, 0x89, 0x8b,
+	0x8c, 0x8e, 0x90, 0x92, 0x94, 0x92, 0x90, 0x8f, 0x8d, 0x8b, 0x86, 0x80, 0x79, 0x73, 0x6d, 0x61,
+	0x55, 0x4a, 0x3e, 0x32, 0x24, 0x14, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1d,
+	0x30, 0x41, 0x4e, 0x55, 0x5a, 0x5f, 0x65, 0x6a, 0x6f, 0x73, 0x75, 0x77, 0x79, 0x7b, 0x7d, 0x7f,
+	0x7d, 0x7b, 0x79, 0x78, 0x76, 0x72, 0x6b, 0x65, 0x5f, 0x59, 0x50, 0x44, 0x38, 0x2c, 0x20, 0x14,
+	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x23, 0x31, 0x3b, 0x40, 0x46,
+	0x4b, 0x50, 0x55, 0x5a, 0x5e, 0x60, 0x62, 0x64, 0x66, 0x68, 0x69, 0x68, 0x66, 0x64, 0x63, 0x61,
+	0x5d, 0x57, 0x51, 0x4b, 0x44, 0x3d, 0x32, 0x26, 0x1a, 0x0f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x13, 0x1e, 0x27, 0x2c, 0x31, 0x36, 0x3b, 0x41, 0x46, 0x49,
+	0x4b, 0x4d, 0x4f, 0x51, 0x53, 0x54, 0x53, 0x51, 0x4f, 0x4d, 0x4c, 0x49, 0x43, 0x3c, 0x36, 0x30,
+	0x2a, 0x20, 0x15, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x0b, 0x12, 0x17, 0x1c, 0x22, 0x27, 0x2c, 0x31, 0x34, 0x36, 0x38, 0x3a, 0x3b, 0x3d,
+	0x3f, 0x3d, 0x3c, 0x3a, 0x38, 0x36, 0x34, 0x2e, 0x28, 0x22, 0x1c, 0x15, 0x0e, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+	0x08, 0x0d, 0x12, 0x17, 0x1c, 0x1f, 0x21, 0x23, 0x24, 0x26, 0x28, 0x2a, 0x28, 0x27, 0x25, 0x23,
+	0x21, 0x1f, 0x1a, 0x14, 0x0e, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x08,
+	0x0a, 0x0c, 0x0d, 0x0f, 0x11, 0x13, 0x14, 0x13, 0x11, 0x10, 0x0e, 0x0c, 0x0a, 0x06, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const u8 ttfReferenceColon[24 * 47] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x0a, 0x0a, 0x07, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0d,
+	0x14, 0x18, 0x1c, 0x1f, 0x1f, 0x1c, 0x18, 0x14, 0x0c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x15, 0x20, 0x29, 0x2d, 0x31, 0x35, 0x34, 0x31, 0x2d, 0x28,
+	0x1f, 0x14, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x11, 0x1d, 0x28, 0x32,
+	0x3d, 0x42, 0x46, 0x4a, 0x49, 0x46, 0x42, 0x3c, 0x31, 0x27, 0x1c, 0x10, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x20, 0x2f, 0x3a, 0x45, 0x4f, 0x57, 0x5b, 0x5e, 0x5e, 0x5b, 0x57, 0x4e,
+	0x44, 0x39, 0x2e, 0x1f, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x1c, 0x2d, 0x3e, 0x4c, 0x57,
+	0x62, 0x6c, 0x70, 0x73, 0x73, 0x6f, 0x6b, 0x61, 0x56, 0x4b, 0x3d, 0x2c, 0x1b, 0x0a, 0x00, 0x00,
+	0x00, 0x06, 0x18, 0x29, 0x3a, 0x4b, 0x5c, 0x6a, 0x74, 0x7f, 0x85, 0x88, 0x88, 0x84, 0x7e, 0x73,
+	0x69, 0x5b, 0x49, 0x38, 0x27, 0x16, 0x04, 0x00, 0x00, 0x0f, 0x23, 0x35, 0x47, 0x58, 0x69, 0x7a,
+	0x87, 0x91, 0x9a, 0x9d, 0x9d, 0x99, 0x90, 0x86, 0x78, 0x67, 0x56, 0x45, 0x34, 0x21, 0x0d, 0x00,
+	0x00, 0x15, 0x2a, 0x3e, 0x52, 0x64, 0x75, 0x87, 0x98, 0xa4, 0xae, 0xb2, 0xb2, 0xad, 0xa3, 0x96,
+	0x85, 0x74, 0x63, 0x50, 0x3c, 0x28, 0x13, 0x00, 0x03, 0x18, 0x2d, 0x42, 0x57, 0x6c, 0x81, 0x93,
+	0xa4, 0xb5, 0xc1, 0xc7, 0xc7, 0xc0, 0xb4, 0xa3, 0x92, 0x7f, 0x6a, 0x55, 0x40, 0x2b, 0x16, 0x01,
+	0x07, 0x1c, 0x31, 0x46, 0x5b, 0x70, 0x85, 0x9a, 0xaf, 0xc2, 0xd3, 0xdc, 0xdc, 0xd1, 0xc0, 0xad,
+	0x98, 0x83, 0x6e, 0x59, 0x44, 0x2f, 0x1a, 0x05, 0x0a, 0x20, 0x35, 0x4a, 0x5f, 0x74, 0x88, 0x9d,
+	0xb2, 0xc7, 0xdc, 0xf0, 0xef, 0xda, 0xc5, 0xb0, 0x9b, 0x86, 0x72, 0x5d, 0x48, 0x33, 0x1d, 0x08,
+	0x0a, 0x1f, 0x34, 0x49, 0x5e, 0x73, 0x88, 0x9d, 0xb1, 0xc6, 0xdb, 0xec, 0xeb, 0xd9, 0xc4, 0xaf,
+	0x9b, 0x86, 0x71, 0x5c, 0x47, 0x32, 0x1d, 0x08, 0x06, 0x1b, 0x30, 0x45, 0x5a, 0x6f, 0x84, 0x99,
+	0xae, 0xbf, 0xcf, 0xd7, 0xd7, 0xce, 0xbe, 0xac, 0x97, 0x82, 0x6d, 0x58, 0x43, 0x2e, 0x19, 0x04,
+	0x03, 0x18, 0x2c, 0x41, 0x56, 0x6b, 0x7f, 0x90, 0xa1, 0xb2, 0xbd, 0xc2, 0xc2, 0xbc, 0xb1, 0xa0,
+	0x8f, 0x7e, 0x69, 0x54, 0x3f, 0x2a, 0x16, 0x01, 0x00, 0x14, 0x28, 0x3d, 0x50, 0x62, 0x73, 0x84,
+	0x95, 0xa0, 0xaa, 0xae, 0xad, 0xa9, 0x9f, 0x93, 0x82, 0x71, 0x60, 0x4e, 0x3b, 0x26, 0x12, 0x00,
+	0x00, 0x0d, 0x21, 0x33, 0x44, 0x55, 0x66, 0x77, 0x83, 0x8d, 0x95, 0x99, 0x98, 0x95, 0x8c, 0x81,
+	0x75, 0x64, 0x53, 0x42, 0x31, 0x1f, 0x0b, 0x00, 0x00, 0x04, 0x15, 0x26, 0x37, 0x48, 0x59, 0x65,
+	0x70, 0x7b, 0x80, 0x84, 0x83, 0x80, 0x7a, 0x6f, 0x64, 0x58, 0x47, 0x36, 0x24, 0x13, 0x02, 0x00,
+	0x00, 0x00, 0x08, 0x19, 0x2b, 0x3b, 0x48, 0x53, 0x5e, 0x67, 0x6b, 0x6f, 0x6e, 0x6b, 0x67, 0x5d,
+	0x52, 0x47, 0x3a, 0x29, 0x18, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x1d, 0x2b, 0x36, 0x41,
+	0x4b, 0x53, 0x56, 0x5a, 0x59, 0x56, 0x52, 0x4a, 0x40, 0x35, 0x2a, 0x1c, 0x0b, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0d, 0x19, 0x24, 0x2e, 0x38, 0x3e, 0x41, 0x45, 0x44, 0x41, 0x3d, 0x38,
+	0x2d, 0x23, 0x18, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x11, 0x1c,
+	0x24, 0x29, 0x2c, 0x30, 0x30, 0x2c, 0x28, 0x24, 0x1b, 0x10, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x14, 0x17, 0x1b, 0x1a, 0x17, 0x13, 0x0f,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x09, 0x0d, 0x10, 0x10, 0x0d, 0x09, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x13, 0x1a, 0x1e, 0x22, 0x25, 0x25, 0x22, 0x1e, 0x1a,
+	0x12, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x10, 0x1b, 0x25,
+	0x2e, 0x33, 0x37, 0x3a, 0x3a, 0x36, 0x33, 0x2e, 0x24, 0x1a, 0x0f, 0x04, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x06, 0x15, 0x22, 0x2d, 0x38, 0x42, 0x48, 0x4c, 0x4f, 0x4f, 0x4b, 0x48, 0x41,
+	0x37, 0x2c, 0x21, 0x14, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x13, 0x24, 0x33, 0x3f, 0x4a,
+	0x55, 0x5d, 0x61, 0x64, 0x64, 0x60, 0x5d, 0x54, 0x49, 0x3e, 0x32, 0x23, 0x12, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0f, 0x20, 0x31, 0x42, 0x51, 0x5c, 0x67, 0x72, 0x76, 0x79, 0x79, 0x75, 0x71, 0x66,
+	0x5b, 0x50, 0x40, 0x2f, 0x1e, 0x0d, 0x00, 0x00, 0x00, 0x09, 0x1b, 0x2c, 0x3e, 0x4f, 0x60, 0x6f,
+	0x79, 0x84, 0x8b, 0x8e, 0x8e, 0x8a, 0x83, 0x78, 0x6e, 0x5e, 0x4d, 0x3c, 0x2b, 0x1a, 0x07, 0x00,
+	0x00, 0x11, 0x25, 0x38, 0x4a, 0x5b, 0x6c, 0x7d, 0x8c, 0x96, 0xa0, 0xa3, 0xa3, 0x9f, 0x95, 0x8b,
+	0x7c, 0x6b, 0x5a, 0x49, 0x37, 0x23, 0x0f, 0x00, 0x01, 0x16, 0x2b, 0x40, 0x54, 0x68, 0x79, 0x8a,
+	0x9b, 0xa9, 0xb3, 0xb8, 0xb8, 0xb2, 0xa8, 0x9a, 0x88, 0x77, 0x66, 0x52, 0x3e, 0x29, 0x14, 0x00,
+	0x05, 0x19, 0x2e, 0x43, 0x58, 0x6d, 0x82, 0x97, 0xa8, 0xb9, 0xc6, 0xcd, 0xcd, 0xc5, 0xb7, 0xa6,
+	0x95, 0x80, 0x6b, 0x56, 0x41, 0x2c, 0x17, 0x03, 0x08, 0x1d, 0x32, 0x47, 0x5c, 0x71, 0x86, 0x9b,
+	0xb0, 0xc5, 0xd7, 0xe2, 0xe2, 0xd5, 0xc3, 0xae, 0x99, 0x84, 0x6f, 0x5a, 0x45, 0x30, 0x1b, 0x06,
+	0x0b, 0x20, 0x35, 0x4a, 0x60, 0x75, 0x8a, 0x9e, 0xb3, 0xc8, 0xdd, 0xf2, 0xf0, 0xdb, 0xc6, 0xb1,
+	0x9c, 0x88, 0x73, 0x5e, 0x48, 0x33, 0x1e, 0x09, 0x09, 0x1e, 0x33, 0x48, 0x5d, 0x72, 0x87, 0x9c,
+	0xb0, 0xc5, 0xd9, 0xe6, 0xe6, 0xd8, 0xc3, 0xae, 0x9a, 0x85, 0x70, 0x5b, 0x46, 0x31, 0x1c, 0x07,
+	0x05, 0x1a, 0x2f, 0x44, 0x59, 0x6e, 0x83, 0x98, 0xab, 0xbc, 0xca, 0xd2, 0xd1, 0xc9, 0xba, 0xa9,
+	0x96, 0x81, 0x6c, 0x57, 0x42, 0x2d, 0x18, 0x03, 0x02, 0x17, 0x2b, 0x40, 0x55, 0x6a, 0x7c, 0x8d,
+	0x9e, 0xad, 0xb7, 0xbd, 0xbc, 0xb6, 0xac, 0x9c, 0x8b, 0x7a, 0x68, 0x53, 0x3e, 0x29, 0x15, 0x00,
+	0x00, 0x12, 0x27, 0x3a, 0x4d, 0x5e, 0x6f, 0x80, 0x90, 0x9a, 0xa4, 0xa8, 0xa7, 0xa4, 0x99, 0x8f,
+	0x7f, 0x6d, 0x5c, 0x4b, 0x39, 0x25, 0x10, 0x00, 0x00, 0x0b, 0x1e, 0x2f, 0x40, 0x51, 0x62, 0x73,
+	0x7d, 0x88, 0x8f, 0x93, 0x92, 0x8f, 0x87, 0x7c, 0x71, 0x61, 0x50, 0x3f, 0x2e, 0x1c, 0x09, 0x00,
+	0x00, 0x00, 0x12, 0x23, 0x34, 0x45, 0x55, 0x60, 0x6b, 0x76, 0x7a, 0x7e, 0x7d, 0x7a, 0x75, 0x6a,
+	0x5f, 0x53, 0x43, 0x32, 0x21, 0x10, 0x00, 0x00, 0x00, 0x00, 0x05, 0x16, 0x27, 0x37, 0x43, 0x4e,
+	0x59, 0x62, 0x65, 0x69, 0x68, 0x65, 0x61, 0x58, 0x4d, 0x42, 0x35, 0x25, 0x14, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x09, 0x19, 0x26, 0x31, 0x3c, 0x46, 0x4d, 0x50, 0x54, 0x54, 0x50, 0x4c, 0x45,
+	0x3b, 0x30, 0x25, 0x17, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x14, 0x1f, 0x29,
+	0x33, 0x38, 0x3b, 0x3f, 0x3f, 0x3b, 0x37, 0x32, 0x28, 0x1d, 0x13, 0x07, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0c, 0x17, 0x1f, 0x23, 0x26, 0x2a, 0x2a, 0x26, 0x22, 0x1e,
+	0x16, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+	0x0a, 0x0e, 0x11, 0x15, 0x15, 0x11, 0x0e, 0x0a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const u8 ttfReferenceQuote[36 * 31] = {
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x0a, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+	0x08, 0x02, 0x07, 0x0a, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x08, 0x02,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x12, 0x1b, 0x1f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x1d, 0x16, 0x1b, 0x1f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x1d, 0x16, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x06, 0x16, 0x24, 0x2f, 0x34, 0x35, 0x35,
+	0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x32, 0x29, 0x2f, 0x35, 0x35, 0x35, 0x35, 0x35,
+	0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x31, 0x28, 0x1c, 0x0c, 0x00, 0x00, 0x00, 0x12, 0x24, 0x34,
+	0x42, 0x49, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x46, 0x3a, 0x42, 0x4a,
+	0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x45, 0x3a, 0x2a, 0x19, 0x06, 0x00,
+	0x06, 0x1b, 0x2f, 0x42, 0x52, 0x5e, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+	0x58, 0x49, 0x53, 0x5e, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5f, 0x57, 0x48,
+	0x36, 0x22, 0x0e, 0x00, 0x0a, 0x1f, 0x34, 0x49, 0x5e, 0x70, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
+	0x75, 0x75, 0x75, 0x75, 0x66, 0x52, 0x5f, 0x71, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
+	0x75, 0x74, 0x65, 0x51, 0x3c, 0x27, 0x12, 0x00, 0x0b, 0x20, 0x35, 0x4a, 0x60, 0x75, 0x8a, 0x8a,
+	0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x7e, 0x68, 0x53, 0x61, 0x76, 0x8a, 0x8a, 0x8a, 0x8a,
+	0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x7d, 0x67, 0x52, 0x3d, 0x28, 0x12, 0x00, 0x0b, 0x20, 0x35, 0x4a,
+	0x60, 0x75, 0x8a, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x93, 0x7e, 0x68, 0x53, 0x61, 0x76,
+	0x8b, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x92, 0x7d, 0x67, 0x52, 0x3d, 0x28, 0x12, 0x00,
+	0x0b, 0x20, 0x35, 0x4a, 0x60, 0x75, 0x8a, 0x9f, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xa8, 0x93, 0x7e,
+	0x68, 0x53, 0x61, 0x76, 0x8b, 0xa0, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xa7, 0x92, 0x7d, 0x67, 0x52,
+	0x3d, 0x28, 0x12, 0x00, 0x0b, 0x20, 0x35, 0x4a, 0x60, 0x75, 0x8a, 0x9f, 0xb5, 0xca, 0xca, 0xca,
+	0xbd, 0xa8, 0x93, 0x7e, 0x68, 0x53, 0x61, 0x76, 0x8b, 0xa0, 0xb6, 0xca, 0xca, 0xca, 0xbc, 0xa7,
+	0x92, 0x7d, 0x67, 0x52, 0x3d, 0x28, 0x12, 0x00, 0x0b, 0x20, 0x35, 0x4a, 0x60, 0x75, 0x8a, 0x9f,
+	0xb5, 0xca, 0xdf, 0xd3, 0xbd, 0xa8, 0x93, 0x7e, 0x68, 0x53, 0x61, 0x76, 0x8b, 0xa0, 0xb6, 0xcb,
+	0xdf, 0xd2, 0xbc, 0xa7, 0x92, 0x7d, 0x67, 0x52, 0x3d, 0x28, 0x12, 0x00, 0x0a, 0x1f, 0x34, 0x49,
+	0x5f, 0x74, 0x89, 0x9e, 0xb3, 0xc9, 0xde, 0xd1, 0xbc, 0xa7, 0x92, 0x7c, 0x67, 0x52, 0x60, 0x75,
+	0x8a, 0x9f, 0xb4, 0xca, 0xdf, 0xd0, 0xbb, 0xa6, 0x91, 0x7b, 0x66, 0x51, 0x3c, 0x27, 0x11, 0x00,
+	0x08, 0x1e, 0x33, 0x48, 0x5d, 0x73, 0x88, 0x9d, 0xb2, 0xc7, 0xdd, 0xd0, 0xba, 0xa5, 0x90, 0x7b,
+	0x66, 0x50, 0x5e, 0x74, 0x89, 0x9e, 0xb3, 0xc8, 0xde, 0xcf, 0xb9, 0xa4, 0x8f, 0x7a, 0x65, 0x4f,
+	0x3a, 0x25, 0x10, 0x00, 0x07, 0x1c, 0x32, 0x47, 0x5c, 0x71, 0x86, 0x9c, 0xb1, 0xc6, 0xdb, 0xce,
+	0xb9, 0xa4, 0x8f, 0x79, 0x64, 0x4f, 0x5d, 0x72, 0x87, 0x9d, 0xb2, 0xc7, 0xdc, 0xcd, 0xb8, 0xa3,
+	0x8e, 0x78, 0x63, 0x4e, 0x39, 0x24, 0x0e, 0x00, 0x06, 0x1b, 0x30, 0x45, 0x5b, 0x70, 0x85, 0x9a,
+	0xb0, 0xc5, 0xda, 0xcd, 0xb7, 0xa2, 0x8d, 0x78, 0x63, 0x4d, 0x5c, 0x71, 0x86, 0x9b, 0xb1, 0xc6,
+	0xdb, 0xcc, 0xb6, 0xa1, 0x8c, 0x77, 0x62, 0x4c, 0x37, 0x22, 0x0d, 0x00, 0x05, 0x1a, 0x2f, 0x44,
+	0x59, 0x6f, 0x84, 0x99, 0xae, 0xc3, 0xd9, 0xcb, 0xb6, 0xa1, 0x8c, 0x76, 0x61, 0x4c, 0x5a, 0x70,
+	0x85, 0x9a, 0xaf, 0xc4, 0xda, 0xca, 0xb5, 0xa0, 0x8b, 0x75, 0x60, 0x4b, 0x36, 0x21, 0x0b, 0x00,
+	0x03, 0x18, 0x2e, 0x43, 0x58, 0x6d, 0x83, 0x98, 0xad, 0xc2, 0xd7, 0xca, 0xb4, 0x9f, 0x8a, 0x75,
+	0x60, 0x4a, 0x59, 0x6e, 0x84, 0x99, 0xae, 0xc3, 0xd8, 0xc9, 0xb3, 0x9e, 0x89, 0x74, 0x5f, 0x49,
+	0x34, 0x1f, 0x0a, 0x00, 0x02, 0x17, 0x2c, 0x42, 0x57, 0x6c, 0x81, 0x96, 0xab, 0xc0, 0xd5, 0xc7,
+	0xb2, 0x9d, 0x88, 0x73, 0x5e, 0x49, 0x58, 0x6d, 0x82, 0x97, 0xac, 0xc1, 0xd6, 0xc6, 0xb1, 0x9c,
+	0x87, 0x72, 0x5d, 0x48, 0x33, 0x1e, 0x08, 0x00, 0x00, 0x15, 0x2a, 0x3f, 0x54, 0x69, 0x7e, 0x93,
+	0xa8, 0xbd, 0xd2, 0xc4, 0xaf, 0x9a, 0x85, 0x70, 0x5b, 0x46, 0x55, 0x6a, 0x7f, 0x94, 0xa9, 0xbe,
+	0xd3, 0xc3, 0xae, 0x99, 0x84, 0x6f, 0x5a, 0x45, 0x30, 0x1b, 0x06, 0x00, 0x00, 0x12, 0x27, 0x3c,
+	0x51, 0x66, 0x7b, 0x90, 0xa5, 0xba, 0xcf, 0xc1, 0xac, 0x97, 0x82, 0x6d, 0x58, 0x43, 0x52, 0x67,
+	0x7c, 0x91, 0xa6, 0xbb, 0xd0, 0xc0, 0xab, 0x96, 0x81, 0x6c, 0x57, 0x42, 0x2d, 0x18, 0x03, 0x00,
+	0x00, 0x0e, 0x24, 0x39, 0x4e, 0x63, 0x78, 0x8d, 0xa2, 0xb7, 0xcc, 0xbe, 0xa9, 0x94, 0x7f, 0x6a,
+	0x55, 0x40, 0x4f, 0x64, 0x79, 0x8e, 0xa3, 0xb8, 0xcd, 0xbd, 0xa8, 0x93, 0x7e, 0x69, 0x54, 0x3f,
+	0x2a, 0x15, 0x00, 0x00, 0x00, 0x0b, 0x20, 0x35, 0x4a, 0x5f, 0x74, 0x89, 0x9e, 0xb3, 0xc6, 0xbb,
+	0xa6, 0x91, 0x7c, 0x67, 0x52, 0x3d, 0x4b, 0x60, 0x75, 0x8a, 0x9f, 0xb4, 0xc6, 0xba, 0xa5, 0x90,
+	0x7b, 0x66, 0x51, 0x3c, 0x27, 0x12, 0x00, 0x00, 0x00, 0x08, 0x1d, 0x32, 0x47, 0x5c, 0x71, 0x86,
+	0x9b, 0xb0, 0xb1, 0xb1, 0xa3, 0x8e, 0x79, 0x64, 0x4f, 0x3a, 0x48, 0x5d, 0x72, 0x87, 0x9c, 0xb1,
+	0xb1, 0xb1, 0xa2, 0x8d, 0x78, 0x63, 0x4e, 0x39, 0x24, 0x0f, 0x00, 0x00, 0x00, 0x05, 0x1a, 0x2f,
+	0x44, 0x59, 0x6e, 0x83, 0x98, 0x9b, 0x9b, 0x9b, 0x9b, 0x8b, 0x76, 0x61, 0x4c, 0x37, 0x45, 0x5a,
+	0x6f, 0x84, 0x99, 0x9b, 0x9b, 0x9b, 0x9b, 0x8a, 0x75, 0x60, 0x4b, 0x36, 0x21, 0x0c, 0x00, 0x00,
+	0x00, 0x02, 0x17, 0x2c, 0x41, 0x56, 0x6b, 0x80, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x73, 0x5e,
+	0x49, 0x34, 0x42, 0x57, 0x6c, 0x81, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x72, 0x5d, 0x48, 0x33,
+	0x1e, 0x09, 0x00, 0x00, 0x00, 0x00, 0x14, 0x29, 0x3d, 0x52, 0x65, 0x71, 0x71, 0x71, 0x71, 0x71,
+	0x71, 0x71, 0x6c, 0x5a, 0x46, 0x31, 0x3e, 0x53, 0x66, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
+	0x6b, 0x59, 0x45, 0x30, 0x1b, 0x06, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x23, 0x36, 0x47, 0x55, 0x5c,
+	0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x59, 0x4e, 0x3d, 0x2b, 0x37, 0x48, 0x56, 0x5c, 0x5c, 0x5c,
+	0x5c, 0x5c, 0x5c, 0x5c, 0x59, 0x4d, 0x3c, 0x2a, 0x16, 0x02, 0x00, 0x00, 0x00, 0x00, 0x06, 0x19,
+	0x29, 0x38, 0x42, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x45, 0x3d, 0x30, 0x20, 0x2a, 0x39,
+	0x43, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x45, 0x3c, 0x2f, 0x1f, 0x0d, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0b, 0x1a, 0x26, 0x2e, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x30, 0x2a,
+	0x1f, 0x12, 0x1b, 0x27, 0x2e, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x30, 0x29, 0x1f, 0x11,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x13, 0x1a, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c,
+	0x1c, 0x1c, 0x1b, 0x16, 0x0d, 0x02, 0x09, 0x13, 0x1a, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c,
+	0x1b, 0x16, 0x0d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x05, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const struct TtfReferenceCell ttfReferenceCells[] = {
+	{ 'A', 57, 57, ttfReferenceA },
+	{ 'g', 43, 59, ttfReferenceG },
+	{ ':', 24, 47, ttfReferenceColon },
+	{ '"', 36, 31, ttfReferenceQuote }
+};